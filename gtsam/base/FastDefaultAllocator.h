@@ -18,6 +18,9 @@
 
 #pragma once
 #include <gtsam/config.h>      // Configuration from CMake
+#include <gtsam/dllexport.h>
+
+#include <cstddef>
 
 #if !defined GTSAM_ALLOCATOR_BOOSTPOOL && !defined GTSAM_ALLOCATOR_TBB && !defined GTSAM_ALLOCATOR_STL
 #  ifdef GTSAM_USE_TBB
@@ -44,6 +47,36 @@ namespace gtsam
 
   namespace internal
   {
+#if defined GTSAM_ENABLE_ALLOCATION_TRACKING && defined GTSAM_ALLOCATOR_TBB
+    // Declared in timing.h, which cannot be included here
+    GTSAM_EXPORT void recordAllocation(size_t bytes);
+    GTSAM_EXPORT void recordDeallocation(size_t bytes);
+
+    /// Allocator that reports to the memory profile of the timing library.
+    /// The TBB allocator does not go through malloc, so it is wrapped in this.
+    template<typename T, typename Base>
+    struct TrackingAllocator : public Base
+    {
+      typedef typename Base::size_type size_type;
+      typedef typename Base::pointer pointer;
+      template<typename U> struct rebind {
+        typedef TrackingAllocator<U, typename Base::template rebind<U>::other> other;
+      };
+      TrackingAllocator() {}
+      template<typename U, typename B>
+      TrackingAllocator(const TrackingAllocator<U, B>& other) : Base(other) {}
+      pointer allocate(size_type n, const void* hint = 0) {
+        pointer p = Base::allocate(n, hint);
+        recordAllocation(n * sizeof(T));
+        return p;
+      }
+      void deallocate(pointer p, size_type n) {
+        recordDeallocation(n * sizeof(T));
+        Base::deallocate(p, n);
+      }
+    };
+#endif
+
     /// Default allocator for list, map, and set types
     template<typename T>
     struct FastDefaultAllocator
@@ -54,7 +87,11 @@ namespace gtsam
       static const bool isTBB = false;
       static const bool isSTL = false;
 #elif defined GTSAM_ALLOCATOR_TBB
+#  ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+      typedef TrackingAllocator<T, tbb::tbb_allocator<T> > type;
+#  else
       typedef tbb::tbb_allocator<T> type;
+#  endif
       static const bool isBoost = false;
       static const bool isTBB = true;
       static const bool isSTL = false;
@@ -71,7 +108,11 @@ namespace gtsam
     struct FastDefaultVectorAllocator
     {
 #if defined GTSAM_ALLOCATOR_TBB
+#  ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+      typedef TrackingAllocator<T, tbb::tbb_allocator<T> > type;
+#  else
       typedef tbb::tbb_allocator<T> type;
+#  endif
       static const bool isBoost = false;
       static const bool isTBB = true;
       static const bool isSTL = false;
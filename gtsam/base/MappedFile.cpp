@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    MappedFile.cpp
+ * @brief   Read-only view of a whole file, memory-mapped where supported
+ * @date    October 2026
+ */
+
+#include <gtsam/base/MappedFile.h>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+MappedFile::MappedFile(const string& filename) {
+#ifdef _WIN32
+  ifstream is(filename.c_str(), ios::binary);
+  if (!is) throw runtime_error("MappedFile: cannot open " + filename);
+  buffer_.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#else
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw runtime_error("MappedFile: cannot open " + filename);
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw runtime_error("MappedFile: cannot read " + filename);
+  }
+  size_ = st.st_size;
+  if (size_ == 0) {  // mmap does not accept empty files
+    ::close(fd);
+    return;
+  }
+  void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED)
+    throw runtime_error("MappedFile: cannot map " + filename);
+  data_ = static_cast<const char*>(p);
+  mapped_ = true;
+#ifdef POSIX_MADV_SEQUENTIAL
+  posix_madvise(p, size_, POSIX_MADV_SEQUENTIAL);
+#endif
+#endif
+}
+
+/* ************************************************************************* */
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+}  // namespace gtsam
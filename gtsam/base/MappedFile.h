@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    MappedFile.h
+ * @brief   Read-only view of a whole file, memory-mapped where supported
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/dllexport.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The contents of a file, mapped read-only into memory on POSIX systems and
+ * read into a buffer elsewhere. The contents are not null-terminated.
+ */
+class GTSAM_EXPORT MappedFile {
+ public:
+  /// Map the file. Throws std::runtime_error if it cannot be opened.
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return data_; }  ///< first byte
+  const char* end() const { return data_ + size_; }  ///< past the last byte
+  size_t size() const { return size_; }  ///< size in bytes
+
+ private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<char> buffer_;  ///< file contents where mmap is unavailable
+};
+
+}  // namespace gtsam
@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    allocationTracking.cpp
+ * @brief   Heap allocation hooks that feed the per-section memory profile of
+ *          the timing library, compiled in with GTSAM_ENABLE_ALLOCATION_TRACKING
+ * @date    October 2026
+ *
+ * With glibc, the malloc family is replaced by wrappers around the glibc
+ * implementation, which sees every heap allocation in the process: operator
+ * new and hence boost::make_shared and the standard containers, the Eigen
+ * matrix storage, and the memory pools behind FastDefaultAllocator. The size
+ * of a block is taken from malloc_usable_size, so no bookkeeping is needed.
+ *
+ * Elsewhere, the global operator new and delete are replaced instead, which
+ * covers everything except Eigen's dynamic matrices, which use std::malloc.
+ * The TBB allocator is wrapped separately in FastDefaultAllocator.h.
+ */
+
+#include <gtsam/config.h>
+
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+
+#include <gtsam/base/timing.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+using gtsam::internal::recordAllocation;
+using gtsam::internal::recordDeallocation;
+
+#ifdef __GLIBC__
+
+#include <malloc.h>
+
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void* __libc_valloc(size_t size);
+void* __libc_pvalloc(size_t size);
+void __libc_free(void* ptr);
+
+static void* recorded(void* ptr) {
+  if (ptr) recordAllocation(malloc_usable_size(ptr));
+  return ptr;
+}
+
+void* malloc(size_t size) noexcept {
+  return recorded(__libc_malloc(size));
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+  return recorded(__libc_calloc(count, size));
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+  const size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+  void* result = __libc_realloc(ptr, size);
+  // On failure the old block is left untouched, unless size was 0
+  if (result || size == 0) {
+    if (ptr) recordDeallocation(oldSize);
+    recorded(result);
+  }
+  return result;
+}
+
+void* memalign(size_t alignment, size_t size) noexcept {
+  return recorded(__libc_memalign(alignment, size));
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+  return recorded(__libc_memalign(alignment, size));
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept {
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+    return EINVAL;
+  void* result = __libc_memalign(alignment, size);
+  if (!result) return ENOMEM;
+  *ptr = recorded(result);
+  return 0;
+}
+
+void* valloc(size_t size) noexcept {
+  return recorded(__libc_valloc(size));
+}
+
+void* pvalloc(size_t size) noexcept {
+  return recorded(__libc_pvalloc(size));
+}
+
+void free(void* ptr) noexcept {
+  if (ptr) recordDeallocation(malloc_usable_size(ptr));
+  __libc_free(ptr);
+}
+
+}  // extern "C"
+
+#else  // __GLIBC__
+
+namespace {
+
+// Every block carries its size in a header that keeps the maximal alignment
+union Header {
+  size_t size;
+  std::max_align_t align;
+};
+
+void* allocate(size_t size) {
+  Header* header = static_cast<Header*>(std::malloc(sizeof(Header) + size));
+  if (!header) return nullptr;
+  header->size = size;
+  recordAllocation(size);
+  return header + 1;
+}
+
+void deallocate(void* ptr) {
+  if (!ptr) return;
+  Header* header = static_cast<Header*>(ptr) - 1;
+  recordDeallocation(header->size);
+  std::free(header);
+}
+
+void* allocateOrThrow(size_t size) {
+  for (;;) {
+    if (void* ptr = allocate(size)) return ptr;
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+
+#endif  // __GLIBC__
+
+#endif  // GTSAM_ENABLE_ALLOCATION_TRACKING
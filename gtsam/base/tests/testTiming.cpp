@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testTiming.cpp
+ * @date October 2026
+ * @brief unit tests for the memory profile of the timing library
+ */
+
+#include <gtsam/base/Matrix.h>
+#include <gtsam/base/timing.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace std;
+using namespace gtsam;
+
+// Without the allocation hooks, tic and toc skip the bookkeeping that
+// attributes allocations to sections, so there is nothing to test
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+
+/* ************************************************************************* */
+// Allocations are attributed to the innermost section, and the peak heap
+// growth of a section includes that of its children.
+TEST(Timing, recordAllocation) {
+  tictoc_reset_();
+  {
+    gttic_(outer);
+    internal::recordAllocation(1000);
+    {
+      gttic_(inner);
+      internal::recordAllocation(500);
+      internal::recordDeallocation(500);
+    }
+    tictoc_getNode(inner, inner);
+    internal::recordDeallocation(1000);
+
+    EXPECT(inner->allocations() >= 1);
+    EXPECT(inner->bytesAllocated() >= 500);
+    EXPECT(inner->bytesFreed() >= 500);
+    EXPECT(inner->peakGrowth() >= 500);
+  }
+  tictoc_getNode(outer, outer);
+  EXPECT(outer->bytesAllocated() >= 1000);
+  EXPECT(outer->bytesFreed() >= 1000);
+  EXPECT(outer->peakGrowth() >= 1500);
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+// Allocations on other threads are not attributed to the sections, and may go
+// on while the sections are reset
+TEST(Timing, otherThread) {
+  tictoc_reset_();
+  std::atomic<bool> done(false);
+  std::thread worker([&done] {
+    while (!done) {
+      internal::recordAllocation(1000000);
+      internal::recordDeallocation(1000000);
+    }
+  });
+  for (size_t i = 0; i < 100; ++i) tictoc_reset_();
+  {
+    gttic_(main);
+    for (size_t i = 0; i < 100; ++i) std::this_thread::yield();
+  }
+  done = true;
+  worker.join();
+  tictoc_getNode(main, main);
+  EXPECT(main->bytesAllocated() < 1000000);
+  tictoc_reset_();
+}
+
+#ifdef __GLIBC__
+/* ************************************************************************* */
+// The hooks see Eigen's dynamic matrices, which use std::malloc, only where
+// the malloc family is wrapped
+TEST(Timing, trackedMatrix) {
+  tictoc_reset_();
+  {
+    gttic_(matrix);
+    Matrix A = Matrix::Zero(1000, 1000);
+    EXPECT_DOUBLES_EQUAL(0.0, A.sum(), 1e-9);
+  }
+  tictoc_getNode(matrix, matrix);
+  EXPECT(matrix->bytesAllocated() >= 8000000);
+  EXPECT(matrix->bytesFreed() >= 8000000);
+  EXPECT(matrix->peakGrowth() >= 8000000);
+  tictoc_reset_();
+}
+#endif  // __GLIBC__
+#endif
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
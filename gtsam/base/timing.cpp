@@ -22,6 +22,7 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cassert>
@@ -29,6 +30,7 @@
 #include <iostream>
 #include <map>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 namespace gtsam {
@@ -37,6 +39,30 @@ namespace internal {
 GTSAM_EXPORT boost::shared_ptr<TimingOutline> gTimingRoot(
     new TimingOutline("Total", getTicTocID("Total")));
 GTSAM_EXPORT boost::weak_ptr<TimingOutline> gCurrentTimer(gTimingRoot);
+GTSAM_EXPORT std::atomic<TimingOutline*> gCurrentOutline(gTimingRoot.get());
+
+// The thread that last entered or left a section, the only one whose
+// allocations are attributed to gCurrentOutline. A thread id rather than a
+// thread_local, as the allocation hooks must not allocate, which the first
+// access to a thread_local in a dynamically loaded library may do.
+static std::atomic<std::thread::id> gTimingThread(std::this_thread::get_id());
+
+// resetTiming sets gResetting and waits until no hook uses a section
+static std::atomic<bool> gResetting(false);
+static std::atomic<int> gHooksInProgress(0);
+
+// Signed, as memory allocated before the hooks were active may be freed later
+static std::atomic<long long> gLiveBytes(0);
+
+/* ************************************************************************* */
+// Raise an atomic maximum to value
+static void updateMax(std::atomic<long long>& maximum, long long value) {
+  long long current = maximum.load(std::memory_order_relaxed);
+  while (value > current &&
+         !maximum.compare_exchange_weak(current, value,
+                                        std::memory_order_relaxed)) {
+  }
+}
 
 /* ************************************************************************* */
 // Implementation of TimingOutline
@@ -55,12 +81,20 @@ void TimingOutline::add(size_t usecs, size_t usecsWall) {
 /* ************************************************************************* */
 TimingOutline::TimingOutline(const std::string& label, size_t id) :
     id_(id), t_(0), tWall_(0), t2_(0.0), tIt_(0), tMax_(0), tMin_(0), n_(0), myOrder_(
-        0), lastChildOrder_(0), label_(label) {
+        0), lastChildOrder_(0), label_(label), allocations_(0), bytesAllocated_(0),
+        bytesFreed_(0), peakLive_(0), liveAtTic_(0), peakGrowth_(0) {
 #ifdef GTSAM_USING_NEW_BOOST_TIMERS
   timer_.stop();
 #endif
 }
 
+/* ************************************************************************* */
+TimingOutline::~TimingOutline() {
+  // Make sure the allocation hooks never see a destroyed section
+  TimingOutline* self = this;
+  gCurrentOutline.compare_exchange_strong(self, nullptr);
+}
+
 /* ************************************************************************* */
 size_t TimingOutline::time() const {
   size_t time = 0;
@@ -82,6 +116,10 @@ void TimingOutline::print(const std::string& outline) const {
   std::cout << outline << "-" << formattedLabel << ": " << self() << " CPU ("
       << n_ << " times, " << wall() << " wall, " << secs() << " children, min: "
       << min() << " max: " << max() << ")\n";
+  if (allocations_ > 0)
+    std::cout << outline << "|   heap: " << allocations_ << " allocations, "
+        << bytesAllocated_ / 1048576.0 << " MB allocated, " << bytesFreed_ / 1048576.0
+        << " MB freed, peak growth " << peakGrowth_ / 1048576.0 << " MB\n";
   // Order children
   typedef FastMap<size_t, boost::shared_ptr<TimingOutline> > ChildOrder;
   ChildOrder childOrder;
@@ -169,6 +207,11 @@ void TimingOutline::tic() {
 #ifdef GTSAM_USE_TBB
   tbbTimer_ = tbb::tick_count::now();
 #endif
+
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+  liveAtTic_ = gLiveBytes.load(std::memory_order_relaxed);
+  peakLive_ = liveAtTic_;
+#endif
 }
 
 /* ************************************************************************* */
@@ -200,6 +243,12 @@ void TimingOutline::toc() {
 #endif
 
   add(cpuTime, wallTime);
+
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+  peakGrowth_ = std::max(peakGrowth_, peakLive_.load() - liveAtTic_);
+  if (boost::shared_ptr<TimingOutline> parent = parent_.lock())
+    updateMax(parent->peakLive_, peakLive_);
+#endif
 }
 
 /* ************************************************************************* */
@@ -239,6 +288,10 @@ void tic(size_t id, const char *labelC) {
   boost::shared_ptr<TimingOutline> node = //
       gCurrentTimer.lock()->child(id, label, gCurrentTimer);
   gCurrentTimer = node;
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+  gCurrentOutline = node.get();
+  gTimingThread = std::this_thread::get_id();
+#endif
   node->tic();
 }
 
@@ -261,6 +314,62 @@ void toc(size_t id, const char *label) {
   }
   current->toc();
   gCurrentTimer = current->parent_;
+#ifdef GTSAM_ENABLE_ALLOCATION_TRACKING
+  gCurrentOutline = current->parent_.lock().get();
+  gTimingThread = std::this_thread::get_id();
+#endif
+}
+
+/* ************************************************************************* */
+void resetTiming() {
+  // Allocations from now on are not attributed, and the sections are only
+  // destroyed once those in progress are done with them
+  gResetting = true;
+  while (gHooksInProgress.load() != 0) std::this_thread::yield();
+  gTimingRoot.reset(new TimingOutline("Total", getTicTocID("Total")));
+  gCurrentTimer = gTimingRoot;
+  gCurrentOutline = gTimingRoot.get();
+  gTimingThread = std::this_thread::get_id();
+  gResetting = false;
+}
+
+/* ************************************************************************* */
+// Call f with the current section if the calling thread is the timing thread,
+// and the sections are not being reset
+template <class F>
+static void withCurrentOutline(F f) {
+  gHooksInProgress.fetch_add(1);
+  if (!gResetting.load() &&
+      gTimingThread.load(std::memory_order_relaxed) ==
+          std::this_thread::get_id()) {
+    if (TimingOutline* current = gCurrentOutline.load(std::memory_order_acquire))
+      f(current);
+  }
+  gHooksInProgress.fetch_sub(1, std::memory_order_release);
+}
+
+/* ************************************************************************* */
+void recordAllocation(size_t bytes) {
+  const long long live =
+      gLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  withCurrentOutline([bytes, live](TimingOutline* current) {
+    current->allocations_.fetch_add(1, std::memory_order_relaxed);
+    current->bytesAllocated_.fetch_add(bytes, std::memory_order_relaxed);
+    updateMax(current->peakLive_, live);
+  });
+}
+
+/* ************************************************************************* */
+void recordDeallocation(size_t bytes) {
+  gLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+  withCurrentOutline([bytes](TimingOutline* current) {
+    current->bytesFreed_.fetch_add(bytes, std::memory_order_relaxed);
+  });
+}
+
+/* ************************************************************************* */
+long long liveBytes() {
+  return gLiveBytes.load(std::memory_order_relaxed);
 }
 
 } // namespace internal
@@ -25,6 +25,7 @@
 #include <boost/smart_ptr/weak_ptr.hpp>
 #include <boost/version.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <string>
 
@@ -105,6 +106,19 @@
 //   too scope.  Note that if you use these, it may become difficult to ensure that you
 //   have matching gttic/gttoc statments.  You may want to consider reorganizing your timing
 //   outline to match the scope of your code.
+//
+// - Memory profiling.  When GTSAM is configured with GTSAM_ENABLE_ALLOCATION_TRACKING, every
+//   heap allocation in the process is attributed to the innermost active timing section, and
+//   tictoc_print() adds the number of allocations, the bytes allocated and freed, and the peak
+//   heap growth of each section to its output.  Combined with the Timing build type, which
+//   enables the gttic sections inside GTSAM, this gives a memory profile of phases such as
+//   NonlinearFactorGraph_linearize, eliminateMultifrontal and LM_iterate.  Only allocations
+//   on the thread that last entered or left a section are attributed to it: those of other
+//   threads, e.g., TBB workers, only count towards the live bytes from which the heap growth
+//   of a section is measured, and no allocation is attributed while tictoc_reset() replaces
+//   the sections.  Note that the allocation hooks replace malloc (with glibc)
+//   or the global operator new (elsewhere) for the whole process, including the application
+//   that links GTSAM, so this option is for profiling builds only.
 
 // Automatically use the new Boost timers if version is recent enough.
 #if BOOST_VERSION >= 104800
@@ -139,6 +153,19 @@ namespace gtsam {
     // Call toc on gCurrentTimer and then set gCurrentTimer to the parent of gCurrentTimer
     GTSAM_EXPORT void toc(size_t id, const char *label);
 
+    // Attribute a heap allocation or deallocation of the given size to the current timing
+    // section. Called by the allocation hooks when GTSAM_ENABLE_ALLOCATION_TRACKING is set,
+    // these must not allocate themselves.
+    GTSAM_EXPORT void recordAllocation(size_t bytes);
+    GTSAM_EXPORT void recordDeallocation(size_t bytes);
+
+    // Replace all sections by a new root, which becomes the current section of the calling
+    // thread. Waits until no allocation hook is using a section before destroying them.
+    GTSAM_EXPORT void resetTiming();
+
+    // Bytes currently allocated, as counted by recordAllocation and recordDeallocation
+    GTSAM_EXPORT long long liveBytes();
+
     /**
      * Timing Entry, arranged in a tree
      */
@@ -156,6 +183,14 @@ namespace gtsam {
       size_t lastChildOrder_;
       std::string label_;
 
+      // Heap usage while this was the current section, see recordAllocation
+      std::atomic<size_t> allocations_;
+      std::atomic<size_t> bytesAllocated_;
+      std::atomic<size_t> bytesFreed_;
+      std::atomic<long long> peakLive_; ///< max live bytes since tic, including children
+      long long liveAtTic_;
+      long long peakGrowth_; ///< max over calls of peakLive_ - liveAtTic_
+
       // Tree structure
       boost::weak_ptr<TimingOutline> parent_; ///< parent pointer
       typedef FastMap<size_t, boost::shared_ptr<TimingOutline> > ChildMap;
@@ -175,6 +210,7 @@ namespace gtsam {
     public:
       /// Constructor
       GTSAM_EXPORT TimingOutline(const std::string& label, size_t myId);
+      GTSAM_EXPORT ~TimingOutline();
       GTSAM_EXPORT size_t time() const; ///< time taken, including children
       double secs() const { return double(time()) / 1000000.0;} ///< time taken, in seconds, including children
       double self() const { return double(t_)     / 1000000.0;} ///< self time only, in seconds
@@ -182,6 +218,10 @@ namespace gtsam {
       double min()  const { return double(tMin_)  / 1000000.0;} ///< min time, in seconds
       double max()  const { return double(tMax_)  / 1000000.0;} ///< max time, in seconds
       double mean() const { return self() / double(n_); } ///< mean self time, in seconds
+      size_t allocations() const { return allocations_; } ///< heap allocations, self only
+      size_t bytesAllocated() const { return bytesAllocated_; } ///< bytes allocated, self only
+      size_t bytesFreed() const { return bytesFreed_; } ///< bytes freed, self only
+      long long peakGrowth() const { return peakGrowth_; } ///< max heap growth in one call, including children
       GTSAM_EXPORT void print(const std::string& outline = "") const;
       GTSAM_EXPORT void print2(const std::string& outline = "", const double parentTotal = -1.0) const;
       GTSAM_EXPORT const boost::shared_ptr<TimingOutline>&
@@ -191,6 +231,8 @@ namespace gtsam {
       GTSAM_EXPORT void finishedIteration();
 
       GTSAM_EXPORT friend void toc(size_t id, const char *label);
+      GTSAM_EXPORT friend void recordAllocation(size_t bytes);
+      GTSAM_EXPORT friend void recordDeallocation(size_t bytes);
     }; // \TimingOutline
 
     /**
@@ -218,6 +260,9 @@ namespace gtsam {
 
     GTSAM_EXTERN_EXPORT boost::shared_ptr<TimingOutline> gTimingRoot;
     GTSAM_EXTERN_EXPORT boost::weak_ptr<TimingOutline> gCurrentTimer;
+    // Raw pointer to gCurrentTimer, for use by the allocation hooks on the thread that
+    // runs the sections
+    GTSAM_EXTERN_EXPORT std::atomic<TimingOutline*> gCurrentOutline;
   }
 
 // Tic and toc functions that are always active (whether or not ENABLE_TIMING is defined)
@@ -265,8 +310,7 @@ inline void tictoc_print2_() {
 
 // reset
 inline void tictoc_reset_() {
-  ::gtsam::internal::gTimingRoot.reset(new ::gtsam::internal::TimingOutline("Total", ::gtsam::internal::getTicTocID("Total")));
-  ::gtsam::internal::gCurrentTimer = ::gtsam::internal::gTimingRoot; }
+  ::gtsam::internal::resetTiming(); }
 
 #ifdef ENABLE_TIMING
 #define gttic(label) gttic_(label)
@@ -21,6 +21,7 @@
 
 #include <gtsam/discrete/DecisionTree.h>
 #include <gtsam/base/Testable.h>
+#include <gtsam/config.h>
 
 #include <boost/format.hpp>
 #include <boost/optional.hpp>
@@ -29,7 +30,10 @@
 using boost::assign::operator+=;
 #include <boost/unordered_set.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/weak_ptr.hpp>
 
+#include <cstdint>
 #include <list>
 #include <cmath>
 #include <fstream>
@@ -37,6 +41,85 @@ using boost::assign::operator+=;
 
 namespace gtsam {
 
+#ifdef GTSAM_DT_HASH_CONSING
+  namespace internal {
+  /**
+   * Unique table of immutable nodes of type NODE, used to hash-cons decision
+   * tree nodes: an open-addressing hash table of weak pointers, so the table
+   * never keeps a node alive and looking up or inserting a node does not
+   * allocate. Slots of expired nodes are reused, and dropped on rehashing.
+   */
+  template <class NODE>
+  class UniqueTable {
+   public:
+    typedef boost::shared_ptr<const NODE> Ptr;
+
+    /**
+     * Return a live node with the given hash for which same(node) is true,
+     * or else insert and return the node made by create().
+     */
+    template <class SAME, class CREATE>
+    Ptr findOrInsert(size_t hash, const SAME& same, const CREATE& create) {
+      if (2 * (used_ + 1) > slots_.size()) rehash();
+      Slot* free = nullptr;
+      for (size_t i = index(hash);; i = (i + 1) & (slots_.size() - 1)) {
+        Slot& slot = slots_[i];
+        if (!slot.used) {
+          if (!free) free = &slot;
+          break;  // end of the probe sequence
+        }
+        if (slot.hash == hash) {
+          Ptr node = slot.node.lock();
+          if (node && same(*node)) return node;
+        }
+        if (!free && slot.node.expired()) free = &slot;
+      }
+      Ptr node = create();
+      if (!free->used) used_++;
+      free->used = true;
+      free->hash = hash;
+      free->node = node;
+      return node;
+    }
+
+   private:
+    struct Slot {
+      bool used;
+      size_t hash;
+      boost::weak_ptr<const NODE> node;
+    };
+
+    std::vector<Slot> slots_;
+    size_t used_ = 0;  ///< number of slots ever used since the last rehash
+    int bits_ = 0;     ///< slots_.size() == 1 << bits_
+
+    /// Fibonacci hashing, as pointers and small integers hash poorly
+    size_t index(size_t hash) const {
+      return (uint64_t(hash) * 11400714819323198485ull) >> (64 - bits_);
+    }
+
+    /// Drop expired nodes, and grow to at least four times the live ones
+    void rehash() {
+      std::vector<Slot> old;
+      old.swap(slots_);
+      size_t live = 0;
+      for (const Slot& slot : old)
+        if (slot.used && !slot.node.expired()) live++;
+      for (bits_ = 12; (size_t(1) << bits_) < 4 * live;) bits_++;
+      slots_.assign(size_t(1) << bits_, Slot{false, 0, {}});
+      used_ = 0;
+      for (Slot& slot : old) {
+        if (!slot.used || slot.node.expired()) continue;
+        size_t i = index(slot.hash);
+        while (slots_[i].used) i = (i + 1) & (slots_.size() - 1);
+        slots_[i] = std::move(slot);
+        used_++;
+      }
+    }
+  };
+  }  // namespace internal
+#endif
+
   /*********************************************************************************/
   // Node
   /*********************************************************************************/
@@ -60,6 +143,24 @@ namespace gtsam {
     Leaf(const Y& constant) :
       constant_(constant) {}
 
+    /**
+     * A leaf with the given constant: with GTSAM_DT_HASH_CONSING the unique
+     * one in this thread, otherwise a new one.
+     */
+    static NodePtr Unique(const Y& constant) {
+#ifdef GTSAM_DT_HASH_CONSING
+      // Values not equal to themselves, i.e., NaN, would only pile up
+      if (!(constant == constant)) return boost::make_shared<const Leaf>(constant);
+      static thread_local internal::UniqueTable<Leaf> table;
+      return table.findOrInsert(
+          boost::hash<Y>()(constant),
+          [&](const Leaf& leaf) { return leaf.constant_ == constant; },
+          [&]() { return boost::make_shared<const Leaf>(constant); });
+#else
+      return boost::make_shared<const Leaf>(constant);
+#endif
+    }
+
     /** return the constant */
     const Y& constant() const {
       return constant_;
@@ -102,8 +203,7 @@ namespace gtsam {
 
     /** apply unary operator */
     NodePtr apply(const Unary& op) const override {
-      NodePtr f(new Leaf(op(constant_)));
-      return f;
+      return Unique(op(constant_));
     }
 
     // Apply binary operator "h = f op g" on Leaf node
@@ -117,8 +217,7 @@ namespace gtsam {
 
     // Applying binary operator to two leaves results in a leaf
     NodePtr apply_g_op_fL(const Leaf& fL, const Binary& op) const override {
-      NodePtr h(new Leaf(op(fL.constant_, constant_))); // fL op gL
-      return h;
+      return Unique(op(fL.constant_, constant_)); // fL op gL
     }
 
     // If second argument is a Choice node, call it's apply with leaf as second
@@ -126,9 +225,9 @@ namespace gtsam {
       return fC.apply_fC_op_gL(*this, op); // operand order back to normal
     }
 
-    /** choose a branch, create new memory ! */
+    /** choose a branch: leaves are shared */
     NodePtr choose(const L& label, size_t index) const override {
-      return NodePtr(new Leaf(constant()));
+      return Unique(constant());
     }
 
     bool isLeaf() const override { return true; }
@@ -161,18 +260,33 @@ namespace gtsam {
 #endif
     }
 
-    /** If all branches of a choice node f are the same, just return a branch */
+    /**
+     * If all branches of a choice node f are the same, just return a branch.
+     * Otherwise, with GTSAM_DT_HASH_CONSING, return the unique node in this
+     * thread with the same label and branches as f, which is f itself if
+     * there was none yet, and without it just f.
+     */
     static NodePtr Unique(const ChoicePtr& f) {
 #ifndef DT_NO_PRUNING
       if (f->allSame_) {
         assert(f->branches().size() > 0);
-        NodePtr f0 = f->branches_[0];
-        assert(f0->isLeaf());
-        NodePtr newLeaf(new Leaf(boost::dynamic_pointer_cast<const Leaf>(f0)->constant()));
-        return newLeaf;
-      } else
+        return f->branches_[0];
+      }
+#endif
+#ifndef GTSAM_DT_HASH_CONSING
+      return f;
+#else
+      static thread_local internal::UniqueTable<Choice> table;
+      size_t hash = 0;
+      for (const NodePtr& branch : f->branches_)
+        boost::hash_combine(hash, branch.get());
+      return table.findOrInsert(
+          hash,
+          [&](const Choice& other) {
+            return other.label_ == f->label_ && other.branches_ == f->branches_;
+          },
+          [&]() { return f; });
 #endif
-        return f;
     }
 
     bool isLeaf() const override { return false; }
@@ -228,9 +342,9 @@ namespace gtsam {
 
     /** add a branch: TODO merge into constructor */
     void push_back(const NodePtr& node) {
-      // allSame_ is restricted to leaf nodes in a decision tree
+      // with hash-consing, identical subtrees are the same node
       if (allSame_ && !branches_.empty()) {
-        allSame_ = node->sameLeaf(*branches_.back());
+        allSame_ = node == branches_.back() || node->sameLeaf(*branches_.back());
       }
       branches_.push_back(node);
     }
@@ -277,6 +391,7 @@ namespace gtsam {
 
     /** equality up to tolerance */
     bool equals(const Node& q, double tol) const override {
+      if (this == &q) return true;
       const Choice* other = dynamic_cast<const Choice*> (&q);
       if (!other) return false;
       if (this->label_ != other->label_) return false;
@@ -380,7 +495,7 @@ namespace gtsam {
   /*********************************************************************************/
   template<typename L, typename Y>
   DecisionTree<L, Y>::DecisionTree(const Y& y)  {
-    root_ = NodePtr(new Leaf(y));
+    root_ = Leaf::Unique(y);
   }
 
   /*********************************************************************************/
@@ -388,9 +503,8 @@ namespace gtsam {
   DecisionTree<L, Y>::DecisionTree(//
       const L& label, const Y& y1, const Y& y2)  {
     boost::shared_ptr<Choice> a(new Choice(label, 2));
-    NodePtr l1(new Leaf(y1)), l2(new Leaf(y2));
-    a->push_back(l1);
-    a->push_back(l2);
+    a->push_back(Leaf::Unique(y1));
+    a->push_back(Leaf::Unique(y2));
     root_ = Choice::Unique(a);
   }
 
@@ -401,9 +515,8 @@ namespace gtsam {
     if (labelC.second != 2) throw std::invalid_argument(
         "DecisionTree: binary constructor called with non-binary label");
     boost::shared_ptr<Choice> a(new Choice(labelC.first, 2));
-    NodePtr l1(new Leaf(y1)), l2(new Leaf(y2));
-    a->push_back(l1);
-    a->push_back(l2);
+    a->push_back(Leaf::Unique(y1));
+    a->push_back(Leaf::Unique(y2));
     root_ = Choice::Unique(a);
   }
 
@@ -547,7 +660,7 @@ namespace gtsam {
       }
       boost::shared_ptr<Choice> choice(new Choice(begin->first, endY - beginY));
       for (ValueIt y = beginY; y != endY; y++)
-        choice->push_back(NodePtr(new Leaf(*y)));
+        choice->push_back(Leaf::Unique(*y));
       return Choice::Unique(choice);
     }
 
@@ -579,7 +692,7 @@ namespace gtsam {
     // ugliness below because apparently we can't have templated virtual functions
     // If leaf, apply unary conversion "op" and create a unique leaf
     const MXLeaf* leaf = dynamic_cast<const MXLeaf*> (f.get());
-    if (leaf) return NodePtr(new Leaf(op(leaf->constant())));
+    if (leaf) return Leaf::Unique(op(leaf->constant()));
 
     // Check if Choice
     boost::shared_ptr<const MXChoice> choice = boost::dynamic_pointer_cast<const MXChoice> (f);
@@ -622,7 +735,8 @@ namespace gtsam {
 
   template<typename L, typename Y>
   DecisionTree<L, Y> DecisionTree<L, Y>::apply(const Unary& op) const {
-    return DecisionTree(root_->apply(op));
+    UnaryCache cache;
+    return DecisionTree(Apply(root_, op, &cache));
   }
 
   /*********************************************************************************/
@@ -630,12 +744,125 @@ namespace gtsam {
   DecisionTree<L, Y> DecisionTree<L, Y>::apply(const DecisionTree& g,
       const Binary& op) const {
     // apply the operaton on the root of both diagrams
-    NodePtr h = root_->apply_f_op_g(*g.root_, op);
+    BinaryCache cache;
+    NodePtr h = Apply(root_, g.root_, op, &cache);
     // create a new class with the resulting root "h"
     DecisionTree result(h);
     return result;
   }
 
+  /*********************************************************************************/
+  // The recursions below visit every shared node (or pair of nodes) once: the
+  // result for each is kept in the cache, which lives for one operation only
+  // as there is no way to tell whether two operators are the same. Only shared
+  // nodes, which can be reached through several paths, are cached.
+  template<typename L, typename Y>
+  typename DecisionTree<L, Y>::NodePtr DecisionTree<L, Y>::Apply(
+      const NodePtr& f, const Unary& op, UnaryCache* cache) {
+    if (f->isLeaf())
+      return Leaf::Unique(op(static_cast<const Leaf&>(*f).constant()));
+    const bool shared = f.use_count() > 1;
+    if (shared) {
+      auto it = cache->find(f.get());
+      if (it != cache->end()) return it->second;
+    }
+    const Choice& choice = static_cast<const Choice&>(*f);
+    auto r = boost::make_shared<Choice>(choice.label(), choice.nrChoices());
+    for (const NodePtr& branch : choice.branches())
+      r->push_back(Apply(branch, op, cache));
+    NodePtr h = Choice::Unique(r);
+    if (shared) cache->emplace(f.get(), h);
+    return h;
+  }
+
+  /*********************************************************************************/
+  template<typename L, typename Y>
+  typename DecisionTree<L, Y>::NodePtr DecisionTree<L, Y>::Apply(
+      const NodePtr& f, const NodePtr& g, const Binary& op,
+      BinaryCache* cache) {
+    const bool fL = f->isLeaf(), gL = g->isLeaf();
+    if (fL && gL)
+      return Leaf::Unique(op(static_cast<const Leaf&>(*f).constant(),
+                             static_cast<const Leaf&>(*g).constant()));
+
+    const auto key = std::make_pair(f.get(), g.get());
+    const bool shared = f.use_count() > 1 || g.use_count() > 1;
+    if (shared) {
+      auto it = cache->find(key);
+      if (it != cache->end()) return it->second;
+    }
+
+    // Split on the highest label, leaves being lower than any label
+    const Choice* fC = static_cast<const Choice*>(fL ? nullptr : f.get());
+    const Choice* gC = static_cast<const Choice*>(gL ? nullptr : g.get());
+    boost::shared_ptr<Choice> h;
+    if (fC && (!gC || fC->label() > gC->label())) {
+      h = boost::make_shared<Choice>(fC->label(), fC->nrChoices());
+      for (const NodePtr& branch : fC->branches())
+        h->push_back(Apply(branch, g, op, cache));
+    } else if (!fC || gC->label() > fC->label()) {
+      h = boost::make_shared<Choice>(gC->label(), gC->nrChoices());
+      for (const NodePtr& branch : gC->branches())
+        h->push_back(Apply(f, branch, op, cache));
+    } else {
+      h = boost::make_shared<Choice>(fC->label(), fC->nrChoices());
+      for (size_t i = 0; i < fC->nrChoices(); i++)
+        h->push_back(Apply(fC->branches()[i], gC->branches()[i], op, cache));
+    }
+    NodePtr result = Choice::Unique(h);
+    if (shared) cache->emplace(key, result);
+    return result;
+  }
+
+  /*********************************************************************************/
+  template<typename L, typename Y>
+  typename DecisionTree<L, Y>::NodePtr DecisionTree<L, Y>::Choose(
+      const NodePtr& f, const L& label, size_t index, UnaryCache* cache) {
+    // As the highest label is always the root, there is no branch on label
+    // below a leaf or a choice on a lower label
+    if (f->isLeaf()) return f;
+    const Choice* choice = static_cast<const Choice*>(f.get());
+    if (label > choice->label()) return f;
+    if (choice->label() == label) return choice->branches()[index];
+    const bool shared = f.use_count() > 1;
+    if (shared) {
+      auto it = cache->find(f.get());
+      if (it != cache->end()) return it->second;
+    }
+    auto r = boost::make_shared<Choice>(choice->label(), choice->nrChoices());
+    for (const NodePtr& branch : choice->branches())
+      r->push_back(Choose(branch, label, index, cache));
+    NodePtr h = Choice::Unique(r);
+    if (shared) cache->emplace(f.get(), h);
+    return h;
+  }
+
+  /*********************************************************************************/
+  template<typename L, typename Y>
+  void DecisionTree<L, Y>::VisitWith(const NodePtr& f,
+      Assignment<L>* assignment,
+      const boost::function<void(const Assignment<L>&, const Y&)>& visit) {
+    if (f->isLeaf()) {
+      visit(*assignment, static_cast<const Leaf*>(f.get())->constant());
+      return;
+    }
+    const Choice* choice = static_cast<const Choice*>(f.get());
+    for (size_t i = 0; i < choice->nrChoices(); i++) {
+      (*assignment)[choice->label()] = i;
+      VisitWith(choice->branches()[i], assignment, visit);
+    }
+    assignment->erase(choice->label());
+  }
+
+  /*********************************************************************************/
+  template<typename L, typename Y>
+  void DecisionTree<L, Y>::CollectNodes(const NodePtr& f,
+      std::unordered_set<const Node*>* nodes) {
+    if (!nodes->insert(f.get()).second || f->isLeaf()) return;
+    for (const NodePtr& branch : static_cast<const Choice*>(f.get())->branches())
+      CollectNodes(branch, nodes);
+  }
+
   /*********************************************************************************/
   // The way this works:
   // We have an ADT, picture it as a tree.
@@ -21,9 +21,13 @@
 
 #include <gtsam/discrete/Assignment.h>
 #include <boost/function.hpp>
+#include <boost/functional/hash.hpp>
 #include <iostream>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 namespace gtsam {
 
@@ -31,6 +35,18 @@ namespace gtsam {
    * Decision Tree
    * L = label for variables
    * Y = function range (any algebra), e.g., bool, int, double
+   *
+   * Nodes are immutable, and trees are DAGs that may share subtrees. The
+   * operations below memoize their results per (pair of) shared nodes, so
+   * they take time proportional to the size of the DAG rather than of the
+   * tree it represents.
+   *
+   * When GTSAM is configured with GTSAM_DT_HASH_CONSING, nodes are also
+   * hash-consed, as in a BDD: every thread keeps a table of the live nodes it
+   * created, so equal leaves and Choice nodes with the same label and branches
+   * exist only once. This pays off for tables with few distinct values, e.g.,
+   * constraints, but costs about 30% for tables with little to share, and
+   * requires Y to be hashable by boost::hash and comparable with ==.
    */
   template<typename L, typename Y>
   class DecisionTree {
@@ -109,6 +125,24 @@ namespace gtsam {
     convert(const typename DecisionTree<M, X>::NodePtr& f, const std::map<M,
         L>& map, boost::function<Y(const X&)> op);
 
+    /** Results of an operation on nodes, valid while the operation runs */
+    typedef std::unordered_map<const Node*, NodePtr> UnaryCache;
+    typedef std::unordered_map<std::pair<const Node*, const Node*>, NodePtr,
+        boost::hash<std::pair<const Node*, const Node*> > > BinaryCache;
+
+    /** Memoized recursive implementations of apply and choose */
+    static NodePtr Apply(const NodePtr& f, const Unary& op, UnaryCache* cache);
+    static NodePtr Apply(const NodePtr& f, const NodePtr& g, const Binary& op,
+        BinaryCache* cache);
+    static NodePtr Choose(const NodePtr& f, const L& label, size_t index,
+        UnaryCache* cache);
+
+    /** Recursive implementations of visitWith and nrNodes */
+    static void VisitWith(const NodePtr& f, Assignment<L>* assignment,
+        const boost::function<void(const Assignment<L>&, const Y&)>& visit);
+    static void CollectNodes(const NodePtr& f,
+        std::unordered_set<const Node*>* nodes);
+
     /** Default constructor */
     DecisionTree();
 
@@ -178,8 +212,8 @@ namespace gtsam {
     /** create a new function where value(label)==index
      * It's like "restrict" in Darwiche09book pg329, 330? */
     DecisionTree choose(const L& label, size_t index) const {
-      NodePtr newRoot = root_->choose(label, index);
-      return DecisionTree(newRoot);
+      UnaryCache cache;
+      return DecisionTree(Choose(root_, label, index, &cache));
     }
 
     /** combine subtrees on key with binary operation "op" */
@@ -190,6 +224,23 @@ namespace gtsam {
       return combine(labelC.first, labelC.second, op);
     }
 
+    /**
+     * Call visit with the value of every leaf and the partial assignment of
+     * the labels on the path to it. Labels not in the assignment are free.
+     */
+    void visitWith(const boost::function<void(const Assignment<L>&, const Y&)>&
+        visit) const {
+      Assignment<L> assignment;
+      VisitWith(root_, &assignment, visit);
+    }
+
+    /** number of distinct nodes, i.e., the size of the DAG */
+    size_t nrNodes() const {
+      std::unordered_set<const Node*> nodes;
+      CollectNodes(root_, &nodes);
+      return nodes.size();
+    }
+
     /** output to graphviz format, stream version */
     void dot(std::ostream& os, bool showZero = true) const;
 
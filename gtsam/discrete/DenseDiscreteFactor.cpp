@@ -0,0 +1,457 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    DenseDiscreteFactor.cpp
+ * @brief   Discrete factor stored as a dense table
+ * @date    October 2026
+ */
+
+#include <gtsam/discrete/DenseDiscreteFactor.h>
+
+#include <boost/format.hpp>
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+typedef Eigen::ArrayXd Array;
+
+// Binary operations on blocks, which may be segments or constants
+struct Multiply {
+  template <class A, class B>
+  auto operator()(const A& a, const B& b) const -> decltype(a * b) {
+    return a * b;
+  }
+};
+struct Add {
+  template <class A, class B>
+  auto operator()(const A& a, const B& b) const -> decltype(a + b) {
+    return a + b;
+  }
+};
+struct Subtract {
+  template <class A, class B>
+  auto operator()(const A& a, const B& b) const -> decltype(a - b) {
+    return a - b;
+  }
+};
+// As Potentials::safe_div, zero if either is zero
+struct SafeDivide {
+  template <class A, class B>
+  Array operator()(const A& a, const B& b) const {
+    return (a == 0.0 || b == 0.0).select(0.0, a / b);
+  }
+};
+
+size_t tableSize(const DiscreteKeys& keys) {
+  size_t n = 1;
+  for (const DiscreteKey& key : keys) n *= key.second;
+  return n;
+}
+
+// Sorted union of the keys, as in DecisionTreeFactor::apply
+DiscreteKeys sortedUnion(const DiscreteKeys& a, const DiscreteKeys& b) {
+  map<Key, size_t> cs;
+  for (const DiscreteKey& key : a) cs[key.first] = key.second;
+  for (const DiscreteKey& key : b) cs[key.first] = key.second;
+  DiscreteKeys keys;
+  for (const auto& key : cs) keys.push_back(key);
+  return keys;
+}
+
+// Strides in f of the given keys, zero for keys f does not involve
+vector<size_t> stridesIn(const DiscreteKeys& keys,
+                         const DenseDiscreteFactor& f) {
+  vector<size_t> strides(keys.size(), 0);
+  const DiscreteKeys& fKeys = f.discreteKeys();
+  size_t stride = 1;
+  for (size_t i = fKeys.size(); i-- > 0;) {
+    for (size_t k = 0; k < keys.size(); k++)
+      if (keys[k].first == fKeys[i].first) strides[k] = stride;
+    stride *= fKeys[i].second;
+  }
+  return strides;
+}
+
+/*
+ * Compute op(a, b) on the table with the given keys, where a and b have the
+ * given strides, zero for keys they do not involve. The innermost keys on
+ * which both are either contiguous or constant form a block that is computed
+ * with one vectorized expression; an odometer loops over the outer keys.
+ */
+template <class OP>
+Vector broadcast(const DiscreteKeys& keys, const Vector& a,
+                 const vector<size_t>& sa, const Vector& b,
+                 const vector<size_t>& sb, const OP& op) {
+  const size_t n = keys.size();
+  Vector result(tableSize(keys));
+
+  size_t m = n, block = 1;
+  bool aSegment = true, aConstant = true, bSegment = true, bConstant = true;
+  while (m > 0) {
+    const size_t k = m - 1;
+    const bool as = aSegment && sa[k] == block, ac = aConstant && sa[k] == 0;
+    const bool bs = bSegment && sb[k] == block, bc = bConstant && sb[k] == 0;
+    if (!(as || ac) || !(bs || bc)) break;
+    aSegment = as, aConstant = ac, bSegment = bs, bConstant = bc;
+    block *= keys[k].second;
+    m = k;
+  }
+
+  vector<size_t> index(m, 0);
+  size_t offsetA = 0, offsetB = 0;
+  for (size_t offset = 0; offset < size_t(result.size()); offset += block) {
+    auto out = result.array().segment(offset, block);
+    if (aSegment && bSegment)
+      out = op(a.array().segment(offsetA, block),
+               b.array().segment(offsetB, block));
+    else if (aSegment)
+      out = op(a.array().segment(offsetA, block),
+               Array::Constant(block, b(offsetB)));
+    else if (bSegment)
+      out = op(Array::Constant(block, a(offsetA)),
+               b.array().segment(offsetB, block));
+    else
+      out = op(Array::Constant(block, a(offsetA)),
+               Array::Constant(block, b(offsetB)));
+
+    for (size_t k = m; k-- > 0;) {
+      offsetA += sa[k], offsetB += sb[k];
+      if (++index[k] < keys[k].second) break;
+      offsetA -= sa[k] * index[k], offsetB -= sb[k] * index[k];
+      index[k] = 0;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+/* ************************************************************************* */
+DenseDiscreteFactor::DenseDiscreteFactor() : table_(Vector::Ones(1)) {}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::DenseDiscreteFactor(const DiscreteKeys& keys,
+                                         const Vector& table)
+    : DiscreteFactor(keys.indices()), table_(table) {
+  initialize(keys);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::DenseDiscreteFactor(const DiscreteKeys& keys,
+                                         const vector<double>& table)
+    : DiscreteFactor(keys.indices()),
+      table_(Eigen::Map<const Vector>(table.data(), table.size())) {
+  initialize(keys);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::DenseDiscreteFactor(const DiscreteKeys& keys,
+                                         const string& table)
+    : DiscreteFactor(keys.indices()) {
+  istringstream iss(table);
+  vector<double> values;
+  double x;
+  while (iss >> x) values.push_back(x);
+  table_ = Eigen::Map<const Vector>(values.data(), values.size());
+  initialize(keys);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::DenseDiscreteFactor(const DecisionTreeFactor& f)
+    : DiscreteFactor(f.keys()) {
+  DiscreteKeys keys;
+  for (Key j : f.keys()) keys.push_back(DiscreteKey(j, f.cardinality(j)));
+  table_.resize(tableSize(keys));
+  initialize(keys);
+
+  // Every leaf fills the block of the keys not on its path
+  const size_t n = keys.size();
+  f.visitWith([&](const Assignment<Key>& assignment, const double& value) {
+    size_t offset = 0;
+    vector<size_t> free;
+    for (size_t k = 0; k < n; k++) {
+      auto it = assignment.find(keys[k].first);
+      if (it != assignment.end())
+        offset += strides_[k] * it->second;
+      else
+        free.push_back(k);
+    }
+    vector<size_t> index(free.size(), 0);
+    while (true) {
+      table_(offset) = value;
+      size_t i = free.size();
+      while (i-- > 0) {
+        const size_t k = free[i];
+        offset += strides_[k];
+        if (++index[i] < keys[k].second) break;
+        offset -= strides_[k] * index[i];
+        index[i] = 0;
+      }
+      if (i == size_t(-1)) break;
+    }
+  });
+}
+
+/* ************************************************************************* */
+void DenseDiscreteFactor::initialize(const DiscreteKeys& keys) {
+  discreteKeys_ = keys;
+  strides_.resize(keys.size());
+  size_t stride = 1;
+  for (size_t k = keys.size(); k-- > 0;) {
+    strides_[k] = stride;
+    stride *= keys[k].second;
+  }
+  if (size_t(table_.size()) != stride)
+    throw invalid_argument(
+        (boost::format("DenseDiscreteFactor: table has %d entries, keys "
+                       "require %d") % table_.size() % stride).str());
+}
+
+/* ************************************************************************* */
+size_t DenseDiscreteFactor::cardinality(Key j) const {
+  for (const DiscreteKey& key : discreteKeys_)
+    if (key.first == j) return key.second;
+  throw invalid_argument("DenseDiscreteFactor::cardinality: invalid key");
+}
+
+/* ************************************************************************* */
+bool DenseDiscreteFactor::equals(const DiscreteFactor& other,
+                                 double tol) const {
+  const DenseDiscreteFactor* f =
+      dynamic_cast<const DenseDiscreteFactor*>(&other);
+  return f && discreteKeys_ == f->discreteKeys_ &&
+         equal_with_abs_tol(table_, f->table_, tol);
+}
+
+/* ************************************************************************* */
+void DenseDiscreteFactor::print(const string& s,
+                                const KeyFormatter& formatter) const {
+  cout << s;
+  for (const DiscreteKey& key : discreteKeys_)
+    cout << formatter(key.first) << "(" << key.second << ") ";
+  cout << "\n" << table_.transpose() << endl;
+}
+
+/* ************************************************************************* */
+double DenseDiscreteFactor::operator()(const Values& values) const {
+  size_t offset = 0;
+  for (size_t k = 0; k < discreteKeys_.size(); k++)
+    offset += strides_[k] * values.at(discreteKeys_[k].first);
+  return table_(offset);
+}
+
+/* ************************************************************************* */
+DecisionTreeFactor DenseDiscreteFactor::operator*(
+    const DecisionTreeFactor& f) const {
+  return toDecisionTreeFactor() * f;
+}
+
+/* ************************************************************************* */
+DecisionTreeFactor DenseDiscreteFactor::toDecisionTreeFactor() const {
+  if (discreteKeys_.empty())
+    return DecisionTreeFactor(discreteKeys_, Potentials::ADT(table_(0)));
+
+  // Decision trees have the highest label at the root, and are created much
+  // faster from tables in that order, so transpose the table first
+  const size_t n = discreteKeys_.size();
+  vector<size_t> order(n);
+  for (size_t k = 0; k < n; k++) order[k] = k;
+  sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+    return discreteKeys_[i].first > discreteKeys_[j].first;
+  });
+  DiscreteKeys sorted;
+  for (size_t k : order) sorted.push_back(discreteKeys_[k]);
+  vector<double> values(table_.size());
+  vector<size_t> index(n, 0);
+  size_t offset = 0;
+  for (double& value : values) {
+    value = table_(offset);
+    for (size_t i = n; i-- > 0;) {
+      const size_t k = order[i];
+      offset += strides_[k];
+      if (++index[i] < discreteKeys_[k].second) break;
+      offset -= strides_[k] * index[i];
+      index[i] = 0;
+    }
+  }
+  return DecisionTreeFactor(discreteKeys_, Potentials::ADT(sorted, values));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor DenseDiscreteFactor::operator*(
+    const DenseDiscreteFactor& f) const {
+  const DiscreteKeys keys = sortedUnion(discreteKeys_, f.discreteKeys_);
+  return DenseDiscreteFactor(
+      keys, broadcast(keys, table_, stridesIn(keys, *this), f.table_,
+                      stridesIn(keys, f), Multiply()));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor DenseDiscreteFactor::operator/(
+    const DenseDiscreteFactor& f) const {
+  for (Key j : f.keys())
+    if (find(j) == end())
+      throw invalid_argument(
+          "DenseDiscreteFactor::operator/: divisor has keys not in factor");
+  return DenseDiscreteFactor(
+      discreteKeys_, broadcast(discreteKeys_, table_, strides_, f.table_,
+                               stridesIn(discreteKeys_, f), SafeDivide()));
+}
+
+/* ************************************************************************* */
+vector<bool> DenseDiscreteFactor::frontals(size_t nrFrontals) const {
+  if (nrFrontals > size())
+    throw invalid_argument(
+        (boost::format("DenseDiscreteFactor: invalid number of frontal keys "
+                       "%d, nr.keys=%d") % nrFrontals % size()).str());
+  vector<bool> eliminate(size(), false);
+  fill(eliminate.begin(), eliminate.begin() + nrFrontals, true);
+  return eliminate;
+}
+
+/* ************************************************************************* */
+vector<bool> DenseDiscreteFactor::frontals(const Ordering& keys) const {
+  vector<bool> eliminate(size(), false);
+  for (Key j : keys) {
+    const_iterator it = find(j);
+    if (it == end())
+      throw invalid_argument("DenseDiscreteFactor: frontal key not in factor");
+    eliminate[it - begin()] = true;
+  }
+  return eliminate;
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::reduce(
+    const vector<bool>& eliminate, bool max) const {
+  const size_t n = discreteKeys_.size();
+  DiscreteKeys keys;
+  vector<size_t> outStrides(n, 0);
+  for (size_t k = 0; k < n; k++)
+    if (!eliminate[k]) keys.push_back(discreteKeys_[k]);
+  size_t stride = 1;
+  for (size_t k = n; k-- > 0;)
+    if (!eliminate[k]) outStrides[k] = stride, stride *= discreteKeys_[k].second;
+
+  const double init = max ? -numeric_limits<double>::infinity() : 0.0;
+  Vector result = Vector::Constant(stride, init);
+  if (n == 0) {
+    result = table_;
+    return boost::make_shared<DenseDiscreteFactor>(keys, result);
+  }
+
+  // The innermost keys that are all eliminated or all kept form a block
+  size_t m = n - 1, block = discreteKeys_[n - 1].second;
+  const bool inner = eliminate[n - 1];
+  while (m > 0 && eliminate[m - 1] == inner) block *= discreteKeys_[--m].second;
+
+  vector<size_t> index(m, 0);
+  size_t offset = 0;
+  for (size_t i = 0; i < size_t(table_.size()); i += block) {
+    auto in = table_.array().segment(i, block);
+    if (inner) {
+      double& out = result(offset);
+      out = max ? std::max(out, in.maxCoeff()) : out + in.sum();
+    } else {
+      auto out = result.array().segment(offset, block);
+      if (max)
+        out = out.max(in);
+      else
+        out += in;
+    }
+    for (size_t k = m; k-- > 0;) {
+      offset += outStrides[k];
+      if (++index[k] < discreteKeys_[k].second) break;
+      offset -= outStrides[k] * index[k];
+      index[k] = 0;
+    }
+  }
+  return boost::make_shared<DenseDiscreteFactor>(keys, result);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::sum(
+    size_t nrFrontals) const {
+  return reduce(frontals(nrFrontals), false);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::sum(
+    const Ordering& keys) const {
+  return reduce(frontals(keys), false);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::max(
+    size_t nrFrontals) const {
+  return reduce(frontals(nrFrontals), true);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::max(
+    const Ordering& keys) const {
+  return reduce(frontals(keys), true);
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor DenseDiscreteFactor::log() const {
+  return DenseDiscreteFactor(discreteKeys_, Vector(table_.array().log()));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor DenseDiscreteFactor::exp() const {
+  return DenseDiscreteFactor(discreteKeys_, Vector(table_.array().exp()));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor DenseDiscreteFactor::logProduct(
+    const DenseDiscreteFactor& f) const {
+  const DiscreteKeys keys = sortedUnion(discreteKeys_, f.discreteKeys_);
+  return DenseDiscreteFactor(
+      keys, broadcast(keys, table_, stridesIn(keys, *this), f.table_,
+                      stridesIn(keys, f), Add()));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::logSum(
+    size_t nrFrontals) const {
+  frontals(nrFrontals);  // throws if there are not as many keys
+  return logSum(Ordering(keys_.begin(), keys_.begin() + nrFrontals));
+}
+
+/* ************************************************************************* */
+DenseDiscreteFactor::shared_ptr DenseDiscreteFactor::logSum(
+    const Ordering& keys) const {
+  // log sum exp(x) = M + log sum exp(x - M), with M the maximum, or zero where
+  // all x are -inf, so that nothing overflows
+  shared_ptr shift = max(keys);
+  shift->table_ =
+      shift->table_.array().isInf().select(0.0, shift->table_.array());
+  const Vector shifted =
+      broadcast(discreteKeys_, table_, strides_, shift->table_,
+                stridesIn(discreteKeys_, *shift), Subtract());
+  shared_ptr result = DenseDiscreteFactor(discreteKeys_, shifted).exp().sum(keys);
+  result->table_ = result->table_.array().log() + shift->table_.array();
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    DenseDiscreteFactor.h
+ * @brief   Discrete factor stored as a dense table
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/discrete/DecisionTreeFactor.h>
+#include <gtsam/discrete/DiscreteKey.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/base/Vector.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A discrete factor that stores its values in a dense table, rather than in a
+ * decision tree. The table is laid out as a row-major tensor with one
+ * dimension per key, the first key varying slowest, which is the same order
+ * as the table strings and vectors DecisionTreeFactor is constructed from.
+ *
+ * Decision trees are compact when tables have few distinct values, e.g.,
+ * constraints, but for tables of mostly distinct values, as in chain or grid
+ * models with learned potentials, every operation chases pointers through a
+ * tree with as many leaves as the table has entries. On dense tables,
+ * products, sums and maxima over keys are strided loops over contiguous
+ * blocks that Eigen vectorizes. The log-space variants avoid underflow on
+ * long chains; max works as is in log space.
+ */
+class GTSAM_EXPORT DenseDiscreteFactor : public DiscreteFactor {
+ public:
+  typedef DenseDiscreteFactor This;
+  typedef DiscreteFactor Base;  ///< Typedef to base class
+  typedef boost::shared_ptr<DenseDiscreteFactor> shared_ptr;
+
+ protected:
+  DiscreteKeys discreteKeys_;   ///< keys with cardinalities, in table order
+  std::vector<size_t> strides_; ///< stride of each key in the table
+  Vector table_;                ///< values, first key varying slowest
+
+ public:
+  /// @name Standard Constructors
+  /// @{
+
+  /** Default constructor creates the constant 1, without keys */
+  DenseDiscreteFactor();
+
+  /** Construct from keys and a table with the first key varying slowest */
+  DenseDiscreteFactor(const DiscreteKeys& keys, const Vector& table);
+
+  /** Construct from keys and a table with the first key varying slowest */
+  DenseDiscreteFactor(const DiscreteKeys& keys,
+                      const std::vector<double>& table);
+
+  /** Construct from keys and a string table, as DecisionTreeFactor */
+  DenseDiscreteFactor(const DiscreteKeys& keys, const std::string& table);
+
+  /** Convert a DecisionTreeFactor, keeping its key order */
+  explicit DenseDiscreteFactor(const DecisionTreeFactor& f);
+
+  /// @}
+  /// @name Testable
+  /// @{
+
+  /// equality
+  bool equals(const DiscreteFactor& other, double tol = 1e-9) const override;
+
+  // print
+  void print(const std::string& s = "DenseDiscreteFactor:\n",
+             const KeyFormatter& formatter = DefaultKeyFormatter) const override;
+
+  /// @}
+  /// @name Standard Interface
+  /// @{
+
+  /// Value is just a look up in the table
+  double operator()(const Values& values) const override;
+
+  /// Multiply in a DecisionTreeFactor, as decision trees
+  DecisionTreeFactor operator*(const DecisionTreeFactor& f) const override;
+
+  /// Convert into a decision tree
+  DecisionTreeFactor toDecisionTreeFactor() const override;
+
+  /// Multiply two factors, the result has the sorted union of the keys
+  DenseDiscreteFactor operator*(const DenseDiscreteFactor& f) const;
+
+  /// Divide by factor f (safely), which may only involve keys of this factor
+  DenseDiscreteFactor operator/(const DenseDiscreteFactor& f) const;
+
+  /// Create new factor by summing out the first nrFrontals keys
+  shared_ptr sum(size_t nrFrontals) const;
+
+  /// Create new factor by summing out the given keys
+  shared_ptr sum(const Ordering& keys) const;
+
+  /// Create new factor by maximizing over the first nrFrontals keys
+  shared_ptr max(size_t nrFrontals) const;
+
+  /// Create new factor by maximizing over the given keys
+  shared_ptr max(const Ordering& keys) const;
+
+  /// @}
+  /// @name Log Space
+  /// @{
+
+  /// Elementwise logarithm of the table
+  DenseDiscreteFactor log() const;
+
+  /// Elementwise exponential of the table
+  DenseDiscreteFactor exp() const;
+
+  /// Product in log space, i.e., add the tables
+  DenseDiscreteFactor logProduct(const DenseDiscreteFactor& f) const;
+
+  /// Sum out the first nrFrontals keys in log space, i.e., log-sum-exp
+  shared_ptr logSum(size_t nrFrontals) const;
+
+  /// Sum out the given keys in log space, i.e., log-sum-exp
+  shared_ptr logSum(const Ordering& keys) const;
+
+  /// @}
+  /// @name Advanced Interface
+  /// @{
+
+  /// Keys with their cardinalities, in table order
+  const DiscreteKeys& discreteKeys() const { return discreteKeys_; }
+
+  /// Cardinality of key j, throws if the factor does not involve j
+  size_t cardinality(Key j) const;
+
+  /// The table, first key varying slowest
+  const Vector& table() const { return table_; }
+
+  /// @}
+
+ private:
+  /// Set keys and strides and check the table size
+  void initialize(const DiscreteKeys& keys);
+
+  /// Sum out (or maximize over) the keys for which eliminate is true
+  shared_ptr reduce(const std::vector<bool>& eliminate, bool max) const;
+
+  /// Which keys to eliminate, for the first nrFrontals keys or given keys
+  std::vector<bool> frontals(size_t nrFrontals) const;
+  std::vector<bool> frontals(const Ordering& keys) const;
+};
+
+// traits
+template <>
+struct traits<DenseDiscreteFactor> : public Testable<DenseDiscreteFactor> {};
+
+}  // namespace gtsam
@@ -22,6 +22,9 @@
 #include <gtsam/inference/BayesTreeCliqueBase-inst.h>
 #include <gtsam/discrete/DiscreteBayesTree.h>
 #include <gtsam/discrete/DiscreteBayesNet.h>
+#include <gtsam/base/timing.h>
+
+#include <boost/make_shared.hpp>
 
 namespace gtsam {
 
@@ -55,6 +58,22 @@ namespace gtsam {
     return result;
   }
 
+  /* ************************************************************************* */
+  DiscreteFactor::sharedValues DiscreteBayesTree::optimize() const {
+    gttic(DiscreteBayesTree_optimize);
+    auto result = boost::make_shared<DiscreteFactor::Values>();
+    // Parents are solved before their children
+    std::vector<sharedClique> stack(roots_.rbegin(), roots_.rend());
+    while (!stack.empty()) {
+      const sharedClique clique = stack.back();
+      stack.pop_back();
+      clique->conditional()->solveInPlace(*result);
+      stack.insert(stack.end(), clique->children.rbegin(),
+                   clique->children.rend());
+    }
+    return result;
+  }
+
 } // \namespace gtsam
 
 
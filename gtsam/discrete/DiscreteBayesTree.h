@@ -80,6 +80,12 @@ class GTSAM_EXPORT DiscreteBayesTree
 
   //** evaluate probability for given Values */
   double evaluate(const DiscreteConditional::Values& values) const;
+
+  /**
+   * Solve by back-substitution, from the roots down: the MPE if the tree was
+   * created by max-product elimination, see EliminateForMPE.
+   */
+  DiscreteFactor::sharedValues optimize() const;
 };
 
 }  // namespace gtsam
@@ -61,6 +61,14 @@ DiscreteConditional::DiscreteConditional(const DecisionTreeFactor& joint,
   keys_.insert(keys_.end(), orderedKeys.begin(), orderedKeys.end());
 }
 
+/* ******************************************************************************** */
+DiscreteConditional::DiscreteConditional(const DecisionTreeFactor& conditional,
+    const Ordering& orderedKeys, size_t nrFrontals) :
+    BaseFactor(conditional), BaseConditional(nrFrontals) {
+  keys_.clear();
+  keys_.insert(keys_.end(), orderedKeys.begin(), orderedKeys.end());
+}
+
 /* ******************************************************************************** */
 DiscreteConditional::DiscreteConditional(const Signature& signature)
     : BaseFactor(signature.discreteKeys(), signature.cpt()),
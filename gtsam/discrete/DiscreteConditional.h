@@ -68,6 +68,13 @@ public:
   DiscreteConditional(const DecisionTreeFactor& joint,
       const DecisionTreeFactor& marginal, const Ordering& orderedKeys);
 
+  /**
+   * construct P(X|Y) from a factor that already holds its values, e.g., as
+   * computed by dense tables, with the nrFrontals keys X first in orderedKeys
+   */
+  DiscreteConditional(const DecisionTreeFactor& conditional,
+      const Ordering& orderedKeys, size_t nrFrontals);
+
   /**
    * Combine several conditional into a single one.
    * The conditionals must be given in increasing order, meaning that the parents
@@ -22,6 +22,8 @@
 #include <gtsam/discrete/DiscreteBayesTree.h>
 #include <gtsam/discrete/DiscreteEliminationTree.h>
 #include <gtsam/discrete/DiscreteJunctionTree.h>
+#include <gtsam/discrete/DiscreteLookupTable.h>
+#include <gtsam/discrete/DenseDiscreteFactor.h>
 #include <gtsam/inference/FactorGraph-inst.h>
 #include <gtsam/inference/EliminateableFactorGraph-inst.h>
 #include <boost/make_shared.hpp>
@@ -95,14 +97,22 @@ namespace gtsam {
 
   /* ************************************************************************* */
   DiscreteFactor::sharedValues DiscreteFactorGraph::optimize() const
+  {
+    return optimize(Ordering::Colamd(*this));
+  }
+
+  /* ************************************************************************* */
+  DiscreteFactor::sharedValues DiscreteFactorGraph::optimize(
+      const Ordering& ordering) const
   {
     gttic(DiscreteFactorGraph_optimize);
-    return BaseEliminateable::eliminateSequential()->optimize();
+    return BaseEliminateable::eliminateMultifrontal(ordering, EliminateForMPE)
+        ->optimize();
   }
 
   /* ************************************************************************* */
   std::pair<DiscreteConditional::shared_ptr, DecisionTreeFactor::shared_ptr>  //
-  EliminateDiscrete(const DiscreteFactorGraph& factors, const Ordering& frontalKeys) {
+  EliminateDiscreteTrees(const DiscreteFactorGraph& factors, const Ordering& frontalKeys) {
 
     // PRODUCT: multiply all factors
     gttic(product);
@@ -129,6 +139,133 @@ namespace gtsam {
     return std::make_pair(cond, sum);
   }
 
+  /* ************************************************************************* */
+  std::pair<DiscreteConditional::shared_ptr, DecisionTreeFactor::shared_ptr>  //
+  EliminateDiscreteDense(const DiscreteFactorGraph& factors, const Ordering& frontalKeys) {
+
+    // PRODUCT: multiply all factors as dense tables
+    gttic(product);
+    DenseDiscreteFactor product;
+    for(const DiscreteFactor::shared_ptr& factor: factors) {
+      if (auto dense = boost::dynamic_pointer_cast<DenseDiscreteFactor>(factor))
+        product = product * (*dense);
+      else
+        product = product * DenseDiscreteFactor(factor->toDecisionTreeFactor());
+    }
+    gttoc(product);
+
+    // sum out frontals, this is the factor on the separator
+    gttic(sum);
+    DenseDiscreteFactor::shared_ptr separator = product.sum(frontalKeys);
+    DecisionTreeFactor::shared_ptr sum =
+        boost::make_shared<DecisionTreeFactor>(separator->toDecisionTreeFactor());
+    gttoc(sum);
+
+    // Ordering keys for the conditional so that frontalKeys are really in front
+    Ordering orderedKeys;
+    orderedKeys.insert(orderedKeys.end(), frontalKeys.begin(), frontalKeys.end());
+    orderedKeys.insert(orderedKeys.end(), sum->keys().begin(), sum->keys().end());
+
+    // now divide product/sum to get conditional
+    gttic(divide);
+    DiscreteConditional::shared_ptr cond(new DiscreteConditional(
+        (product / *separator).toDecisionTreeFactor(), orderedKeys,
+        frontalKeys.size()));
+    gttoc(divide);
+
+    return std::make_pair(cond, sum);
+  }
+
+  /* ************************************************************************* */
+  // Dense tables pay off when the trees have about as many nodes as the tables
+  // have entries, unless the product table gets too large
+  static bool PreferDense(const DiscreteFactorGraph& factors) {
+    static const size_t kMaxDenseSize = 1 << 20;
+    std::map<Key, size_t> cardinalities;
+    size_t nrNodes = 0, nrEntries = 0;
+    for(const DiscreteFactor::shared_ptr& factor: factors) {
+      size_t entries = 1;
+      if (auto dense = boost::dynamic_pointer_cast<DenseDiscreteFactor>(factor)) {
+        for (const DiscreteKey& key : dense->discreteKeys())
+          cardinalities[key.first] = key.second;
+        entries = dense->table().size();
+        nrNodes += entries;
+      } else if (auto tree =
+                     boost::dynamic_pointer_cast<DecisionTreeFactor>(factor)) {
+        for (Key j : tree->keys())
+          entries *= (cardinalities[j] = tree->cardinality(j));
+        nrNodes += tree->nrNodes();
+      } else {
+        return false;
+      }
+      nrEntries += entries;
+    }
+    size_t productSize = 1;
+    for (const auto& key_cardinality : cardinalities) {
+      productSize *= key_cardinality.second;
+      if (productSize > kMaxDenseSize) return false;
+    }
+    return 2 * nrNodes >= nrEntries;
+  }
+
+  /* ************************************************************************* */
+  std::pair<DiscreteConditional::shared_ptr, DecisionTreeFactor::shared_ptr>  //
+  EliminateDiscrete(const DiscreteFactorGraph& factors, const Ordering& frontalKeys) {
+    if (PreferDense(factors))
+      return EliminateDiscreteDense(factors, frontalKeys);
+    return EliminateDiscreteTrees(factors, frontalKeys);
+  }
+
+  /* ************************************************************************* */
+  std::pair<DiscreteConditional::shared_ptr, DecisionTreeFactor::shared_ptr>  //
+  EliminateForMPE(const DiscreteFactorGraph& factors, const Ordering& frontalKeys) {
+    DecisionTreeFactor product;
+    DecisionTreeFactor::shared_ptr max;
+    if (PreferDense(factors)) {
+      gttic(product);
+      DenseDiscreteFactor dense;
+      for(const DiscreteFactor::shared_ptr& factor: factors) {
+        if (auto f = boost::dynamic_pointer_cast<DenseDiscreteFactor>(factor))
+          dense = dense * (*f);
+        else
+          dense = dense * DenseDiscreteFactor(factor->toDecisionTreeFactor());
+      }
+      product = dense.toDecisionTreeFactor();
+      gttoc(product);
+      gttic(max);
+      max = boost::make_shared<DecisionTreeFactor>(
+          dense.max(frontalKeys)->toDecisionTreeFactor());
+      gttoc(max);
+    } else {
+      gttic(product);
+      for(const DiscreteFactor::shared_ptr& factor: factors)
+        product = (*factor) * product;
+      gttoc(product);
+      gttic(max);
+      max = product.combine(frontalKeys, Potentials::ADT::Ring::max);
+      gttoc(max);
+    }
+
+    // Scale the max-marginal to a maximum of one, so that the products of
+    // long chains of factors smaller than one do not underflow to zero
+    double largest = 0.0;
+    max->visitWith([&largest](const Assignment<Key>&, const double& value) {
+      largest = std::max(largest, value);
+    });
+    if (largest > 0.0)
+      max = boost::make_shared<DecisionTreeFactor>(
+          *max / DecisionTreeFactor(DiscreteKeys(), Potentials::ADT(
+                                        DecisionTree<Key, double>(largest))));
+
+    // The product is all we need to find the arg max of the frontals later
+    Ordering orderedKeys;
+    orderedKeys.insert(orderedKeys.end(), frontalKeys.begin(), frontalKeys.end());
+    orderedKeys.insert(orderedKeys.end(), max->keys().begin(), max->keys().end());
+    auto lookup = boost::make_shared<DiscreteLookupTable>(product, orderedKeys,
+                                                          frontalKeys.size());
+    return std::make_pair(lookup, max);
+  }
+
 /* ************************************************************************* */
 } // namespace
 
@@ -37,10 +37,36 @@ class DiscreteEliminationTree;
 class DiscreteBayesTree;
 class DiscreteJunctionTree;
 
-/** Main elimination function for DiscreteFactorGraph */
+/**
+ * Main elimination function for DiscreteFactorGraph. Multiplies the factors
+ * as dense tables, see EliminateDiscreteDense, when their decision trees are
+ * not much smaller than the tables they represent, and as decision trees,
+ * see EliminateDiscreteTrees, otherwise.
+ */
 GTSAM_EXPORT std::pair<boost::shared_ptr<DiscreteConditional>, DecisionTreeFactor::shared_ptr>
 EliminateDiscrete(const DiscreteFactorGraph& factors, const Ordering& keys);
 
+/** Eliminate by multiplying and summing decision trees */
+GTSAM_EXPORT std::pair<boost::shared_ptr<DiscreteConditional>, DecisionTreeFactor::shared_ptr>
+EliminateDiscreteTrees(const DiscreteFactorGraph& factors, const Ordering& keys);
+
+/**
+ * Eliminate by multiplying and summing dense tables, see DenseDiscreteFactor.
+ * The results are the same as those of EliminateDiscreteTrees.
+ */
+GTSAM_EXPORT std::pair<boost::shared_ptr<DiscreteConditional>, DecisionTreeFactor::shared_ptr>
+EliminateDiscreteDense(const DiscreteFactorGraph& factors, const Ordering& keys);
+
+/**
+ * Max-product elimination, for finding the most probable explanation (MPE).
+ * Maximizes the frontal variables out of the product of the factors, and
+ * returns that product as a DiscreteLookupTable rather than normalizing it
+ * into a conditional, as the arg max of the frontals is all that is needed.
+ * The max-marginal on the separator is scaled to a maximum of one.
+ */
+GTSAM_EXPORT std::pair<boost::shared_ptr<DiscreteConditional>, DecisionTreeFactor::shared_ptr>
+EliminateForMPE(const DiscreteFactorGraph& factors, const Ordering& keys);
+
 /* ************************************************************************* */
 template<> struct EliminationTraits<DiscreteFactorGraph>
 {
@@ -132,12 +158,15 @@ public:
   void print(const std::string& s = "DiscreteFactorGraph",
       const KeyFormatter& formatter =DefaultKeyFormatter) const;
 
-  /** Solve the factor graph by performing variable elimination in COLAMD order using
-   *  the dense elimination function specified in \c function,
-   *  followed by back-substitution resulting from elimination.  Is equivalent
-   *  to calling graph.eliminateSequential()->optimize(). */
+  /** Find the most probable explanation (MPE) by multifrontal max-product
+   *  elimination in COLAMD order, see EliminateForMPE, followed by
+   *  back-substitution in the Bayes tree. Cliques in different subtrees are
+   *  eliminated in parallel when GTSAM is built with TBB. */
   DiscreteFactor::sharedValues optimize() const;
 
+  /** Find the most probable explanation as above, in the given ordering */
+  DiscreteFactor::sharedValues optimize(const Ordering& ordering) const;
+
 
 //  /** Permute the variables in the factors */
 //  GTSAM_EXPORT void permuteWithInverse(const Permutation& inversePermutation);
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    DiscreteLookupTable.h
+ * @brief   Result of max-product elimination of a clique
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/discrete/DiscreteConditional.h>
+
+#include <boost/shared_ptr.hpp>
+
+namespace gtsam {
+
+/**
+ * The product of the factors on a clique, as produced by max-product
+ * elimination, see EliminateForMPE. It stands in for a conditional in Bayes
+ * nets and trees, but is not normalized: only the arg max of the frontal
+ * variables given values of the parents, i.e., solveInPlace, is meaningful.
+ * Skipping the normalization saves a sum and a division per clique.
+ */
+class GTSAM_EXPORT DiscreteLookupTable : public DiscreteConditional {
+ public:
+  typedef DiscreteLookupTable This;
+  typedef DiscreteConditional Base;
+  typedef boost::shared_ptr<This> shared_ptr;
+
+  /// Default constructor
+  DiscreteLookupTable() {}
+
+  /**
+   * Construct from the product of the factors on a clique
+   * @param product the product, on the keys in orderedKeys
+   * @param orderedKeys the frontal keys first, then the parents
+   * @param nrFrontals the number of frontal keys
+   */
+  DiscreteLookupTable(const DecisionTreeFactor& product,
+                      const Ordering& orderedKeys, size_t nrFrontals)
+      : Base(product, orderedKeys, nrFrontals) {}
+
+  /// GTSAM-style print
+  void print(const std::string& s = "Discrete Lookup Table: ",
+             const KeyFormatter& formatter = DefaultKeyFormatter) const override {
+    Base::print(s, formatter);
+  }
+};
+
+// traits
+template <>
+struct traits<DiscreteLookupTable> : public Testable<DiscreteLookupTable> {};
+
+}  // namespace gtsam
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteMarginals.cpp
+ * @brief A class for computing marginals in a DiscreteFactorGraph
+ * @date October 2026
+ */
+
+#include <gtsam/discrete/DiscreteMarginals.h>
+#include <gtsam/base/treeTraversal-inst.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+typedef DiscreteBayesTree::sharedClique sharedClique;
+
+// Joint marginal of a clique given the joint marginal of its parent, if any
+DecisionTreeFactor::shared_ptr CliqueMarginal(
+    const DiscreteBayesTreeClique& clique,
+    const DecisionTreeFactor::shared_ptr& parentMarginal) {
+  const DiscreteConditional& conditional = *clique.conditional();
+  if (!parentMarginal) return boost::make_shared<DecisionTreeFactor>(conditional);
+  Ordering eliminate;
+  for (Key j : parentMarginal->keys())
+    if (find(conditional.beginParents(), conditional.endParents(), j) ==
+        conditional.endParents())
+      eliminate.push_back(j);
+  return boost::make_shared<DecisionTreeFactor>(
+      DecisionTreeFactor(conditional) * (*parentMarginal->sum(eliminate)));
+}
+
+// Marginal of variable j from the joint marginal of a clique
+DecisionTreeFactor::shared_ptr VariableMarginal(
+    const DecisionTreeFactor& cliqueMarginal, Key j) {
+  Ordering eliminate;
+  for (Key key : cliqueMarginal.keys())
+    if (key != j) eliminate.push_back(key);
+  return cliqueMarginal.sum(eliminate);
+}
+
+Vector Probabilities(const DiscreteFactor& marginal, const DiscreteKey& key) {
+  Vector result(key.second);
+  DiscreteFactor::Values values;
+  for (size_t state = 0; state < key.second; ++state) {
+    values[key.first] = state;
+    result(state) = marginal(values);
+  }
+  return result;
+}
+}  // namespace
+
+/* ************************************************************************* */
+DecisionTreeFactor::shared_ptr DiscreteMarginals::cliqueMarginal(
+    const sharedClique& clique) const {
+  std::lock_guard<std::mutex> lock(cliqueMarginalsMutex_);
+
+  // Find the closest ancestor with a cached marginal
+  vector<sharedClique> path;
+  DecisionTreeFactor::shared_ptr marginal;
+  for (sharedClique c = clique; c; c = c->parent()) {
+    auto it = cliqueMarginals_.find(c.get());
+    if (it != cliqueMarginals_.end() && it->second) {
+      marginal = it->second;
+      break;
+    }
+    path.push_back(c);
+  }
+
+  // and work down from there
+  for (auto c = path.rbegin(); c != path.rend(); ++c) {
+    marginal = CliqueMarginal(**c, marginal);
+    cliqueMarginals_[c->get()] = marginal;
+  }
+  return marginal;
+}
+
+/* ************************************************************************* */
+DiscreteFactor::shared_ptr DiscreteMarginals::operator()(Key variable) const {
+  return VariableMarginal(*cliqueMarginal(bayesTree_->clique(variable)),
+                          variable);
+}
+
+/* ************************************************************************* */
+Vector DiscreteMarginals::marginalProbabilities(const DiscreteKey& key) const {
+  return Probabilities(*(*this)(key.first), key);
+}
+
+/* ************************************************************************* */
+map<Key, Vector> DiscreteMarginals::allMarginalProbabilities() const {
+  gttic(DiscreteMarginals_allMarginalProbabilities);
+  std::lock_guard<std::mutex> lock(cliqueMarginalsMutex_);
+
+  // Create all cache entries up front, so that the pass below only writes to
+  // existing entries, which is safe from several threads
+  for (const auto& key_clique : bayesTree_->nodes())
+    cliqueMarginals_[key_clique.second.get()];
+
+  DecisionTreeFactor::shared_ptr rootData;
+  auto visitorPre = [this](const sharedClique& clique,
+                           const DecisionTreeFactor::shared_ptr& parent) {
+    DecisionTreeFactor::shared_ptr& marginal =
+        cliqueMarginals_.at(clique.get());
+    if (!marginal) marginal = CliqueMarginal(*clique, parent);
+    return marginal;
+  };
+  treeTraversal::no_op visitorPost;
+  treeTraversal::DepthFirstForestParallel(*bayesTree_, rootData, visitorPre,
+                                          visitorPost);
+
+  map<Key, Vector> result;
+  for (const auto& key_clique : bayesTree_->nodes()) {
+    const Key j = key_clique.first;
+    const DiscreteKey key(j, key_clique.second->conditional()->cardinality(j));
+    result.emplace(
+        j, Probabilities(
+               *VariableMarginal(*cliqueMarginals_.at(key_clique.second.get()), j),
+               key));
+  }
+  return result;
+}
+
+}  // namespace gtsam
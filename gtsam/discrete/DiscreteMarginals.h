@@ -24,17 +24,34 @@
 #include <gtsam/discrete/DiscreteBayesTree.h>
 #include <gtsam/base/Vector.h>
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 namespace gtsam {
 
   /**
-   * A class for computing marginals of variables in a DiscreteFactorGraph
+   * A class for computing marginals of variables in a DiscreteFactorGraph.
+   *
+   * The joint marginal of a clique in the Bayes tree is its conditional times
+   * the marginal of its separator, which follows from the joint marginal of
+   * the parent clique. Clique marginals are computed that way, from the root
+   * down, and cached, so that querying the marginals of many variables takes
+   * one pass down the Bayes tree in total rather than a shortcut computation
+   * per variable. The cache is guarded by a mutex, so that queries may be
+   * made concurrently from several threads.
    */
-  class DiscreteMarginals {
+  class GTSAM_EXPORT DiscreteMarginals {
 
   protected:
 
     DiscreteBayesTree::shared_ptr bayesTree_;
 
+    /// Joint marginals of the cliques computed so far
+    mutable std::unordered_map<const DiscreteBayesTreeClique*,
+                               DecisionTreeFactor::shared_ptr> cliqueMarginals_;
+    mutable std::mutex cliqueMarginalsMutex_;  ///< guards cliqueMarginals_
+
   public:
 
   /** Construct a marginals class.
@@ -44,32 +61,38 @@ namespace gtsam {
     bayesTree_ = graph.eliminateMultifrontal();
   }
 
-  /** Compute the marginal of a single variable */
-  DiscreteFactor::shared_ptr operator()(Key variable) const {
-    // Compute marginal
-    DiscreteFactor::shared_ptr marginalFactor;
-    marginalFactor = bayesTree_->marginalFactor(variable, &EliminateDiscrete);
-    return marginalFactor;
+  /// Copy constructor, which shares the Bayes tree but not the cache
+  DiscreteMarginals(const DiscreteMarginals& other)
+      : bayesTree_(other.bayesTree_) {}
+
+  /// Assignment, which shares the Bayes tree but not the cache
+  DiscreteMarginals& operator=(const DiscreteMarginals& other) {
+    std::lock_guard<std::mutex> lock(cliqueMarginalsMutex_);
+    bayesTree_ = other.bayesTree_;
+    cliqueMarginals_.clear();
+    return *this;
   }
 
+  /** Compute the marginal of a single variable */
+  DiscreteFactor::shared_ptr operator()(Key variable) const;
+
   /** Compute the marginal of a single variable
    *   @param key DiscreteKey of the Variable
    *   @return Vector of marginal probabilities
    */
-  Vector marginalProbabilities(const DiscreteKey& key) const {
-    // Compute marginal
-    DiscreteFactor::shared_ptr marginalFactor;
-    marginalFactor = bayesTree_->marginalFactor(key.first, &EliminateDiscrete);
-
-    //Create result
-    Vector vResult(key.second);
-    for (size_t state = 0; state < key.second ; ++ state) {
-      DiscreteFactor::Values values;
-      values[key.first] = state;
-      vResult(state) = (*marginalFactor)(values);
-    }
-    return vResult;
-  }
+  Vector marginalProbabilities(const DiscreteKey& key) const;
+
+  /**
+   * Compute the marginals of all variables, with the clique marginals
+   * computed in one pass down the Bayes tree, in parallel across subtrees
+   * when GTSAM is built with TBB.
+   * @return the vector of marginal probabilities of every variable
+   */
+  std::map<Key, Vector> allMarginalProbabilities() const;
+
+  /** The joint marginal of the frontal and separator variables of a clique */
+  DecisionTreeFactor::shared_ptr cliqueMarginal(
+      const DiscreteBayesTree::sharedClique& clique) const;
 
   };
 
@@ -243,7 +243,11 @@ TEST(ADT, inference)
   dot(joint, "Joint-Product-ASTLBEX");
   joint = apply(joint, pD, &mul);
   dot(joint, "Joint-Product-ASTLBEXD");
+#ifdef GTSAM_DT_HASH_CONSING
+  EXPECT_LONGS_EQUAL(330, (long)muls); // different ordering, memoized
+#else
   EXPECT_LONGS_EQUAL(370, (long)muls); // different ordering
+#endif
   gttoc_(asiaProd);
   tictoc_getNode(asiaProdNode, asiaProd);
   elapsed = asiaProdNode->secs() + asiaProdNode->wall();
@@ -300,7 +304,11 @@ TEST(ADT, factor_graph)
   fg = apply(fg, pX, &mul);
   fg = apply(fg, pD, &mul);
   dot(fg, "FactorGraph");
+#ifdef GTSAM_DT_HASH_CONSING
+  EXPECT_LONGS_EQUAL(138, (long)muls); // memoized
+#else
   EXPECT_LONGS_EQUAL(158, (long)muls);
+#endif
   gttoc_(asiaFG);
   tictoc_getNode(asiaFGNode, asiaFG);
   elapsed = asiaFGNode->secs() + asiaFGNode->wall();
@@ -40,8 +40,10 @@ void dot(const T&f, const string& filename) {
 
 #define DOT(x)(dot(x,#x))
 
+// check that DecisionTree is actually generic (as it pretends to be): Crazy
+// has no hash, which only GTSAM_DT_HASH_CONSING requires
 struct Crazy { int a; double b; };
-typedef DecisionTree<string,Crazy> CrazyDecisionTree; // check that DecisionTree is actually generic (as it pretends to be)
+typedef DecisionTree<string,Crazy> CrazyDecisionTree;
 
 // traits
 namespace gtsam {
@@ -241,6 +243,50 @@ TEST(DT, Compose)
   DOT(f5);
 }
 
+/* ******************************************************************************** */
+// test that memoized apply and choose agree with the virtual node methods
+TEST(DT, Memoized)
+{
+  string A("A"), B("B"), C("C");
+  vector<DT::LabelC> keys;
+  keys += DT::LabelC(A,2), DT::LabelC(B,2), DT::LabelC(C,2);
+  DT f4(keys, "0 4 2 6 1 5 3 7"), f5(C, DT(A, 1, 2), DT(B, 3, 3));
+  DT::Binary add = &Ring::add;
+  DT expected(f4.root_->apply_f_op_g(*f5.root_, add));
+  EXPECT(assert_equal(expected, f4.apply(f5, add)));
+  EXPECT(assert_equal(DT(f4.root_->choose(B, 1)), f4.choose(B, 1)));
+  EXPECT(assert_equal(DT(B, DT(A, 0, 1), DT(A, 2, 3)), f4.choose(C, 0)));
+}
+
+#ifdef GTSAM_DT_HASH_CONSING
+/* ******************************************************************************** */
+// test that nodes are hash-consed
+TEST(DT, HashConsing)
+{
+  string A("A"), B("B"), C("C");
+
+  // Equal trees built independently share their root
+  DT f1(B, DT(A, 0, 1), DT(A, 2, 3));
+  vector<DT::LabelC> keys;
+  keys += DT::LabelC(A,2), DT::LabelC(B,2);
+  DT f2(keys, "0 2 1 3");
+  EXPECT(f1.root_ == f2.root_);
+  EXPECT(DT(5).root_ == DT(5).root_);
+
+  // A choice whose branches are the same subtree is that subtree
+  DT f3(keys, "0 0 1 1");
+  EXPECT(f3.root_ == DT(A, 0, 1).root_);
+
+  // Memoized apply and choose return the unique nodes
+  keys += DT::LabelC(C,2);
+  DT f4(keys, "0 4 2 6 1 5 3 7"), f5(C, DT(A, 1, 2), DT(B, 3, 3));
+  DT::Binary add = &Ring::add;
+  DT expected(f4.root_->apply_f_op_g(*f5.root_, add));
+  EXPECT(expected.root_ == f4.apply(f5, add).root_);
+  EXPECT(f4.choose(C, 0).root_ == f1.root_);
+}
+#endif
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
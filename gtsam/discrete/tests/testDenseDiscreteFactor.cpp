@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testDenseDiscreteFactor.cpp
+ * @brief   Unit tests for DenseDiscreteFactor
+ * @date    October 2026
+ */
+
+#include <gtsam/discrete/DenseDiscreteFactor.h>
+#include <gtsam/discrete/DiscreteConditional.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/base/Testable.h>
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+TEST(DenseDiscreteFactor, constructors) {
+  DiscreteKey X(0, 2), Y(1, 3), Z(2, 2);
+  DenseDiscreteFactor f(X & Y & Z, "2 5 3 6 4 7 25 55 35 65 45 75");
+  EXPECT_LONGS_EQUAL(3, f.size());
+
+  DiscreteFactor::Values values;
+  values[0] = 1;  // x
+  values[1] = 2;  // y
+  values[2] = 1;  // z
+  EXPECT_DOUBLES_EQUAL(75, f(values), 1e-9);
+
+  // Round trip through decision trees, also with keys in reverse order
+  DecisionTreeFactor tree(Z & Y & X, "2 5 3 6 4 7 25 55 35 65 45 75");
+  DenseDiscreteFactor dense(tree);
+  EXPECT(assert_equal(DenseDiscreteFactor(Z & Y & X,
+                                          "2 5 3 6 4 7 25 55 35 65 45 75"),
+                      dense));
+  EXPECT(assert_equal(tree, dense.toDecisionTreeFactor()));
+  EXPECT_DOUBLES_EQUAL(tree(values), dense(values), 1e-9);
+
+  // Trees whose leaves stand for many entries. Only hash-consing merges the
+  // identical subtrees under the root into the same tree.
+  DecisionTreeFactor sparse(X & Y & Z, "0 0 0 0 0 0 1 1 1 1 2 2");
+  const DecisionTreeFactor roundTrip =
+      DenseDiscreteFactor(sparse).toDecisionTreeFactor();
+  for (const DiscreteFactor::Values& assignment : cartesianProduct(X & Y & Z))
+    EXPECT_DOUBLES_EQUAL(sparse(assignment), roundTrip(assignment), 1e-9);
+#ifdef GTSAM_DT_HASH_CONSING
+  EXPECT(assert_equal(sparse, roundTrip));
+#endif
+
+  CHECK_EXCEPTION(DenseDiscreteFactor(X & Y, "1 2 3"), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(DenseDiscreteFactor, multiplication) {
+  DiscreteKey v0(0, 2), v1(1, 3), v2(2, 2), v3(3, 2);
+  DecisionTreeFactor f1(v0 & v1, "1 2 3 4 5 6");
+  DecisionTreeFactor f2(v1 & v2, "5 6 7 8 9 10");
+  DecisionTreeFactor f3(v3 & v0, "0.5 2 3 0");
+
+  DenseDiscreteFactor d1(f1), d2(f2), d3(f3);
+  EXPECT(assert_equal(f1 * f2, (d1 * d2).toDecisionTreeFactor()));
+  EXPECT(assert_equal(f2 * f1, (d2 * d1).toDecisionTreeFactor()));
+  EXPECT(assert_equal(f1 * f2 * f3, (d1 * d2 * d3).toDecisionTreeFactor()));
+  EXPECT(assert_equal(f3 * f1, (d3 * d1).toDecisionTreeFactor()));
+
+  // Constant factor
+  EXPECT(assert_equal(d1, (DenseDiscreteFactor() * d1)));
+
+  // Division by a factor on a subset of the keys
+  DecisionTreeFactor f13 = f1 * f3;
+  DecisionTreeFactor f0(v0, "0 3");
+  EXPECT(assert_equal(f13 / f0,
+                      (DenseDiscreteFactor(f13) / DenseDiscreteFactor(f0))
+                          .toDecisionTreeFactor()));
+  CHECK_EXCEPTION(d1 / d2, std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(DenseDiscreteFactor, sum_max) {
+  DiscreteKey v0(0, 3), v1(1, 2), v2(2, 2);
+  DecisionTreeFactor f(v0 & v1 & v2, "1 2 3 4 5 6 7 8 9 10 11 12");
+  DenseDiscreteFactor d(f);
+
+  EXPECT(assert_equal(*f.sum(1), d.sum(1)->toDecisionTreeFactor()));
+  EXPECT(assert_equal(*f.sum(2), d.sum(2)->toDecisionTreeFactor()));
+  EXPECT(assert_equal(*f.max(1), d.max(1)->toDecisionTreeFactor()));
+  EXPECT(assert_equal(*f.max(2), d.max(2)->toDecisionTreeFactor()));
+
+  // Keys in the middle or at the end of the table
+  for (const KeyVector& frontals :
+       {KeyVector{1}, KeyVector{2}, KeyVector{0, 2}, KeyVector{2, 1, 0}}) {
+    const Ordering keys(frontals);
+    EXPECT(assert_equal(*f.sum(keys), d.sum(keys)->toDecisionTreeFactor()));
+    EXPECT(assert_equal(*f.combine(keys, Potentials::ADT::Ring::max),
+                        d.max(keys)->toDecisionTreeFactor()));
+  }
+}
+
+/* ************************************************************************* */
+TEST(DenseDiscreteFactor, logSpace) {
+  DiscreteKey v0(0, 3), v1(1, 2), v2(2, 2);
+  DenseDiscreteFactor f(v0 & v1, "1 2 3 4 5 0"), g(v1 & v2, "2 3 4 5");
+
+  EXPECT(assert_equal(f * g, f.log().logProduct(g.log()).exp()));
+  for (const KeyVector& frontals : {KeyVector{0}, KeyVector{1}, KeyVector{0, 1}})
+    EXPECT(assert_equal(*f.sum(Ordering(frontals)),
+                        f.log().logSum(Ordering(frontals))->exp()));
+  EXPECT(assert_equal(*f.sum(1), f.log().logSum(1)->exp()));
+  CHECK_EXCEPTION(f.logSum(f.size() + 1), std::invalid_argument);
+
+  // No underflow where the sum itself is representable
+  DenseDiscreteFactor tiny = DenseDiscreteFactor(v0, "-1000 -1000 -1001");
+  DenseDiscreteFactor::shared_ptr sum = tiny.logSum(1);
+  EXPECT_DOUBLES_EQUAL(-1000 + std::log(2 + std::exp(-1)), sum->table()(0),
+                       1e-9);
+
+  // All zero probabilities
+  DenseDiscreteFactor zero(v0, "0 0 0");
+  EXPECT(std::isinf(zero.log().logSum(1)->table()(0)));
+}
+
+/* ************************************************************************* */
+TEST(DenseDiscreteFactor, Eliminate) {
+  DiscreteKey A(0, 3), B(1, 2), C(2, 3), D(3, 2);
+  DiscreteFactorGraph graph;
+  graph.add(A & B, "1 2 3 4 5 6");
+  graph.add(B & C, "6 5 4 3 2 1");
+  graph.add(C & A & D, "1 9 2 8 3 7 4 6 5 5 6 4 7 3 8 2 9 1");
+  graph.push_back(boost::make_shared<DenseDiscreteFactor>(
+      B & D, std::vector<double>{0.5, 1.5, 2.5, 3.5}));
+
+  for (const KeyVector& keys : {KeyVector{0}, KeyVector{2, 1}}) {
+    const Ordering frontals(keys);
+    auto expected = EliminateDiscreteTrees(graph, frontals);
+    auto actual = EliminateDiscreteDense(graph, frontals);
+    EXPECT(assert_equal(*expected.first, *actual.first));
+    EXPECT(assert_equal(*expected.second, *actual.second));
+    actual = EliminateDiscrete(graph, frontals);
+    EXPECT(assert_equal(*expected.first, *actual.first));
+    EXPECT(assert_equal(*expected.second, *actual.second));
+  }
+
+  // The whole graph
+  const Ordering ordering(KeyVector{0, 1, 2, 3});
+  auto expected = graph.eliminateSequential(ordering, EliminateDiscreteTrees);
+  auto actual = graph.eliminateSequential(ordering, EliminateDiscreteDense);
+  EXPECT(assert_equal(*expected, *actual));
+  EXPECT(assert_equal(*expected->optimize(), *actual->optimize()));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
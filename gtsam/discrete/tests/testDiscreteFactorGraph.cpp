@@ -19,6 +19,7 @@
 #include <gtsam/discrete/DiscreteFactorGraph.h>
 #include <gtsam/discrete/DiscreteEliminationTree.h>
 #include <gtsam/discrete/DiscreteBayesTree.h>
+#include <gtsam/discrete/DiscreteLookupTable.h>
 #include <gtsam/inference/BayesNet.h>
 
 #include <CppUnitLite/TestHarness.h>
@@ -26,6 +27,8 @@
 #include <boost/assign/std/map.hpp>
 using namespace boost::assign;
 
+#include <random>
+
 using namespace std;
 using namespace gtsam;
 
@@ -253,6 +256,65 @@ EXPECT(assert_equal(expectedMPE, *actualMPE));
 //  EXPECT(assert_equal(expectedMPE, *actualMPE));
 #endif
 }
+
+/* ************************************************************************* */
+TEST(DiscreteFactorGraph, optimizeMaxProduct) {
+  // Loopy graph with random potentials, small enough for brute force
+  DiscreteKeys keys;
+  for (size_t j = 0; j < 8; j++) keys.push_back(DiscreteKey(j, j % 2 ? 2 : 3));
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(0.1, 1.0);
+  auto table = [&](size_t n) {
+    std::vector<double> values(n);
+    for (double& value : values) value = uniform(rng);
+    return values;
+  };
+  DiscreteFactorGraph graph;
+  for (size_t j = 0; j < 8; j++) {
+    const DiscreteKey &a = keys[j], &b = keys[(j + 1) % 8], &c = keys[(j + 3) % 8];
+    graph.add(a & b, table(a.second * b.second));
+    if (j % 3 == 0) graph.add(a & c, table(a.second * c.second));
+  }
+
+  double maxValue = 0;
+  DiscreteFactor::Values expected;
+  for (const DiscreteFactor::Values& values : cartesianProduct(keys)) {
+    const double value = graph(values);
+    if (value > maxValue) maxValue = value, expected = values;
+  }
+
+  EXPECT(assert_equal(expected, *graph.optimize()));
+  Ordering ordering;
+  for (size_t j = 0; j < 8; j++) ordering.push_back(7 - j);
+  EXPECT(assert_equal(expected, *graph.optimize(ordering)));
+
+  // Eliminating for the MPE only builds lookup tables
+  DiscreteBayesTree::shared_ptr bayesTree =
+      graph.eliminateMultifrontal(ordering, EliminateForMPE);
+  for (const auto& root : bayesTree->roots())
+    EXPECT(boost::dynamic_pointer_cast<DiscreteLookupTable>(root->conditional()));
+  EXPECT(assert_equal(expected, *bayesTree->optimize()));
+}
+
+/* ************************************************************************* */
+TEST(DiscreteFactorGraph, MPEUnderflow) {
+  // On a long chain of small factors, the unnormalized max-marginals would
+  // underflow to zero, and leave the MPE undetermined
+  const size_t n = 1000;
+  DiscreteFactorGraph graph;
+  Ordering ordering;
+  DiscreteFactor::Values expected;
+  for (size_t j = 0; j < n; j++) {
+    if (j + 1 < n)
+      graph.add(DiscreteKey(j, 2) & DiscreteKey(j + 1, 2),
+                "1e-3 1e-3 1e-3 2e-3");
+    ordering.push_back(j);
+    expected[j] = 1;
+  }
+  DiscreteBayesTree::shared_ptr bayesTree =
+      graph.eliminateMultifrontal(ordering, EliminateForMPE);
+  EXPECT(assert_equal(expected, *bayesTree->optimize()));
+}
 #ifdef OLD
 
 /* ************************************************************************* */
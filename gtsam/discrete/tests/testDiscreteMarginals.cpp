@@ -24,6 +24,8 @@ using namespace boost::assign;
 
 #include <CppUnitLite/TestHarness.h>
 
+#include <thread>
+
 using namespace std;
 using namespace gtsam;
 
@@ -193,6 +195,42 @@ TEST_UNSAFE(DiscreteMarginals, truss2) {
     EXPECT(assert_equal(
         expectedM, *boost::dynamic_pointer_cast<DecisionTreeFactor>(actualM)));
   }
+
+  // All marginals at once
+  std::map<Key, Vector> all = DiscreteMarginals(graph).allMarginalProbabilities();
+  EXPECT_LONGS_EQUAL(5, all.size());
+  for (size_t j = 0; j < 5; j++)
+    EXPECT(assert_equal(Vector2(F[j], T[j]), all[j]));
+}
+
+/* ************************************************************************* */
+// Queries from several threads share one cache
+TEST(DiscreteMarginals, concurrentQueries) {
+  const size_t n = 20;
+  DiscreteFactorGraph graph;
+  for (size_t i = 0; i + 1 < n; i++)
+    graph.add(DiscreteKey(i, 2) & DiscreteKey(i + 1, 2), "5 1 2 4");
+  graph.add(DiscreteKey(0, 2), "1 3");
+
+  const map<Key, Vector> expected =
+      DiscreteMarginals(graph).allMarginalProbabilities();
+
+  const DiscreteMarginals marginals(graph);
+  vector<map<Key, Vector> > actual(4);
+  vector<thread> threads;
+  for (size_t t = 0; t < actual.size(); t++)
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < n; i++) {
+        const Key j = (t % 2 == 0) ? i : n - 1 - i;
+        actual[t][j] = marginals.marginalProbabilities(DiscreteKey(j, 2));
+      }
+    });
+  for (thread& t : threads) t.join();
+
+  for (const map<Key, Vector>& probabilities : actual)
+    for (const auto& key_vector : expected)
+      EXPECT(assert_equal(key_vector.second,
+                          probabilities.at(key_vector.first)));
 }
 
 /* ************************************************************************* */
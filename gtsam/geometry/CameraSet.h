@@ -20,6 +20,7 @@
 
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/geometry/CalibratedCamera.h>  // for Cheirality exception
+#include <gtsam/geometry/ProjectionBatch.h>
 #include <gtsam/base/Testable.h>
 #include <gtsam/base/SymmetricBlockMatrix.h>
 #include <gtsam/base/FastMap.h>
@@ -131,6 +132,28 @@ public:
     return z;
   }
 
+  /**
+   * Project all M rows of points into each of the N cameras, which need a
+   * pose() and a calibration(), see ProjectBatch. The image points and the
+   * derivatives with respect to the camera pose and the point are written
+   * into caller-provided buffers of N*M entries, where the entry for camera i
+   * and point j is at i*M + j. Dpose and Dpoint may be null. Unlike
+   * project2, the derivatives are with respect to the pose only, also for
+   * cameras that include their calibration in the state.
+   * throws CheiralityException
+   */
+  void projectBatch(const Vector3Batch& points, Point2* z,
+                    Matrix26* Dpose = nullptr,
+                    Matrix23* Dpoint = nullptr) const {
+    const size_t m = points.rows();
+    for (size_t i = 0; i < this->size(); i++) {
+      const CAMERA& camera = this->at(i);
+      ProjectBatch(camera.pose(), camera.calibration(), points, z + i * m,
+                   Dpose ? Dpose + i * m : nullptr,
+                   Dpoint ? Dpoint + i * m : nullptr);
+    }
+  }
+
   /// Calculate vector [project2(point)-z] of re-projection errors
   template<class POINT>
   Vector reprojectionError(const POINT& point, const ZVector& measured,
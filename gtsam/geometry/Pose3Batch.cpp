@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Pose3Batch.cpp
+ * @brief   Many 3D poses at once, stored as a structure of arrays
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/Pose3Batch.h>
+
+#include <limits>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+// Elementwise products of 3*3 matrices
+Matrix3Batch multiply(const Matrix3Batch& A, const Matrix3Batch& B) {
+  return Rot3Batch(A).compose(Rot3Batch(B)).matrices();
+}
+
+// Elementwise transposes of 3*3 matrices
+Matrix3Batch transpose(const Matrix3Batch& A) {
+  Matrix3Batch result(A.rows(), 9);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) result.col(3 * i + j) = A.col(3 * j + i);
+  return result;
+}
+
+// Elementwise skew-symmetric matrices [w]x
+Matrix3Batch skew(const Vector3Batch& w) {
+  Matrix3Batch W(w.rows(), 9);
+  W.col(0).setZero();
+  W.col(1) = -w.col(2);
+  W.col(2) = w.col(1);
+  W.col(3) = w.col(2);
+  W.col(4).setZero();
+  W.col(5) = -w.col(0);
+  W.col(6) = -w.col(1);
+  W.col(7) = w.col(0);
+  W.col(8).setZero();
+  return W;
+}
+
+// Set the 3*3 block at (3 * r, 3 * c) of every 6*6 matrix in H
+void setBlock(int r, int c, const Matrix3Batch& M, Matrix6Batch* H) {
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      H->col(6 * (3 * r + i) + 3 * c + j) = M.col(3 * i + j);
+}
+
+// Elementwise 6*6 identities
+void setIdentity(size_t n, Matrix6Batch* H) {
+  H->setZero(n, 36);
+  for (int k = 0; k < 6; k++) H->col(7 * k).setOnes();
+}
+
+// sign * AdjointMap of the inverse of every pose (R, t), which is
+// [R^T 0; -[R^T t]x R^T R^T]
+void adjointOfInverse(const Rot3Batch& R, const Vector3Batch& t, double sign,
+                      Matrix6Batch* H) {
+  const Matrix3Batch Rt = sign * transpose(R.matrices());
+  H->setZero(R.size(), 36);
+  setBlock(0, 0, Rt, H);
+  setBlock(1, 0, -multiply(skew(R.unrotate(t)), Rt), H);
+  setBlock(1, 1, Rt, H);
+}
+
+// The lower left block of Pose3::ExpmapDerivative, Barfoot14tro eq. (102),
+// as computeQforExpmapDerivative in Pose3.cpp
+Matrix3Batch expmapQ(const Vector3Batch& w, const Vector3Batch& v) {
+  const Matrix3Batch W = skew(w), V = skew(v);
+  const Matrix3Batch WV = multiply(W, V), VW = multiply(V, W);
+  const Matrix3Batch WVW = multiply(WV, W);
+  const Matrix3Batch WWV = multiply(W, WV), VWW = multiply(VW, W);
+  const Matrix3Batch WVWW = multiply(WVW, W), WWVW = multiply(W, WVW);
+
+  const Eigen::ArrayXd phi = w.square().rowwise().sum().sqrt();
+  const Eigen::Array<bool, Eigen::Dynamic, 1> nearZero = phi <= 1e-5;
+  const Eigen::ArrayXd p = nearZero.select(1.0, phi);
+  const Eigen::ArrayXd p2 = p * p, p3 = p2 * p, p4 = p3 * p, p5 = p4 * p;
+  const Eigen::ArrayXd s = p.sin(), c = p.cos();
+  const Eigen::ArrayXd a = nearZero.select(1. / 6., (p - s) / p3);
+  const Eigen::ArrayXd b = nearZero.select(1. / 24., (1 - p2 / 2 - c) / p4);
+  const Eigen::ArrayXd d = nearZero.select(
+      1. / 24. + 3. / 120., b - 3 * (p - s - p3 / 6.) / p5);
+
+  return -0.5 * V + (WV + VW - WVW).colwise() * a +
+         (WWV + VWW - 3 * WVW).colwise() * b -
+         (WVWW + WWVW).colwise() * (0.5 * d);
+}
+}  // namespace
+
+/* ************************************************************************* */
+Pose3Batch::Pose3Batch(const vector<Pose3>& poses) : t_(poses.size(), 3) {
+  vector<Rot3> rotations;
+  rotations.reserve(poses.size());
+  for (size_t i = 0; i < poses.size(); i++) {
+    rotations.push_back(poses[i].rotation());
+    t_.row(i) = poses[i].translation().transpose().array();
+  }
+  R_ = Rot3Batch(rotations);
+}
+
+/* ************************************************************************* */
+Pose3 Pose3Batch::at(size_t i) const {
+  return Pose3(R_.at(i), Point3(t_.row(i).transpose().matrix()));
+}
+
+/* ************************************************************************* */
+vector<Pose3> Pose3Batch::poses() const {
+  vector<Pose3> result;
+  result.reserve(size());
+  for (size_t i = 0; i < size(); i++) result.push_back(at(i));
+  return result;
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::Expmap(const Vector6Batch& xi, Matrix6Batch* H) {
+  const Vector3Batch omega = xi.leftCols<3>(), v = xi.rightCols<3>();
+  Pose3Batch result;
+  Matrix3Batch Jw;
+  result.R_ = Rot3Batch::Expmap(omega, H ? &Jw : nullptr);
+  if (H) {
+    H->setZero(xi.rows(), 36);
+    setBlock(0, 0, Jw, H);
+    setBlock(1, 0, expmapQ(omega, v), H);
+    setBlock(1, 1, Jw, H);
+  }
+
+  // t = (w x v - R (w x v) + w w^T v) / |w|^2, or v near the identity
+  const Eigen::ArrayXd theta2 = omega.square().rowwise().sum();
+  const Eigen::Array<bool, Eigen::Dynamic, 1> general =
+      theta2 > numeric_limits<double>::epsilon();
+  const Eigen::ArrayXd w_dot_v = (omega * v).rowwise().sum();
+  const Vector3Batch omega_cross_v = cross(omega, v);
+  const Vector3Batch R_omega_cross_v = result.R_.rotate(omega_cross_v);
+  result.t_.resize(xi.rows(), 3);
+  for (int k = 0; k < 3; k++)
+    result.t_.col(k) = general.select(
+        (omega_cross_v.col(k) - R_omega_cross_v.col(k) +
+         omega.col(k) * w_dot_v) / theta2,
+        v.col(k));
+  return result;
+}
+
+/* ************************************************************************* */
+Vector6Batch Pose3Batch::Logmap(const Pose3Batch& poses, Matrix6Batch* H) {
+  Matrix3Batch Jw;
+  const Vector3Batch w = Rot3Batch::Logmap(poses.R_, H ? &Jw : nullptr);
+  const Vector3Batch& T = poses.t_;
+  const Eigen::ArrayXd t = w.square().rowwise().sum().sqrt();
+  const Eigen::Array<bool, Eigen::Dynamic, 1> general = t >= 1e-10;
+  const Eigen::ArrayXd safe = general.select(t, 1.0);
+
+  // Agrawal06iros, equation (14), as in Pose3::Logmap
+  Vector3Batch axis(w.rows(), 3);
+  for (int k = 0; k < 3; k++) axis.col(k) = w.col(k) / safe;
+  const Vector3Batch WT = cross(axis, T);
+  const Vector3Batch WWT = cross(axis, WT);
+  const Eigen::ArrayXd c = 1.0 - safe / (2.0 * (0.5 * safe).tan());
+
+  Vector6Batch log(w.rows(), 6);
+  log.leftCols<3>() = w;
+  for (int k = 0; k < 3; k++)
+    log.col(3 + k) = general.select(
+        T.col(k) - 0.5 * safe * WT.col(k) + c * WWT.col(k), T.col(k));
+
+  if (H) {
+    // As Pose3::LogmapDerivative, with Q evaluated at the logarithm
+    const Matrix3Batch Q = expmapQ(w, log.rightCols<3>());
+    H->setZero(w.rows(), 36);
+    setBlock(0, 0, Jw, H);
+    setBlock(1, 0, -multiply(multiply(Jw, Q), Jw), H);
+    setBlock(1, 1, Jw, H);
+  }
+  return log;
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::compose(const Pose3Batch& other, Matrix6Batch* H1,
+                               Matrix6Batch* H2) const {
+  if (H1) adjointOfInverse(other.R_, other.t_, 1.0, H1);
+  if (H2) setIdentity(size(), H2);
+  return Pose3Batch(R_.compose(other.R_), R_.rotate(other.t_) + t_);
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::between(const Pose3Batch& other, Matrix6Batch* H1,
+                               Matrix6Batch* H2) const {
+  Pose3Batch result(R_.between(other.R_), R_.unrotate(other.t_ - t_));
+  if (H1) adjointOfInverse(result.R_, result.t_, -1.0, H1);
+  if (H2) setIdentity(size(), H2);
+  return result;
+}
+
+/* ************************************************************************* */
+Vector3Batch Pose3Batch::transformFrom(const Vector3Batch& p,
+                                       Matrix36Batch* Hself,
+                                       Matrix3Batch* Hpoint) const {
+  const Matrix3Batch& R = R_.matrices();
+  if (Hself) {
+    const Matrix3Batch left = multiply(R, skew(-p));
+    Hself->resize(size(), 18);
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) {
+        Hself->col(6 * i + j) = left.col(3 * i + j);
+        Hself->col(6 * i + 3 + j) = R.col(3 * i + j);
+      }
+  }
+  if (Hpoint) *Hpoint = R;
+  return R_.rotate(p) + t_;
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::interpolate(const Pose3Batch& other, double t) const {
+  return compose(Expmap(t * Logmap(between(other))));
+}
+
+}  // namespace gtsam
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Pose3Batch.h
+ * @brief   Many 3D poses at once, stored as a structure of arrays
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/geometry/Rot3Batch.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/// N 6*6 matrices, e.g., Jacobians, with the entries of each in row-major
+/// order in one row
+typedef Eigen::Array<double, Eigen::Dynamic, 36> Matrix6Batch;
+
+/// N 3*6 matrices, in row-major order in one row
+typedef Eigen::Array<double, Eigen::Dynamic, 18> Matrix36Batch;
+
+/**
+ * N poses, stored as a Rot3Batch and a Vector3Batch of translations. As in
+ * Rot3Batch, every operation is a vectorized array expression over all poses,
+ * and follows the Pose3 formulas for a single pose.
+ */
+class GTSAM_EXPORT Pose3Batch {
+ public:
+  /// @name Constructors
+  /// @{
+
+  /// Uninitialized batch of n poses
+  explicit Pose3Batch(size_t n = 0) : R_(n), t_(n, 3) {}
+
+  /// Batch from rotations and translations
+  Pose3Batch(const Rot3Batch& R, const Vector3Batch& t) : R_(R), t_(t) {}
+
+  /// Copy poses into a batch
+  explicit Pose3Batch(const std::vector<Pose3>& poses);
+
+  /// @}
+  /// @name Access
+  /// @{
+
+  size_t size() const { return R_.size(); }  ///< number of poses
+
+  const Rot3Batch& rotations() const { return R_; }
+  const Vector3Batch& translations() const { return t_; }
+
+  /// The i-th pose
+  Pose3 at(size_t i) const;
+
+  /// Copy all poses out of the batch
+  std::vector<Pose3> poses() const;
+
+  /// @}
+  /// @name Lie group
+  /// @{
+
+  /// Exponential map of every twist (omega, v), optionally with the
+  /// derivatives of Pose3::Expmap, one per row of H
+  static Pose3Batch Expmap(const Vector6Batch& xi, Matrix6Batch* H = nullptr);
+
+  /// Logarithm map of every pose, optionally with derivatives as
+  /// Pose3::Logmap
+  static Vector6Batch Logmap(const Pose3Batch& poses,
+                             Matrix6Batch* H = nullptr);
+
+  /// Elementwise this[i] * other[i], optionally with derivatives as
+  /// Pose3::compose
+  Pose3Batch compose(const Pose3Batch& other, Matrix6Batch* H1 = nullptr,
+                     Matrix6Batch* H2 = nullptr) const;
+
+  /// Elementwise this[i]^-1 * other[i], optionally with derivatives as
+  /// Pose3::between
+  Pose3Batch between(const Pose3Batch& other, Matrix6Batch* H1 = nullptr,
+                     Matrix6Batch* H2 = nullptr) const;
+
+  /// Elementwise this[i] * p[i], optionally with derivatives as
+  /// Pose3::transformFrom
+  Vector3Batch transformFrom(const Vector3Batch& p,
+                             Matrix36Batch* Hself = nullptr,
+                             Matrix3Batch* Hpoint = nullptr) const;
+
+  /// Elementwise interpolate(this[i], other[i], t), as gtsam::interpolate.
+  /// There are no derivatives: chain those of the operations above instead.
+  Pose3Batch interpolate(const Pose3Batch& other, double t) const;
+
+  /// @}
+
+ private:
+  Rot3Batch R_;
+  Vector3Batch t_;
+};
+
+}  // namespace gtsam
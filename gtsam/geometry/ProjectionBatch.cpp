@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ProjectionBatch.cpp
+ * @brief   Project many points into a pinhole camera at once
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/ProjectionBatch.h>
+#include <gtsam/geometry/CalibratedCamera.h>  // for CheiralityException
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3_S2.h>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+void UncalibrateBatch(const Cal3_S2& K, const Vector2Batch& pn,
+                      Vector2Batch* pi, Matrix2Batch* Dpi_pn) {
+  const auto x = pn.col(0), y = pn.col(1);
+  pi->resize(pn.rows(), 2);
+  pi->col(0) = K.fx() * x + K.skew() * y + K.px();
+  pi->col(1) = K.fy() * y + K.py();
+  Dpi_pn->resize(pn.rows(), 4);
+  Dpi_pn->col(0).setConstant(K.fx());
+  Dpi_pn->col(1).setConstant(K.skew());
+  Dpi_pn->col(2).setZero();
+  Dpi_pn->col(3).setConstant(K.fy());
+}
+
+/* ************************************************************************* */
+// As Cal3Bundler::uncalibrate: pi = f * g * pn + (u0, v0), g = 1 + k1 r + k2 r^2
+void UncalibrateBatch(const Cal3Bundler& K, const Vector2Batch& pn,
+                      Vector2Batch* pi, Matrix2Batch* Dpi_pn) {
+  const auto x = pn.col(0), y = pn.col(1);
+  const double f = K.fx(), k1 = K.k1(), k2 = K.k2();
+  const Eigen::ArrayXd r = x.square() + y.square();
+  const Eigen::ArrayXd g = 1.0 + (k1 + k2 * r) * r;
+  pi->resize(pn.rows(), 2);
+  pi->col(0) = K.u0() + f * g * x;
+  pi->col(1) = K.v0() + f * g * y;
+
+  const Eigen::ArrayXd a = 2.0 * f * (k1 + 2.0 * k2 * r);
+  Dpi_pn->resize(pn.rows(), 4);
+  Dpi_pn->col(0) = f * g + a * x * x;
+  Dpi_pn->col(1) = a * x * y;
+  Dpi_pn->col(2) = Dpi_pn->col(1);
+  Dpi_pn->col(3) = f * g + a * y * y;
+}
+
+/* ************************************************************************* */
+// As Cal3DS2_Base::uncalibrate, with radial and tangential distortion
+void UncalibrateBatch(const Cal3DS2& K, const Vector2Batch& pn,
+                      Vector2Batch* pi, Matrix2Batch* Dpi_pn) {
+  const auto x = pn.col(0), y = pn.col(1);
+  const double k1 = K.k1(), k2 = K.k2(), p1 = K.p1(), p2 = K.p2();
+  const Eigen::ArrayXd xx = x.square(), yy = y.square(), xy = x * y;
+  const Eigen::ArrayXd rr = xx + yy;
+  const Eigen::ArrayXd g = 1.0 + (k1 + k2 * rr) * rr;
+  const Eigen::ArrayXd pnx = g * x + 2.0 * p1 * xy + p2 * (rr + 2.0 * xx);
+  const Eigen::ArrayXd pny = g * y + 2.0 * p2 * xy + p1 * (rr + 2.0 * yy);
+  pi->resize(pn.rows(), 2);
+  pi->col(0) = K.fx() * pnx + K.skew() * pny + K.px();
+  pi->col(1) = K.fy() * pny + K.py();
+
+  // DK * DR as in D2dintrinsic
+  const Eigen::ArrayXd dg = 2.0 * (k1 + 2.0 * k2 * rr);  // dg/dx = dg * x
+  const Eigen::ArrayXd cross = 2.0 * (p1 * x + p2 * y);  // dDx/dy = dDy/dx
+  const Eigen::ArrayXd DR00 = g + dg * xx + 2.0 * p1 * y + 6.0 * p2 * x;
+  const Eigen::ArrayXd DR01 = dg * xy + cross;
+  const Eigen::ArrayXd DR11 = g + dg * yy + 2.0 * p2 * x + 6.0 * p1 * y;
+  Dpi_pn->resize(pn.rows(), 4);
+  Dpi_pn->col(0) = K.fx() * DR00 + K.skew() * DR01;
+  Dpi_pn->col(1) = K.fx() * DR01 + K.skew() * DR11;
+  Dpi_pn->col(2) = K.fy() * DR01;
+  Dpi_pn->col(3) = K.fy() * DR11;
+}
+
+/* ************************************************************************* */
+void ProjectBatch(const Pose3& pose, const Vector3Batch& points,
+                  Vector2Batch* pn,
+                  Eigen::Array<double, Eigen::Dynamic, 12>* Dpose,
+                  Eigen::Array<double, Eigen::Dynamic, 6>* Dpoint) {
+  const Matrix3 R = pose.rotation().matrix();
+  const Point3& t = pose.translation();
+  const Eigen::Index m = points.rows();
+
+  // q = R^T (p - t), in camera coordinates
+  Vector3Batch q(m, 3);
+  for (int i = 0; i < 3; i++)
+    q.col(i) = R(0, i) * (points.col(0) - t.x()) +
+               R(1, i) * (points.col(1) - t.y()) +
+               R(2, i) * (points.col(2) - t.z());
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+  if ((q.col(2) <= 0).any()) throw CheiralityException();
+#endif
+  const Eigen::ArrayXd d = q.col(2).inverse();
+  pn->resize(m, 2);
+  pn->col(0) = q.col(0) * d;
+  pn->col(1) = q.col(1) * d;
+  const auto u = pn->col(0), v = pn->col(1);
+
+  // As PinholeBase::Dpose and PinholeBase::Dpoint
+  if (Dpose) {
+    Dpose->resize(m, 12);
+    Dpose->col(0) = u * v;
+    Dpose->col(1) = -1.0 - u * u;
+    Dpose->col(2) = v;
+    Dpose->col(3) = -d;
+    Dpose->col(4).setZero();
+    Dpose->col(5) = d * u;
+    Dpose->col(6) = 1.0 + v * v;
+    Dpose->col(7) = -Dpose->col(0);
+    Dpose->col(8) = -u;
+    Dpose->col(9).setZero();
+    Dpose->col(10) = -d;
+    Dpose->col(11) = d * v;
+  }
+  if (Dpoint) {
+    Dpoint->resize(m, 6);
+    for (int j = 0; j < 3; j++) {
+      Dpoint->col(j) = d * (R(j, 0) - u * R(j, 2));
+      Dpoint->col(3 + j) = d * (R(j, 1) - v * R(j, 2));
+    }
+  }
+}
+
+/* ************************************************************************* */
+void WriteProjections(const Vector2Batch& pi, const Matrix2Batch& Dpi_pn,
+                      const Eigen::Array<double, Eigen::Dynamic, 12>& Dpn_pose,
+                      const Eigen::Array<double, Eigen::Dynamic, 6>& Dpn_point,
+                      Point2* z, Matrix26* Dpose, Matrix23* Dpoint) {
+  const Eigen::Index m = pi.rows();
+  for (Eigen::Index j = 0; j < m; j++) z[j] = Point2(pi(j, 0), pi(j, 1));
+
+  // Each row of a block is a combination of both rows of the normalized one
+  const auto a = Dpi_pn.col(0), b = Dpi_pn.col(1), c = Dpi_pn.col(2),
+             e = Dpi_pn.col(3);
+  if (Dpose) {
+    for (int k = 0; k < 6; k++) {
+      const Eigen::ArrayXd row0 = a * Dpn_pose.col(k) + b * Dpn_pose.col(6 + k);
+      const Eigen::ArrayXd row1 = c * Dpn_pose.col(k) + e * Dpn_pose.col(6 + k);
+      for (Eigen::Index j = 0; j < m; j++) {
+        Dpose[j](0, k) = row0(j);
+        Dpose[j](1, k) = row1(j);
+      }
+    }
+  }
+  if (Dpoint) {
+    for (int k = 0; k < 3; k++) {
+      const Eigen::ArrayXd row0 =
+          a * Dpn_point.col(k) + b * Dpn_point.col(3 + k);
+      const Eigen::ArrayXd row1 =
+          c * Dpn_point.col(k) + e * Dpn_point.col(3 + k);
+      for (Eigen::Index j = 0; j < m; j++) {
+        Dpoint[j](0, k) = row0(j);
+        Dpoint[j](1, k) = row1(j);
+      }
+    }
+  }
+}
+
+}  // namespace gtsam
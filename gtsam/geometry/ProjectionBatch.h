@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ProjectionBatch.h
+ * @brief   Project many points into a pinhole camera at once
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/geometry/Rot3Batch.h>
+
+#include <algorithm>
+
+namespace gtsam {
+
+class Cal3_S2;
+class Cal3Bundler;
+class Cal3DS2;
+
+/// N 2-vectors, e.g., image points, one per row
+typedef Eigen::Array<double, Eigen::Dynamic, 2> Vector2Batch;
+
+/// N 2*2 matrices with the entries of each in row-major order in one row
+typedef Eigen::Array<double, Eigen::Dynamic, 4> Matrix2Batch;
+
+/**
+ * Uncalibrate all intrinsic points pn with calibration K, with the 2*2
+ * derivatives Dpi_pn of the image points with respect to them. This generic
+ * version calls K.uncalibrate point by point; the overloads for Cal3_S2,
+ * Cal3Bundler and Cal3DS2 below evaluate the same formulas as vectorized
+ * array expressions over all points.
+ */
+template <class CALIBRATION>
+void UncalibrateBatch(const CALIBRATION& K, const Vector2Batch& pn,
+                      Vector2Batch* pi, Matrix2Batch* Dpi_pn) {
+  pi->resize(pn.rows(), 2);
+  Dpi_pn->resize(pn.rows(), 4);
+  Matrix2 D;
+  for (Eigen::Index j = 0; j < pn.rows(); j++) {
+    const Point2 p = K.uncalibrate(Point2(pn(j, 0), pn(j, 1)), boost::none, D);
+    pi->row(j) << p.x(), p.y();
+    Dpi_pn->row(j) << D(0, 0), D(0, 1), D(1, 0), D(1, 1);
+  }
+}
+
+GTSAM_EXPORT void UncalibrateBatch(const Cal3_S2& K, const Vector2Batch& pn,
+                                   Vector2Batch* pi, Matrix2Batch* Dpi_pn);
+GTSAM_EXPORT void UncalibrateBatch(const Cal3Bundler& K, const Vector2Batch& pn,
+                                   Vector2Batch* pi, Matrix2Batch* Dpi_pn);
+GTSAM_EXPORT void UncalibrateBatch(const Cal3DS2& K, const Vector2Batch& pn,
+                                   Vector2Batch* pi, Matrix2Batch* Dpi_pn);
+
+/**
+ * Project all points into the normalized image plane of a camera at pose, as
+ * PinholeBase::project2, with the 2*6 derivatives with respect to the pose and
+ * the 2*3 derivatives with respect to the points, each in row-major order in
+ * one row of Dpose and Dpoint. Throws CheiralityException if any point is
+ * behind the camera and GTSAM_THROW_CHEIRALITY_EXCEPTION is defined.
+ */
+GTSAM_EXPORT void ProjectBatch(const Pose3& pose, const Vector3Batch& points,
+                               Vector2Batch* pn,
+                               Eigen::Array<double, Eigen::Dynamic, 12>* Dpose,
+                               Eigen::Array<double, Eigen::Dynamic, 6>* Dpoint);
+
+/**
+ * Chain the derivatives of UncalibrateBatch with those of ProjectBatch and
+ * write the image points and fixed-size Jacobian blocks of all points into
+ * z[j], Dpose[j] and Dpoint[j]. Dpose and Dpoint may be null.
+ */
+GTSAM_EXPORT void WriteProjections(
+    const Vector2Batch& pi, const Matrix2Batch& Dpi_pn,
+    const Eigen::Array<double, Eigen::Dynamic, 12>& Dpn_pose,
+    const Eigen::Array<double, Eigen::Dynamic, 6>& Dpn_point, Point2* z,
+    Matrix26* Dpose, Matrix23* Dpoint);
+
+/**
+ * Project all points into the camera with the given pose and calibration, as
+ * PinholePose::project2, writing the image points and the derivatives with
+ * respect to the pose and the points into the caller-provided buffers z,
+ * Dpose and Dpoint of points.rows() entries each. Dpose and Dpoint may be
+ * null. Fixed-size blocks need an aligned allocator when kept in a
+ * std::vector, see CameraSet::FBlocks.
+ */
+template <class CALIBRATION>
+void ProjectBatch(const Pose3& pose, const CALIBRATION& K,
+                  const Vector3Batch& points, Point2* z, Matrix26* Dpose,
+                  Matrix23* Dpoint) {
+  // Work on chunks of points, so that all temporaries stay in cache
+  static const Eigen::Index kChunk = 128;
+  Vector2Batch pn, pi;
+  Matrix2Batch Dpi_pn;
+  Eigen::Array<double, Eigen::Dynamic, 12> Dpn_pose;
+  Eigen::Array<double, Eigen::Dynamic, 6> Dpn_point;
+  for (Eigen::Index start = 0; start < points.rows(); start += kChunk) {
+    const Eigen::Index n = std::min(kChunk, points.rows() - start);
+    ProjectBatch(pose, points.middleRows(start, n), &pn, &Dpn_pose,
+                 &Dpn_point);
+    UncalibrateBatch(K, pn, &pi, &Dpi_pn);
+    WriteProjections(pi, Dpi_pn, Dpn_pose, Dpn_point, z + start,
+                     Dpose ? Dpose + start : nullptr,
+                     Dpoint ? Dpoint + start : nullptr);
+  }
+}
+
+}  // namespace gtsam
@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Rot3Batch.cpp
+ * @brief   Many 3D rotations at once, stored as a structure of arrays
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/Rot3Batch.h>
+
+#include <limits>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+typedef Eigen::Array<bool, Eigen::Dynamic, 1> Mask;
+
+const double kEpsilon = numeric_limits<double>::epsilon();
+
+// H = I + a * [w]x + b * (w w^T - |w|^2 I), the form of all SO(3) Jacobians
+void skewAndSquare(const Vector3Batch& w, const Eigen::ArrayXd& a,
+                   const Eigen::ArrayXd& b, Matrix3Batch* H) {
+  const auto wx = w.col(0), wy = w.col(1), wz = w.col(2);
+  const Eigen::ArrayXd xx = wx * wx, yy = wy * wy, zz = wz * wz;
+  const Eigen::ArrayXd bxy = b * wx * wy, bxz = b * wx * wz, byz = b * wy * wz;
+  H->resize(w.rows(), 9);
+  H->col(0) = 1.0 - b * (yy + zz);
+  H->col(1) = bxy - a * wz;
+  H->col(2) = bxz + a * wy;
+  H->col(3) = bxy + a * wz;
+  H->col(4) = 1.0 - b * (xx + zz);
+  H->col(5) = byz - a * wx;
+  H->col(6) = bxz - a * wy;
+  H->col(7) = byz + a * wx;
+  H->col(8) = 1.0 - b * (xx + yy);
+}
+}  // namespace
+
+/* ************************************************************************* */
+Rot3Batch::Rot3Batch(const vector<Rot3>& rotations) : R_(rotations.size(), 9) {
+  for (size_t i = 0; i < rotations.size(); i++) {
+    const Matrix3 M = rotations[i].matrix();
+    for (int k = 0; k < 9; k++) R_(i, k) = M(k / 3, k % 3);
+  }
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::Identity(size_t n) {
+  Rot3Batch result(n);
+  result.R_.setZero();
+  result.R_.col(0).setOnes();
+  result.R_.col(4).setOnes();
+  result.R_.col(8).setOnes();
+  return result;
+}
+
+/* ************************************************************************* */
+Rot3 Rot3Batch::at(size_t i) const {
+  Matrix3 M;
+  for (int k = 0; k < 9; k++) M(k / 3, k % 3) = R_(i, k);
+  return Rot3(M);
+}
+
+/* ************************************************************************* */
+vector<Rot3> Rot3Batch::rotations() const {
+  vector<Rot3> result;
+  result.reserve(size());
+  for (size_t i = 0; i < size(); i++) result.push_back(at(i));
+  return result;
+}
+
+/* ************************************************************************* */
+// R = I + A * W + B * W^2 with A = sin(t)/t, B = (1 - cos(t))/t^2, and
+// dexp = I - B * W + C * W^2 with C = (t - sin(t))/t^3, as in DexpFunctor.
+Rot3Batch Rot3Batch::Expmap(const Vector3Batch& omega, Matrix3Batch* H) {
+  const Eigen::Index n = omega.rows();
+  const Eigen::ArrayXd theta2 = omega.square().rowwise().sum();
+  const Mask nearZero = theta2 <= kEpsilon;
+  const Eigen::ArrayXd theta = nearZero.select(1.0, theta2.sqrt());
+  const Eigen::ArrayXd sinTheta = theta.sin(), sinHalf = (0.5 * theta).sin();
+  const Eigen::ArrayXd oneMinusCos = 2.0 * sinHalf * sinHalf;
+  const Eigen::ArrayXd zeros = Eigen::ArrayXd::Zero(n);
+
+  Rot3Batch result(n);
+  const Eigen::ArrayXd A = nearZero.select(1.0, sinTheta / theta);
+  const Eigen::ArrayXd B = oneMinusCos / theta.square();
+  skewAndSquare(omega, A, nearZero.select(zeros, B), &result.R_);
+
+  if (H) {
+    const Eigen::ArrayXd C = (theta - sinTheta) / theta.cube();
+    skewAndSquare(omega, nearZero.select(-0.5, -B), nearZero.select(zeros, C),
+                  H);
+  }
+  return result;
+}
+
+/* ************************************************************************* */
+Vector3Batch Rot3Batch::Logmap(const Rot3Batch& R, Matrix3Batch* H) {
+  const Matrix3Batch& M = R.R_;
+  const Eigen::Index n = M.rows();
+  const Eigen::ArrayXd tr = M.col(0) + M.col(4) + M.col(8);
+  const Eigen::ArrayXd tr_3 = tr - 3.0;
+
+  // Magnitude as in SO3::Logmap, with a Taylor expansion near the identity
+  const Mask general = tr_3 < -1e-7;
+  const Eigen::ArrayXd c = (0.5 * (tr - 1.0)).max(-1.0).min(1.0);
+  const Eigen::ArrayXd theta = general.select(c.acos(), 1.0);
+  const Eigen::ArrayXd magnitude = general.select(
+      theta / (2.0 * theta.sin()), 0.5 - tr_3 * tr_3 / 12.0);
+
+  Vector3Batch omega(n, 3);
+  omega.col(0) = magnitude * (M.col(7) - M.col(5));
+  omega.col(1) = magnitude * (M.col(2) - M.col(6));
+  omega.col(2) = magnitude * (M.col(3) - M.col(1));
+
+  // Angles near pi need the special cases of the scalar version
+  for (Eigen::Index i = 0; i < n; i++)
+    if (tr(i) + 1.0 < 1e-10)
+      omega.row(i) = Rot3::Logmap(R.at(i)).transpose().array();
+
+  if (H) {
+    // As SO3::LogmapDerivative: I + W/2 + (1/t^2 - (1+cos t)/(2t sin t)) W^2
+    const Eigen::ArrayXd theta2 = omega.square().rowwise().sum();
+    const Mask nearZero = theta2 <= kEpsilon;
+    const Eigen::ArrayXd t = nearZero.select(1.0, theta2.sqrt());
+    const Eigen::ArrayXd D =
+        1.0 / t.square() - (1.0 + t.cos()) / (2.0 * t * t.sin());
+    const Eigen::ArrayXd zeros = Eigen::ArrayXd::Zero(n);
+    skewAndSquare(omega, nearZero.select(zeros, Eigen::ArrayXd::Constant(n, 0.5)),
+                  nearZero.select(zeros, D), H);
+  }
+  return omega;
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::compose(const Rot3Batch& other) const {
+  const Matrix3Batch &A = R_, &B = other.R_;
+  Rot3Batch result(size());
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      result.R_.col(3 * i + j) = A.col(3 * i) * B.col(j) +
+                                 A.col(3 * i + 1) * B.col(3 + j) +
+                                 A.col(3 * i + 2) * B.col(6 + j);
+  return result;
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::between(const Rot3Batch& other) const {
+  const Matrix3Batch &A = R_, &B = other.R_;
+  Rot3Batch result(size());
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      result.R_.col(3 * i + j) = A.col(i) * B.col(j) +
+                                 A.col(3 + i) * B.col(3 + j) +
+                                 A.col(6 + i) * B.col(6 + j);
+  return result;
+}
+
+/* ************************************************************************* */
+Vector3Batch Rot3Batch::rotate(const Vector3Batch& p) const {
+  Vector3Batch result(size(), 3);
+  for (int i = 0; i < 3; i++)
+    result.col(i) = R_.col(3 * i) * p.col(0) + R_.col(3 * i + 1) * p.col(1) +
+                    R_.col(3 * i + 2) * p.col(2);
+  return result;
+}
+
+/* ************************************************************************* */
+Vector3Batch Rot3Batch::unrotate(const Vector3Batch& p) const {
+  Vector3Batch result(size(), 3);
+  for (int i = 0; i < 3; i++)
+    result.col(i) = R_.col(i) * p.col(0) + R_.col(3 + i) * p.col(1) +
+                    R_.col(6 + i) * p.col(2);
+  return result;
+}
+
+/* ************************************************************************* */
+Vector3Batch cross(const Vector3Batch& a, const Vector3Batch& b) {
+  Vector3Batch result(a.rows(), 3);
+  result.col(0) = a.col(1) * b.col(2) - a.col(2) * b.col(1);
+  result.col(1) = a.col(2) * b.col(0) - a.col(0) * b.col(2);
+  result.col(2) = a.col(0) * b.col(1) - a.col(1) * b.col(0);
+  return result;
+}
+
+}  // namespace gtsam
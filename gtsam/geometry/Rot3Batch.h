@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Rot3Batch.h
+ * @brief   Many 3D rotations at once, stored as a structure of arrays
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Rot3.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/// N 3-vectors, e.g., tangent vectors or points, one per row
+typedef Eigen::Array<double, Eigen::Dynamic, 3> Vector3Batch;
+
+/// N 6-vectors, e.g., twists, one per row
+typedef Eigen::Array<double, Eigen::Dynamic, 6> Vector6Batch;
+
+/// N 3*3 matrices, e.g., Jacobians, with the entries of each in row-major
+/// order in one row
+typedef Eigen::Array<double, Eigen::Dynamic, 9> Matrix3Batch;
+
+/**
+ * N rotations, stored as a Matrix3Batch so that each entry of the rotation
+ * matrices is contiguous in memory. The kernels below are written as Eigen
+ * array expressions on those columns, which Eigen vectorizes for the SIMD
+ * instruction set the library is compiled for, e.g. AVX2 with
+ * GTSAM_BUILD_WITH_MARCH_NATIVE, and evaluates elementwise otherwise. They
+ * follow the SO(3) formulas of SO3.cpp, so the results agree with the single
+ * element versions up to round-off.
+ */
+class GTSAM_EXPORT Rot3Batch {
+ public:
+  /// @name Constructors
+  /// @{
+
+  /// Uninitialized batch of n rotations
+  explicit Rot3Batch(size_t n = 0) : R_(n, 9) {}
+
+  /// Batch from rotation matrix entries, one rotation per row
+  explicit Rot3Batch(const Matrix3Batch& R) : R_(R) {}
+
+  /// Copy rotations into a batch
+  explicit Rot3Batch(const std::vector<Rot3>& rotations);
+
+  /// N identity rotations
+  static Rot3Batch Identity(size_t n);
+
+  /// @}
+  /// @name Access
+  /// @{
+
+  size_t size() const { return R_.rows(); }  ///< number of rotations
+
+  /// Rotation matrix entries, one rotation per row
+  const Matrix3Batch& matrices() const { return R_; }
+  Matrix3Batch& matrices() { return R_; }
+
+  /// The i-th rotation
+  Rot3 at(size_t i) const;
+
+  /// Copy all rotations out of the batch
+  std::vector<Rot3> rotations() const;
+
+  /// @}
+  /// @name Lie group
+  /// @{
+
+  /// Exponential map of every row of omega, optionally with the derivatives
+  /// of Rot3::Expmap, one per row of H
+  static Rot3Batch Expmap(const Vector3Batch& omega, Matrix3Batch* H = nullptr);
+
+  /// Logarithm map of every rotation, optionally with derivatives as
+  /// Rot3::Logmap. Rotations by angles near pi use Rot3::Logmap itself.
+  static Vector3Batch Logmap(const Rot3Batch& R, Matrix3Batch* H = nullptr);
+
+  /// Elementwise this[i] * other[i]
+  Rot3Batch compose(const Rot3Batch& other) const;
+
+  /// Elementwise this[i]^T * other[i]
+  Rot3Batch between(const Rot3Batch& other) const;
+
+  /// Elementwise this[i] * p[i]
+  Vector3Batch rotate(const Vector3Batch& p) const;
+
+  /// Elementwise this[i]^T * p[i]
+  Vector3Batch unrotate(const Vector3Batch& p) const;
+
+  /// @}
+
+ private:
+  Matrix3Batch R_;
+};
+
+/// Elementwise cross products of two batches of 3-vectors
+GTSAM_EXPORT Vector3Batch cross(const Vector3Batch& a, const Vector3Batch& b);
+
+}  // namespace gtsam
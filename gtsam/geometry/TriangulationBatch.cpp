@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    TriangulationBatch.cpp
+ * @brief   Triangulate many tracks at once, in parallel
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/TriangulationBatch.h>
+
+#include <cmath>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+void TriangulationDLT::add(const Matrix34& P, const Point2& z) {
+  for (int k = 0; k < 2; k++) {
+    // Same rows as triangulateHomogeneousDLT
+    Eigen::Matrix<double, 1, 4> a = z(k) * P.row(2) - P.row(k);
+
+    // Rotate the row into R, zeroing it one entry at a time
+    for (int j = 0; j < 4; j++) {
+      if (a(j) == 0) continue;
+      const double r = std::hypot(R_(j, j), a(j));
+      const double c = R_(j, j) / r, s = a(j) / r;
+      for (int l = j; l < 4; l++) {
+        const double Rjl = R_(j, l);
+        R_(j, l) = c * Rjl + s * a(l);
+        a(l) = c * a(l) - s * Rjl;
+      }
+    }
+  }
+}
+
+/* ************************************************************************* */
+int TriangulationDLT::solve(double rank_tol, Vector4* v) const {
+  const Eigen::JacobiSVD<Matrix4> svd(R_, Eigen::ComputeFullV);
+  const Vector4& s = svd.singularValues();
+  *v = svd.matrixV().col(3);
+  return (s.array() > rank_tol).count();
+}
+
+}  // namespace gtsam
@@ -0,0 +1,249 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    TriangulationBatch.h
+ * @brief   Triangulate many tracks at once, in parallel
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/triangulation.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The DLT system of one point, accumulated in fixed-size storage. Each pair
+ * of equations is rotated into a 4*4 upper-triangular factor R of the 2m*4
+ * DLT matrix A with Givens rotations, so R has the singular values and right
+ * singular vectors of A, and solve needs only a 4*4 SVD. No memory is
+ * allocated, so one object can be reused for any number of points.
+ */
+class GTSAM_EXPORT TriangulationDLT {
+ public:
+  TriangulationDLT() : R_(Matrix4::Zero()) {}
+
+  /// Start over with a new point
+  void reset() { R_.setZero(); }
+
+  /// Add the two equations z x (P * X) = 0 of one measurement
+  void add(const Matrix34& P, const Point2& z);
+
+  /**
+   * Solve as triangulateHomogeneousDLT
+   * @param rank_tol SVD rank tolerance
+   * @param v homogeneous point, the right singular vector of the smallest
+   *        singular value
+   * @return the number of singular values larger than rank_tol
+   */
+  int solve(double rank_tol, Vector4* v) const;
+
+ private:
+  Matrix4 R_;
+};
+
+/**
+ * Triangulates many points, or tracks, observed in a common set of cameras,
+ * with the same checks and outcomes as triangulateSafe. The projection
+ * matrices of all cameras are computed once, in the constructor, and each
+ * track is then triangulated without allocating memory: by a TriangulationDLT
+ * and, if params.enableEPI is set, a few Gauss-Newton iterations on the
+ * reprojection error of the 3-dof point instead of a LevenbergMarquardt
+ * optimization of a TriangulationFactor graph. Tracks are processed in
+ * parallel when GTSAM is built with TBB.
+ *
+ * The tracks are given in compressed form: the observations of track k are
+ * at positions offsets[k] to offsets[k+1]-1 of cameraIndices, which index
+ * into the cameras, and of measurements.
+ */
+template <class CAMERA>
+class BatchTriangulator {
+ public:
+  typedef CameraSet<CAMERA> Cameras;
+
+  /// Gauss-Newton iterations at most, when refining
+  static const int kMaxIterations = 10;
+
+  BatchTriangulator(const Cameras& cameras,
+                    const TriangulationParameters& params)
+      : cameras_(cameras), params_(params) {
+    projectionMatrices_.reserve(cameras.size());
+    for (const CAMERA& camera : cameras)
+      projectionMatrices_.push_back(
+          CameraProjectionMatrix<typename CAMERA::CalibrationType>(
+              camera.calibration())(camera.pose()));
+  }
+
+  const Cameras& cameras() const { return cameras_; }
+  const TriangulationParameters& params() const { return params_; }
+
+  /// Triangulate all tracks, see the class documentation for the layout.
+  /// Throws std::invalid_argument if the offsets decrease or run past the
+  /// observations, or if a camera index is out of range.
+  std::vector<TriangulationResult> triangulate(
+      const std::vector<size_t>& offsets,
+      const std::vector<size_t>& cameraIndices,
+      const Point2Vector& measurements) const {
+    const size_t n = offsets.empty() ? 0 : offsets.size() - 1;
+    for (size_t k = 0; k < n; k++)
+      if (offsets[k] > offsets[k + 1])
+        throw std::invalid_argument(
+            "BatchTriangulator::triangulate: offsets must not decrease");
+    if (n > 0 && (offsets[n] > cameraIndices.size() ||
+                  offsets[n] > measurements.size()))
+      throw std::invalid_argument(
+          "BatchTriangulator::triangulate: offsets past the observations");
+    for (size_t i = 0; i < (n > 0 ? offsets[n] : 0); i++)
+      if (cameraIndices[i] >= cameras_.size())
+        throw std::invalid_argument(
+            "BatchTriangulator::triangulate: camera index out of range");
+    std::vector<TriangulationResult> results(n);
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        TriangulationDLT dlt;
+                        for (size_t k = r.begin(); k != r.end(); ++k)
+                          results[k] = triangulateTrack(
+                              offsets[k + 1] - offsets[k],
+                              cameraIndices.data() + offsets[k],
+                              measurements.data() + offsets[k], &dlt);
+                      });
+#else
+    TriangulationDLT dlt;
+    for (size_t k = 0; k < n; k++)
+      results[k] = triangulateTrack(offsets[k + 1] - offsets[k],
+                                    cameraIndices.data() + offsets[k],
+                                    measurements.data() + offsets[k], &dlt);
+#endif
+    return results;
+  }
+
+  /// Triangulate a single track of m observations, using dlt as workspace.
+  /// The camera indices are not checked.
+  TriangulationResult triangulateTrack(size_t m, const size_t* cameraIndices,
+                                       const Point2* measurements,
+                                       TriangulationDLT* dlt) const {
+    if (m < 2) return TriangulationResult::Degenerate();
+
+    dlt->reset();
+    for (size_t i = 0; i < m; i++)
+      dlt->add(projectionMatrices_[cameraIndices[i]], measurements[i]);
+    Vector4 v;
+    if (dlt->solve(params_.rankTolerance, &v) < 3)
+      return TriangulationResult::Degenerate();
+    Point3 point(v.head<3>() / v[3]);
+
+    if (params_.enableEPI) point = refine(m, cameraIndices, measurements, point);
+
+    // The checks of triangulatePoint3 and triangulateSafe
+    double maxReprojError = 0.0;
+    for (size_t i = 0; i < m; i++) {
+      const CAMERA& camera = cameras_[cameraIndices[i]];
+      const Pose3& pose = camera.pose();
+      if (params_.landmarkDistanceThreshold > 0 &&
+          distance3(pose.translation(), point) >
+              params_.landmarkDistanceThreshold)
+        return TriangulationResult::FarPoint();
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+      if (pose.transformTo(point).z() <= 0)
+        return TriangulationResult::BehindCamera();
+#endif
+      if (params_.dynamicOutlierRejectionThreshold > 0)
+        maxReprojError =
+            std::max(maxReprojError,
+                     (camera.project(point) - measurements[i]).norm());
+    }
+    if (params_.dynamicOutlierRejectionThreshold > 0 &&
+        maxReprojError > params_.dynamicOutlierRejectionThreshold)
+      return TriangulationResult::Outlier();
+    return TriangulationResult(point);
+  }
+
+ private:
+  /// Sum of squared reprojection errors, infinite if behind a camera
+  double error(size_t m, const size_t* cameraIndices,
+               const Point2* measurements, const Point3& point) const {
+    double sum = 0;
+    for (size_t i = 0; i < m; i++) {
+      const CAMERA& camera = cameras_[cameraIndices[i]];
+      if (camera.pose().transformTo(point).z() <= 0)
+        return std::numeric_limits<double>::infinity();
+      sum += (camera.project2(point) - measurements[i]).squaredNorm();
+    }
+    return sum;
+  }
+
+  /// Gauss-Newton on the 3*3 normal equations, halving steps that fail
+  Point3 refine(size_t m, const size_t* cameraIndices,
+                const Point2* measurements, Point3 point) const {
+    double currentError = error(m, cameraIndices, measurements, point);
+    if (!std::isfinite(currentError)) return point;
+    for (int iteration = 0; iteration < kMaxIterations; iteration++) {
+      Matrix3 H = Matrix3::Zero();
+      Vector3 g = Vector3::Zero();
+      for (size_t i = 0; i < m; i++) {
+        Matrix23 J;
+        const Point2 e =
+            cameras_[cameraIndices[i]].project2(point, boost::none, J) -
+            measurements[i];
+        H.noalias() += J.transpose() * J;
+        g.noalias() += J.transpose() * e;
+      }
+      Vector3 delta = -H.ldlt().solve(g);
+      bool improved = false;
+      for (int halving = 0; halving < 5 && !improved; halving++, delta *= 0.5) {
+        const Point3 candidate = point + delta;
+        const double candidateError =
+            error(m, cameraIndices, measurements, candidate);
+        if (candidateError < currentError) {
+          improved = true;
+          point = candidate;
+          const double decrease = currentError - candidateError;
+          currentError = candidateError;
+          if (decrease <= 1e-10 * currentError) return point;
+        }
+      }
+      if (!improved) break;
+    }
+    return point;
+  }
+
+  Cameras cameras_;
+  TriangulationParameters params_;
+  std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>> projectionMatrices_;
+};
+
+/**
+ * Triangulate all tracks in parallel with a BatchTriangulator, see there for
+ * the layout of the tracks.
+ */
+template <class CAMERA>
+std::vector<TriangulationResult> triangulateSafeBatch(
+    const CameraSet<CAMERA>& cameras, const std::vector<size_t>& offsets,
+    const std::vector<size_t>& cameraIndices, const Point2Vector& measurements,
+    const TriangulationParameters& params) {
+  return BatchTriangulator<CAMERA>(cameras, params)
+      .triangulate(offsets, cameraIndices, measurements);
+}
+
+}  // namespace gtsam
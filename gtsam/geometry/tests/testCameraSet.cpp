@@ -162,6 +162,59 @@ TEST(CameraSet, Stereo) {
   EXPECT(assert_equal(actualE, E));
 }
 
+/* ************************************************************************* */
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3Unified.h>
+#include <gtsam/geometry/Cal3_S2.h>
+namespace {
+// Check projectBatch against project, point by point
+template <class CALIBRATION>
+bool checkProjectBatch(const CALIBRATION& K) {
+  typedef PinholeCamera<CALIBRATION> Camera;
+  CameraSet<Camera> set;
+  set.emplace_back(Pose3(Rot3::Ypr(0.1, -0.2, 0.3), Point3(0.5, -1, -4)), K);
+  set.emplace_back(Pose3(Rot3::Ypr(-0.3, 0.2, 0.1), Point3(-1, 0.5, -5)), K);
+
+  const size_t m = 7;
+  Vector3Batch points(m, 3);
+  for (size_t j = 0; j < m; j++)
+    points.row(j) << 0.3 * j - 1.0, 0.5 - 0.2 * j, 0.1 * j;
+
+  vector<Point2> z(2 * m);
+  vector<Matrix26, Eigen::aligned_allocator<Matrix26> > Dpose(2 * m);
+  vector<Matrix23, Eigen::aligned_allocator<Matrix23> > Dpoint(2 * m);
+  set.projectBatch(points, z.data(), Dpose.data(), Dpoint.data());
+
+  bool ok = true;
+  for (size_t i = 0; i < 2; i++)
+    for (size_t j = 0; j < m; j++) {
+      Matrix26 H1;
+      Matrix23 H2;
+      const Point3 p(points(j, 0), points(j, 1), points(j, 2));
+      const Point2 expected = set[i].project(p, H1, H2);
+      ok &= assert_equal(expected, z[i * m + j], 1e-9);
+      ok &= assert_equal(H1, Dpose[i * m + j], 1e-9);
+      ok &= assert_equal(H2, Dpoint[i * m + j], 1e-9);
+    }
+
+  // Without derivatives
+  vector<Point2> z2(2 * m);
+  set.projectBatch(points, z2.data());
+  for (size_t k = 0; k < 2 * m; k++) ok &= assert_equal(z[k], z2[k]);
+  return ok;
+}
+}  // namespace
+
+TEST(CameraSet, ProjectBatch) {
+  EXPECT(checkProjectBatch(Cal3_S2(500, 480, 0.1, 320, 240)));
+  EXPECT(checkProjectBatch(Cal3Bundler(500, 0.1, -0.05, 320, 240)));
+  EXPECT(checkProjectBatch(
+      Cal3DS2(500, 480, 0.1, 320, 240, 0.1, -0.05, 0.001, -0.002)));
+  // Generic version
+  EXPECT(checkProjectBatch(
+      Cal3Unified(500, 480, 0.1, 320, 240, 0.1, -0.05, 0.001, -0.002, 0.3)));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
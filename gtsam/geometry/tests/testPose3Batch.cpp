@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testPose3Batch.cpp
+ * @brief   Unit tests for batches of poses
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/Pose3Batch.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/base/numericalDerivative.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Twists with zero, tiny and large rotations
+Vector6Batch someTwists() {
+  Vector6Batch xi(5, 6);
+  xi << 0, 0, 0, 1, 2, 3,           //
+      1e-9, 0, -1e-9, 0.5, 0, 0,    //
+      0.1, 0.2, 0.3, -1, 0.5, 2,    //
+      -1.0, 0.5, 2.0, 0.1, 0.2, 0.3,  //
+      0, 0, 3.0, 1, 1, 1;
+  return xi;
+}
+
+// The i-th matrix of a batch of row-major matrices
+template <int M, int N, class BATCH>
+Eigen::Matrix<double, M, N> matrixAt(const BATCH& H, Eigen::Index i) {
+  Eigen::Matrix<double, M, N> result;
+  for (int k = 0; k < M * N; k++) result(k / N, k % N) = H(i, k);
+  return result;
+}
+
+// A batch with one twist or pose
+Vector6Batch batch(const Vector6& xi) { return xi.transpose().array(); }
+Pose3Batch batch(const Pose3& pose) { return Pose3Batch({pose}); }
+}  // namespace
+
+/* ************************************************************************* */
+TEST(Pose3Batch, ExpmapLogmap) {
+  const Vector6Batch xi = someTwists();
+  const Pose3Batch poses = Pose3Batch::Expmap(xi);
+  const Vector6Batch log = Pose3Batch::Logmap(poses);
+  for (Eigen::Index i = 0; i < xi.rows(); i++) {
+    const Pose3 expected = Pose3::Expmap(xi.row(i).transpose());
+    EXPECT(assert_equal(expected, poses.at(i), 1e-12));
+    EXPECT(assert_equal(Pose3::Logmap(expected),
+                        Vector6(log.row(i).transpose()), 1e-9));
+  }
+  EXPECT(assert_equal(poses.poses()[3], Pose3Batch(poses.poses()).at(3)));
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, composeBetweenInterpolate) {
+  const Pose3Batch T1 = Pose3Batch::Expmap(someTwists());
+  const Pose3Batch T2 = Pose3Batch::Expmap(0.3 * someTwists().colwise().reverse());
+  const Pose3Batch compose = T1.compose(T2), between = T1.between(T2);
+  const Pose3Batch middle = T1.interpolate(T2, 0.4);
+  const Vector3Batch p = T2.translations();
+  const Vector3Batch transformed = T1.transformFrom(p);
+  for (size_t i = 0; i < T1.size(); i++) {
+    EXPECT(assert_equal(T1.at(i) * T2.at(i), compose.at(i), 1e-12));
+    EXPECT(assert_equal(T1.at(i).between(T2.at(i)), between.at(i), 1e-12));
+    EXPECT(assert_equal(gtsam::interpolate(T1.at(i), T2.at(i), 0.4),
+                        middle.at(i), 1e-9));
+    EXPECT(assert_equal(T1.at(i).transformFrom(Point3(p.row(i).transpose())),
+                        Point3(transformed.row(i).transpose()), 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, ExpmapLogmapDerivatives) {
+  const Vector6Batch xi = someTwists();
+  Matrix6Batch Hexp, Hlog;
+  const Pose3Batch poses = Pose3Batch::Expmap(xi, &Hexp);
+  Pose3Batch::Logmap(poses, &Hlog);
+
+  boost::function<Pose3(const Vector6&)> expmap = [](const Vector6& x) {
+    return Pose3Batch::Expmap(batch(x)).at(0);
+  };
+  boost::function<Vector6(const Pose3&)> logmap = [](const Pose3& T) {
+    return Vector6(Pose3Batch::Logmap(batch(T)).row(0).transpose());
+  };
+  for (Eigen::Index i = 0; i < xi.rows(); i++) {
+    const Vector6 x = xi.row(i).transpose();
+    // Near the identity the translation of Expmap divides by |w|^2, which is
+    // too noisy to difference numerically, so compare with Pose3 there
+    if (x.head<3>().norm() > 1e-3)
+      EXPECT(assert_equal(numericalDerivative11(expmap, x),
+                          matrixAt<6, 6>(Hexp, i), 1e-7));
+    EXPECT(assert_equal(Pose3::ExpmapDerivative(x), matrixAt<6, 6>(Hexp, i),
+                        1e-9));
+    EXPECT(assert_equal(numericalDerivative11(logmap, poses.at(i)),
+                        matrixAt<6, 6>(Hlog, i), 1e-7));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, composeBetweenTransformDerivatives) {
+  const Pose3Batch T1 = Pose3Batch::Expmap(someTwists());
+  const Pose3Batch T2 = Pose3Batch::Expmap(0.3 * someTwists().colwise().reverse());
+  const Vector3Batch p = T2.translations();
+  Matrix6Batch Hc1, Hc2, Hb1, Hb2;
+  Matrix36Batch Hself;
+  Matrix3Batch Hpoint;
+  T1.compose(T2, &Hc1, &Hc2);
+  T1.between(T2, &Hb1, &Hb2);
+  T1.transformFrom(p, &Hself, &Hpoint);
+
+  boost::function<Pose3(const Pose3&, const Pose3&)> compose =
+      [](const Pose3& A, const Pose3& B) {
+        return batch(A).compose(batch(B)).at(0);
+      };
+  boost::function<Pose3(const Pose3&, const Pose3&)> between =
+      [](const Pose3& A, const Pose3& B) {
+        return batch(A).between(batch(B)).at(0);
+      };
+  boost::function<Point3(const Pose3&, const Point3&)> transformFrom =
+      [](const Pose3& A, const Point3& q) {
+        Vector3Batch qs(1, 3);
+        qs.row(0) = q.transpose().array();
+        return Point3(batch(A).transformFrom(qs).row(0).transpose());
+      };
+  for (size_t i = 0; i < T1.size(); i++) {
+    const Pose3 A = T1.at(i), B = T2.at(i);
+    const Point3 q = p.row(i).transpose();
+    EXPECT(assert_equal(numericalDerivative21(compose, A, B),
+                        matrixAt<6, 6>(Hc1, i), 1e-7));
+    EXPECT(assert_equal(numericalDerivative22(compose, A, B),
+                        matrixAt<6, 6>(Hc2, i), 1e-7));
+    EXPECT(assert_equal(numericalDerivative21(between, A, B),
+                        matrixAt<6, 6>(Hb1, i), 1e-7));
+    EXPECT(assert_equal(numericalDerivative22(between, A, B),
+                        matrixAt<6, 6>(Hb2, i), 1e-7));
+    EXPECT(assert_equal(numericalDerivative21(transformFrom, A, q),
+                        matrixAt<3, 6>(Hself, i), 1e-7));
+    EXPECT(assert_equal(numericalDerivative22(transformFrom, A, q),
+                        matrixAt<3, 3>(Hpoint, i), 1e-7));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testRot3Batch.cpp
+ * @brief   Unit tests for batches of rotations
+ * @date    October 2026
+ */
+
+#include <gtsam/geometry/Rot3Batch.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Tangent vectors of all sizes, including zero, tiny, and near pi
+Vector3Batch someTangents() {
+  Vector3Batch omega(8, 3);
+  omega << 0, 0, 0,                   //
+      1e-9, -2e-9, 1e-9,              //
+      1e-4, 2e-4, -3e-4,              //
+      0.1, 0.2, 0.3,                  //
+      -1.0, 0.5, 2.0,                 //
+      0, 0, M_PI - 1e-6,              //
+      M_PI / sqrt(2), M_PI / sqrt(2), 0,  //
+      0.3, -2.5, 1.0;
+  return omega;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(Rot3Batch, conversions) {
+  const vector<Rot3> rotations{Rot3(), Rot3::Ypr(0.1, 0.2, 0.3),
+                               Rot3::Rodrigues(-1, 0.5, 2)};
+  const Rot3Batch batch(rotations);
+  EXPECT_LONGS_EQUAL(3, batch.size());
+  for (size_t i = 0; i < 3; i++)
+    EXPECT(assert_equal(rotations[i], batch.rotations()[i]));
+  EXPECT(assert_equal(Rot3(), Rot3Batch::Identity(2).at(1)));
+}
+
+/* ************************************************************************* */
+TEST(Rot3Batch, Expmap) {
+  const Vector3Batch omega = someTangents();
+  Matrix3Batch H;
+  const Rot3Batch R = Rot3Batch::Expmap(omega, &H);
+  for (Eigen::Index i = 0; i < omega.rows(); i++) {
+    const Vector3 w = omega.row(i).transpose();
+    Matrix3 expectedH;
+    EXPECT(assert_equal(Rot3::Expmap(w, expectedH), R.at(i), 1e-12));
+    const Matrix3 actualH = Rot3Batch(H).at(i).matrix();
+    EXPECT(assert_equal(expectedH, actualH, 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Rot3Batch, Logmap) {
+  Vector3Batch omega = someTangents();
+  omega.row(5) << 0, 0, M_PI;  // exactly pi takes the scalar path
+  const Rot3Batch R = Rot3Batch::Expmap(omega);
+  Matrix3Batch H;
+  const Vector3Batch actual = Rot3Batch::Logmap(R, &H);
+  for (Eigen::Index i = 0; i < omega.rows(); i++) {
+    Matrix3 expectedH;
+    const Vector3 expected = Rot3::Logmap(R.at(i), expectedH);
+    EXPECT(assert_equal(expected, Vector3(actual.row(i).transpose()), 1e-9));
+    EXPECT(assert_equal(expectedH, Rot3Batch(H).at(i).matrix(), 1e-7));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Rot3Batch, composeAndRotate) {
+  const Rot3Batch R1 = Rot3Batch::Expmap(someTangents());
+  const Rot3Batch R2 = Rot3Batch::Expmap(0.5 * someTangents().colwise().reverse());
+  const Rot3Batch compose = R1.compose(R2), between = R1.between(R2);
+  Vector3Batch p = someTangents() + 1.0;
+  const Vector3Batch rotated = R1.rotate(p), unrotated = R1.unrotate(p);
+  for (size_t i = 0; i < R1.size(); i++) {
+    EXPECT(assert_equal(R1.at(i) * R2.at(i), compose.at(i), 1e-12));
+    EXPECT(assert_equal(R1.at(i).between(R2.at(i)), between.at(i), 1e-12));
+    const Point3 pi = p.row(i).transpose();
+    EXPECT(assert_equal(R1.at(i).rotate(pi), Point3(rotated.row(i).transpose()), 1e-12));
+    EXPECT(assert_equal(R1.at(i).unrotate(pi), Point3(unrotated.row(i).transpose()), 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -17,6 +17,7 @@
  */
 
 #include <gtsam/geometry/triangulation.h>
+#include <gtsam/geometry/TriangulationBatch.h>
 #include <gtsam/geometry/PinholeCamera.h>
 #include <gtsam/geometry/StereoCamera.h>
 #include <gtsam/geometry/CameraSet.h>
@@ -432,6 +433,122 @@ TEST( triangulation, StereotriangulateNonlinear ) {
   }
 }
 
+//******************************************************************************
+namespace {
+// Compare triangulateSafeBatch with triangulateSafe, track by track
+bool checkBatch(const CameraSet<PinholeCamera<Cal3_S2> >& cameras,
+                const vector<size_t>& offsets, const vector<size_t>& indices,
+                const Point2Vector& measurements,
+                const TriangulationParameters& params, double tol) {
+  const vector<TriangulationResult> actual =
+      triangulateSafeBatch(cameras, offsets, indices, measurements, params);
+  bool ok = actual.size() + 1 == offsets.size();
+  for (size_t k = 0; ok && k < actual.size(); k++) {
+    CameraSet<PinholeCamera<Cal3_S2> > trackCameras;
+    Point2Vector trackMeasurements;
+    for (size_t i = offsets[k]; i < offsets[k + 1]; i++) {
+      trackCameras.push_back(cameras[indices[i]]);
+      trackMeasurements.push_back(measurements[i]);
+    }
+    const TriangulationResult expected =
+        triangulateSafe(trackCameras, trackMeasurements, params);
+    ok &= expected.valid() == actual[k].valid() &&
+          expected.degenerate() == actual[k].degenerate() &&
+          expected.outlier() == actual[k].outlier() &&
+          expected.farPoint() == actual[k].farPoint() &&
+          expected.behindCamera() == actual[k].behindCamera();
+    if (ok && expected) ok &= assert_equal(*expected, *actual[k], tol);
+  }
+  return ok;
+}
+}  // namespace
+
+TEST( triangulation, batch) {
+  const Cal3_S2 K2(1600, 1300, 0, 650, 440), K3(700, 500, 0, 640, 480);
+  const Pose3 pose3 =
+      pose1 * Pose3(Rot3::Ypr(0.1, 0.2, 0.1), Point3(0.1, -2, -.1));
+  CameraSet<PinholeCamera<Cal3_S2> > cameras;
+  cameras += camera1, PinholeCamera<Cal3_S2>(pose2, K2),
+      PinholeCamera<Cal3_S2>(pose3, K3), camera1;
+
+  // Tracks: exact, noisy, with an outlier, single view, and identical poses
+  const Point3 landmark2(7, -0.5, 0.8);
+  vector<size_t> offsets, indices;
+  Point2Vector measurements;
+  auto addTrack = [&](const vector<size_t>& views, const Point3& point,
+                      const Point2Vector& noise) {
+    offsets.push_back(indices.size());
+    for (size_t i = 0; i < views.size(); i++) {
+      indices.push_back(views[i]);
+      measurements.push_back(cameras[views[i]].project2(point) + noise[i]);
+    }
+  };
+  const Point2 zero(0, 0);
+  addTrack({0, 1}, landmark, {zero, zero});
+  addTrack({0, 1, 2}, landmark2, {Point2(0.5, -0.3), zero, Point2(-0.2, 0.4)});
+  addTrack({0, 1, 2}, landmark, {zero, zero, Point2(10, -10)});
+  addTrack({1}, landmark, {zero});
+  addTrack({0, 3}, landmark, {zero, zero});
+  offsets.push_back(indices.size());
+
+  // Compare with triangulateSafe under various parameters
+  EXPECT(checkBatch(cameras, offsets, indices, measurements,
+                    TriangulationParameters(), 1e-7));
+  EXPECT(checkBatch(cameras, offsets, indices, measurements,
+                    TriangulationParameters(1.0, false, 6.0, 5.0), 1e-7));
+  EXPECT(checkBatch(cameras, offsets, indices, measurements,
+                    TriangulationParameters(1.0, false, -1, 5.0), 1e-7));
+  // LevenbergMarquardt in triangulateSafe stops earlier than Gauss-Newton
+  EXPECT(checkBatch(cameras, offsets, indices, measurements,
+                    TriangulationParameters(1.0, true), 1e-3));
+
+  const vector<TriangulationResult> results = triangulateSafeBatch(
+      cameras, offsets, indices, measurements, TriangulationParameters());
+  EXPECT(assert_equal(landmark, *results[0], 1e-7));
+  EXPECT(results[3].degenerate());
+  EXPECT(results[4].degenerate());
+
+  // Gauss-Newton refinement reduces the reprojection error
+  const Point3 dlt = *results[1];
+  const Point3 refined =
+      *triangulateSafeBatch(cameras, offsets, indices, measurements,
+                            TriangulationParameters(1.0, true))[1];
+  double dltError = 0, refinedError = 0;
+  for (size_t i = offsets[1]; i < offsets[2]; i++) {
+    dltError += (cameras[indices[i]].project(dlt) - measurements[i]).squaredNorm();
+    refinedError +=
+        (cameras[indices[i]].project(refined) - measurements[i]).squaredNorm();
+  }
+  EXPECT(refinedError < dltError);
+
+  // Empty
+  EXPECT_LONGS_EQUAL(0, triangulateSafeBatch(cameras, {}, {}, {},
+                                             TriangulationParameters())
+                            .size());
+
+  // An empty track at the end, and invalid offsets
+  vector<size_t> more = offsets;
+  more.push_back(indices.size());
+  EXPECT(triangulateSafeBatch(cameras, more, indices, measurements,
+                              TriangulationParameters()).back().degenerate());
+  more.back() = indices.size() + 1;
+  CHECK_EXCEPTION(triangulateSafeBatch(cameras, more, indices, measurements,
+                                       TriangulationParameters()),
+                  std::invalid_argument);
+  swap(more[1], more[2]);
+  more.back() = indices.size();
+  CHECK_EXCEPTION(triangulateSafeBatch(cameras, more, indices, measurements,
+                                       TriangulationParameters()),
+                  std::invalid_argument);
+
+  // A camera index out of range
+  vector<size_t> badIndices = indices;
+  badIndices.back() = cameras.size();
+  CHECK_EXCEPTION(triangulateSafeBatch(cameras, offsets, badIndices,
+                                       measurements, TriangulationParameters()),
+                  std::invalid_argument);
+}
+
 //******************************************************************************
 int main() {
   TestResult tr;
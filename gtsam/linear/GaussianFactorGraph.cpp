@@ -29,12 +29,82 @@
 #include <gtsam/base/debug.h>
 #include <gtsam/base/timing.h>
 #include <gtsam/base/cholesky.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <memory>
+#include <mutex>
+#endif
 
 using namespace std;
 using namespace gtsam;
 
 namespace gtsam {
 
+#ifdef GTSAM_USE_TBB
+  namespace {
+  /// Graphs with fewer factors are multiplied serially by multiplyHessianAdd
+  const size_t kParallelHessianMinFactors = 1000;
+
+  /// Number of partial sums of a parallel multiplyHessianAdd
+  const size_t kHessianChunks = 8;
+
+  /**
+   * Per-chunk accumulators of multiplyHessianAdd, kept between calls so that
+   * iterative solvers do not allocate a copy of y per chunk per iteration.
+   * A pool rather than thread-local storage, because an accumulator belongs
+   * to one call until its sum has been added into y.
+   */
+  class AccumulatorPool {
+   public:
+    /// A zero accumulator with the same variables and dimensions as y
+    VectorValues* acquire(const VectorValues& y) {
+      unique_ptr<VectorValues> buffer;
+      {
+        lock_guard<mutex> lock(mutex_);
+        if (!free_.empty()) {
+          buffer = move(free_.back());
+          free_.pop_back();
+        }
+      }
+      if (buffer && sameStructure(*buffer, y))
+        buffer->setZero();
+      else
+        buffer.reset(new VectorValues(VectorValues::Zero(y)));
+      return buffer.release();
+    }
+
+    /// Return an accumulator to the pool
+    void release(VectorValues* buffer) {
+      lock_guard<mutex> lock(mutex_);
+      free_.emplace_back(buffer);
+    }
+
+   private:
+    static bool sameStructure(const VectorValues& a, const VectorValues& b) {
+      if (a.size() != b.size()) return false;
+      for (const VectorValues::KeyValuePair& key_value : a) {
+        auto it = b.find(key_value.first);
+        if (it == b.end() || it->second.size() != key_value.second.size())
+          return false;
+      }
+      return true;
+    }
+
+    mutex mutex_;
+    vector<unique_ptr<VectorValues> > free_;
+  };
+
+  AccumulatorPool& accumulators() {
+    static AccumulatorPool pool;
+    return pool;
+  }
+  }  // namespace
+#endif
+
   // Instantiate base classes
   template class FactorGraph<GaussianFactor>;
   template class EliminateableFactorGraph<GaussianFactorGraph>;
@@ -393,6 +463,45 @@ namespace gtsam {
   /* ************************************************************************* */
   void GaussianFactorGraph::multiplyHessianAdd(double alpha,
       const VectorValues& x, VectorValues& y) const {
+#ifdef GTSAM_USE_TBB
+    if (size() >= kParallelHessianMinFactors) {
+      // Give y a block for every variable up front, so that the blocks can be
+      // summed in parallel below
+      for (const GaussianFactor::shared_ptr& f: *this)
+        if (f)
+          for (Key key: *f)
+            if (!y.exists(key))
+              y.insert(key, Vector::Zero(x.at(key).size()));
+
+      // Every chunk of factors accumulates its products into its own zeroed
+      // accumulator shaped like y, so factors never write to shared memory.
+      // The chunks do not depend on the number of threads, so neither does
+      // the result.
+      AccumulatorPool& pool = accumulators();
+      vector<VectorValues*> partial(kHessianChunks);
+      tbb::parallel_for(size_t(0), kHessianChunks, [&](size_t c) {
+        partial[c] = pool.acquire(y);
+        const size_t end = (c + 1) * size() / kHessianChunks;
+        for (size_t i = c * size() / kHessianChunks; i != end; ++i)
+          if (at(i)) at(i)->multiplyHessianAdd(alpha, x, *partial[c]);
+      });
+
+      // Add the partial results into y in chunk order, one variable block at
+      // a time
+      vector<pair<Key, Vector*> > blocks;
+      blocks.reserve(y.size());
+      for (VectorValues::KeyValuePair& key_value: y)
+        blocks.emplace_back(key_value.first, &key_value.second);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, blocks.size()),
+          [&](const tbb::blocked_range<size_t>& r) {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+              for (const VectorValues* local: partial)
+                *blocks[k].second += local->at(blocks[k].first);
+          });
+      for (VectorValues* local: partial) pool.release(local);
+      return;
+    }
+#endif
     for (const GaussianFactor::shared_ptr& f: *this)
      f->multiplyHessianAdd(alpha, x, y);
   }
@@ -355,7 +355,11 @@ namespace gtsam {
     ///** return A*x */
     Errors operator*(const VectorValues& x) const;
 
-    ///** y += alpha*A'A*x */
+    /**
+     * y += alpha*A'A*x. With TBB, large graphs are multiplied in parallel,
+     * in a fixed number of chunks that each accumulate into their own copy of
+     * y, so that the result does not depend on the scheduling.
+     */
     void multiplyHessianAdd(double alpha, const VectorValues& x,
         VectorValues& y) const;
 
@@ -54,6 +54,22 @@ Vector Sampler::sample() const {
   return sampleDiagonal(sigmas);
 }
 
+/* ************************************************************************* */
+Matrix Sampler::sample(size_t N) const {
+  assert(model_.get());
+  const Vector& sigmas = model_->sigmas();
+  const size_t d = sigmas.size();
+
+  // Standard normal variates, drawn sample by sample, then scaled per column
+  std::normal_distribution<double> standard;
+  Matrix result(N, d);
+  for (size_t j = 0; j < N; j++)
+    for (size_t i = 0; i < d; i++)
+      result(j, i) = sigmas(i) == 0.0 ? 0.0 : standard(generator_);
+  result = result * sigmas.asDiagonal();
+  return result;
+}
+
 /* ************************************************************************* */
 
 }  // namespace gtsam
@@ -82,6 +82,13 @@ class GTSAM_EXPORT Sampler {
   /// sample from distribution
   Vector sample() const;
 
+  /**
+   * Draw N samples at once, one per row of the returned N*dim() matrix. The
+   * random numbers are consumed in a different order than by N calls to
+   * sample(), so the two do not give the same samples for the same seed.
+   */
+  Matrix sample(size_t N) const;
+
   /// @}
 
  protected:
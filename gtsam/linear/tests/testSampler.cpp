@@ -40,6 +40,26 @@ TEST(testSampler, basic) {
   EXPECT(assert_equal(sampler2.sample(), sampler3.sample(), tol));
 }
 
+/* ************************************************************************* */
+TEST(testSampler, batch) {
+  auto model = noiseModel::Diagonal::Sigmas(kSigmas);
+  Sampler sampler1(model, 7), sampler2(model, 7);
+  const size_t N = 20000;
+  const Matrix samples = sampler1.sample(N);
+  EXPECT_LONGS_EQUAL(N, samples.rows());
+  EXPECT_LONGS_EQUAL(3, samples.cols());
+  EXPECT(assert_equal(samples, sampler2.sample(N)));
+
+  // Constrained dimensions are zero, the others have the right spread
+  EXPECT_DOUBLES_EQUAL(0.0, samples.col(2).norm(), 0);
+  const Vector mean = samples.colwise().mean();
+  const Matrix centered = samples.rowwise() - mean.transpose();
+  const Vector variances = centered.colwise().squaredNorm() / (N - 1);
+  EXPECT_DOUBLES_EQUAL(0.0, mean(0), 0.03);
+  EXPECT_DOUBLES_EQUAL(1.0, variances(0), 0.03);
+  EXPECT_DOUBLES_EQUAL(0.01, variances(1), 3e-4);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
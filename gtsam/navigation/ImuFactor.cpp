@@ -84,15 +84,61 @@ void PreintegratedImuMeasurements::integrateMeasurement(
 //------------------------------------------------------------------------------
 void PreintegratedImuMeasurements::integrateMeasurements(
     const Matrix& measuredAccs, const Matrix& measuredOmegas,
-    const Matrix& dts) {
+    const Matrix& dts, size_t jacobianInterval) {
   assert(
       measuredAccs.rows() == 3 && measuredOmegas.rows() == 3 && dts.rows() == 1);
   assert(dts.cols() >= 1);
   assert(measuredAccs.cols() == dts.cols());
   assert(measuredOmegas.cols() == dts.cols());
-  size_t n = static_cast<size_t>(dts.cols());
+  integrateMeasurements(static_cast<size_t>(dts.cols()), measuredAccs.data(),
+                        measuredOmegas.data(), dts.data(), jacobianInterval);
+}
+
+//------------------------------------------------------------------------------
+void PreintegratedImuMeasurements::integrateMeasurements(size_t n,
+    const double* measuredAccs, const double* measuredOmegas, const double* dts,
+    size_t jacobianInterval) {
+  typedef Eigen::Map<const Vector3> ConstMap3;
+#ifdef GTSAM_TANGENT_PREINTEGRATION
+  if (!p().body_P_sensor) {
+    const Matrix3& aCov = p().accelerometerCovariance;
+    const Matrix3& wCov = p().gyroscopeCovariance;
+    const Matrix3& iCov = p().integrationCovariance;
+    UpdateBlocks J;
+    for (size_t j = 0; j < n; j++) {
+      const double dt = dts[j];
+      if (dt <= 0) {
+        throw std::runtime_error(
+            "PreintegratedImuMeasurements::integrateMeasurements: dt <=0");
+      }
+      const bool reuse = jacobianInterval > 1 && j % jacobianInterval != 0;
+      updateSparse(ConstMap3(measuredAccs + 3 * j),
+                   ConstMap3(measuredOmegas + 3 * j), dt, &J, reuse);
+
+      // A * preintMeasCov_ * A', as A * (A * preintMeasCov_)'
+      J.leftMultiplyA(&preintMeasCov_);
+      preintMeasCov_.transposeInPlace();
+      J.leftMultiplyA(&preintMeasCov_);
+
+      // B * (aCov / dt) * B' only touches the position and velocity blocks
+      const double dt22 = 0.5 * dt * dt;
+      const Matrix3 RaR = J.R * aCov * J.R.transpose();
+      preintMeasCov_.block<3, 3>(3, 3).noalias() += (dt22 * dt22 / dt) * RaR + iCov * dt;
+      preintMeasCov_.block<3, 3>(3, 6).noalias() += dt22 * RaR;
+      preintMeasCov_.block<3, 3>(6, 3).noalias() += dt22 * RaR;
+      preintMeasCov_.block<3, 3>(6, 6).noalias() += dt * RaR;
+
+      // C * (wCov / dt) * C' only touches the rotation block
+      preintMeasCov_.block<3, 3>(0, 0).noalias() +=
+          dt * (J.invH * wCov * J.invH.transpose());
+    }
+    return;
+  }
+#endif
+  // Manifold preintegration or sensor pose: one measurement at a time
   for (size_t j = 0; j < n; j++) {
-    integrateMeasurement(measuredAccs.col(j), measuredOmegas.col(j), dts(0, j));
+    integrateMeasurement(ConstMap3(measuredAccs + 3 * j),
+                         ConstMap3(measuredOmegas + 3 * j), dts[j]);
   }
 }
 
@@ -128,9 +128,28 @@ public:
   void integrateMeasurement(const Vector3& measuredAcc,
       const Vector3& measuredOmega, const double dt) override;
 
-  /// Add multiple measurements, in matrix columns
+  /// Add multiple measurements, in matrix columns, see the raw buffer version
   void integrateMeasurements(const Matrix& measuredAccs, const Matrix& measuredOmegas,
-                             const Matrix& dts);
+                             const Matrix& dts, size_t jacobianInterval = 1);
+
+  /**
+   * Add n measurements from contiguous buffers, e.g., as filled by a driver.
+   * With tangent preintegration and no body_P_sensor, this uses fixed-size
+   * kernels that skip the zero and identity blocks of the update Jacobians,
+   * and propagates the covariance blockwise. The result equals that of n
+   * calls to integrateMeasurement up to round-off.
+   * @param measuredAccs n accelerometer measurements, as x, y, z triplets
+   * @param measuredOmegas n gyroscope measurements, as x, y, z triplets
+   * @param dts n time intervals
+   * @param jacobianInterval if larger than 1, the derivatives of the
+   *   exponential map are only recomputed every jacobianInterval samples.
+   *   For high-rate sensors the preintegrated rotation changes little from
+   *   sample to sample, so this approximates the covariance and bias
+   *   Jacobians well, and the preintegrated measurement stays exact.
+   */
+  void integrateMeasurements(size_t n, const double* measuredAccs,
+                             const double* measuredOmegas, const double* dts,
+                             size_t jacobianInterval = 1);
 
   /// Return pre-integrated measurement covariance
   Matrix preintMeasCov() const { return preintMeasCov_; }
@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ImuRingBuffer.h
+ * @brief   Lock-free hand-off of IMU samples from a sensor thread to the
+ *          estimator, which preintegrates them lazily between keyframes
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/navigation/ImuBias.h>
+#include <gtsam/base/Vector.h>
+
+#include <atomic>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+
+/// An IMU measurement, taken at time t
+struct ImuSample {
+  double t;
+  Vector3 acc;    ///< measured acceleration
+  Vector3 omega;  ///< measured angular velocity
+
+  ImuSample() : t(0), acc(Z_3x1), omega(Z_3x1) {}
+  ImuSample(double t, const Vector3& acc, const Vector3& omega)
+      : t(t), acc(acc), omega(omega) {}
+};
+
+/**
+ * A bounded single-producer/single-consumer queue of IMU samples. One sensor
+ * thread may push() while one estimator thread pops, without locks: each
+ * side only writes its own index, and the indices live on separate cache
+ * lines. Neither call ever blocks; a full buffer rejects the sample.
+ */
+class ImuRingBuffer {
+ public:
+  /// Create a buffer for at least `capacity` samples
+  explicit ImuRingBuffer(size_t capacity = 4096) {
+    size_t n = 2;
+    while (n - 1 < capacity) n *= 2;  // one slot stays empty
+    samples_.resize(n);
+    mask_ = n - 1;
+  }
+
+  ImuRingBuffer(const ImuRingBuffer&) = delete;
+  ImuRingBuffer& operator=(const ImuRingBuffer&) = delete;
+
+  /// Number of samples the buffer can hold
+  size_t capacity() const { return mask_; }
+
+  /// Producer: append a sample, returns false (and drops it) if full
+  bool push(const ImuSample& sample) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t next = (head + 1) & mask_;
+    if (next == tailCache_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if (next == tailCache_) {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+        return false;
+      }
+    }
+    samples_[head] = sample;
+    head_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  /// Producer: append a sample taken at time t
+  bool push(double t, const Vector3& acc, const Vector3& omega) {
+    return push(ImuSample(t, acc, omega));
+  }
+
+  /// Consumer: remove the oldest sample, returns false if empty
+  bool pop(ImuSample* sample) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == headCache_) {
+      headCache_ = head_.load(std::memory_order_acquire);
+      if (tail == headCache_) return false;
+    }
+    *sample = samples_[tail];
+    tail_.store((tail + 1) & mask_, std::memory_order_release);
+    return true;
+  }
+
+  /// Number of samples waiting, exact only when called from either side
+  size_t size() const {
+    return (head_.load(std::memory_order_acquire) -
+            tail_.load(std::memory_order_acquire)) & mask_;
+  }
+
+  /// Number of samples rejected because the buffer was full
+  size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  std::vector<ImuSample> samples_;
+  size_t mask_;
+
+  // Written by the producer
+  char pad0_[64];
+  std::atomic<size_t> head_{0};
+  size_t tailCache_ = 0;  ///< producer's last view of tail_
+  std::atomic<size_t> dropped_{0};
+
+  // Written by the consumer
+  char pad1_[64];
+  std::atomic<size_t> tail_{0};
+  size_t headCache_ = 0;  ///< consumer's last view of head_
+  char pad2_[64];
+};
+
+/**
+ * Consumer side of an ImuRingBuffer: builds preintegrated measurements of type
+ * PIM, i.e., PreintegratedImuMeasurements or PreintegratedCombinedMeasurements,
+ * between keyframes. Samples are only integrated when a keyframe is requested
+ * with split(t), and every sample is integrated exactly once, however the
+ * keyframe times fall.
+ *
+ * The signal is interpolated linearly between samples, and every interval
+ * between consecutive samples is integrated with the mean of its end points.
+ * A keyframe between two samples cuts that interval at the interpolated value.
+ * Before the first and after the last sample, the signal is held constant.
+ * All methods must be called from the consumer thread.
+ */
+template <class PIM>
+class ImuPreintegrator {
+ public:
+  /**
+   * @param buffer ring buffer filled by the sensor thread
+   * @param pim empty preintegrated measurements with the parameters and bias
+   *        to use, copied for every keyframe interval
+   * @param startTime time of the first keyframe
+   */
+  ImuPreintegrator(ImuRingBuffer* buffer, const PIM& pim, double startTime)
+      : buffer_(buffer), prototype_(pim), time_(startTime) {
+    prototype_.resetIntegration();
+  }
+
+  /// Time of the last keyframe
+  double time() const { return time_; }
+
+  /// Move all samples from the ring buffer to the consumer side
+  void poll() {
+    ImuSample sample;
+    while (buffer_->pop(&sample)) {
+      // Samples that are not newer than their predecessor are dropped
+      if (pending_.empty() ? !hasBoundary_ || sample.t > time_
+                           : sample.t > pending_.back().t)
+        pending_.push_back(sample);
+    }
+  }
+
+  /// Whether samples have arrived up to time t, so that split(t) interpolates
+  bool covers(double t) {
+    poll();
+    return !pending_.empty() && pending_.back().t >= t;
+  }
+
+  /**
+   * Integrate from the last keyframe up to time t, which becomes the new
+   * keyframe, and return the preintegrated measurements between the two.
+   * Throws std::invalid_argument if t is before the last keyframe.
+   */
+  PIM split(double t) {
+    if (t < time_)
+      throw std::invalid_argument("ImuPreintegrator::split: t before last keyframe");
+    poll();
+    PIM pim = prototype_;
+    if (!hasBoundary_) {
+      // Samples before the first keyframe only serve to interpolate it
+      if (pending_.empty()) {
+        time_ = t;
+        return pim;
+      }
+      boundary_ = pending_.front();
+      while (!pending_.empty() && pending_.front().t <= time_) {
+        boundary_ = pending_.front();
+        pending_.pop_front();
+      }
+      boundary_ = interpolate(boundary_, time_);
+      hasBoundary_ = true;
+    }
+
+    ImuSample from = boundary_;
+    while (!pending_.empty() && pending_.front().t <= t) {
+      integrate(from, pending_.front(), &pim);
+      from = pending_.front();
+      pending_.pop_front();
+    }
+
+    // Cut the interval that contains t at the interpolated sample
+    const ImuSample to = interpolate(from, t);
+    integrate(from, to, &pim);
+
+    boundary_ = to;
+    time_ = t;
+    return pim;
+  }
+
+  /// Use a new bias estimate for the intervals after the next keyframe
+  void setBias(const imuBias::ConstantBias& bias) {
+    prototype_.resetIntegrationAndSetBias(bias);
+  }
+
+ private:
+  // The signal at time t, between sample a and the next pending sample
+  ImuSample interpolate(const ImuSample& a, double t) const {
+    ImuSample b = a;
+    b.t = t;
+    if (!pending_.empty() && pending_.front().t > a.t && t > a.t) {
+      const ImuSample& next = pending_.front();
+      const double s = (t - a.t) / (next.t - a.t);
+      b.acc = a.acc + s * (next.acc - a.acc);
+      b.omega = a.omega + s * (next.omega - a.omega);
+    }
+    return b;
+  }
+
+  static void integrate(const ImuSample& a, const ImuSample& b, PIM* pim) {
+    const double dt = b.t - a.t;
+    if (dt > 0)
+      pim->integrateMeasurement(0.5 * (a.acc + b.acc),
+                                0.5 * (a.omega + b.omega), dt);
+  }
+
+  ImuRingBuffer* buffer_;
+  PIM prototype_;
+  double time_;                    ///< time of the last keyframe
+  bool hasBoundary_ = false;
+  ImuSample boundary_;             ///< signal at time_
+  std::deque<ImuSample> pending_;  ///< samples after time_, in time order
+};
+
+}  // namespace gtsam
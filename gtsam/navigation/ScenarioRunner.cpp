@@ -17,9 +17,17 @@
 
 #include <gtsam/navigation/ScenarioRunner.h>
 #include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
 
 #include <boost/assign.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <vector>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 using namespace std;
 using namespace boost::assign;
@@ -29,19 +37,100 @@ namespace gtsam {
 static double intNoiseVar = 0.0000001;
 static const Matrix3 kIntegrationErrorCovariance = intNoiseVar * I_3x3;
 
+namespace {
+// Seeds of the samplers made in the ScenarioRunner constructor
+const uint_fast64_t kGyroSeed = 10, kAccSeed = 29284;
+
+// Number of Monte Carlo samples drawn from one pair of random streams
+const size_t kSamplesPerBlock = 16;
+
+// Seed of the random stream for a block of samples, well separated from the
+// seeds of other blocks by the splitmix64 finalizer
+uint_fast64_t streamSeed(uint_fast64_t seed, size_t block) {
+  uint64_t z = seed + 0x9E3779B97F4A7C15ull * (block + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  z ^= z >> 31;
+  return z ? z : 1;  // zero breaks the generator
+}
+
+// Mean and scatter of D-dimensional samples, accumulated with Welford's
+// update and merged with that of Chan et al., which are both stable.
+template <int D>
+struct Moments {
+  typedef Eigen::Matrix<double, D, 1> VectorD;
+  typedef Eigen::Matrix<double, D, D> MatrixD;
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  size_t n = 0;
+  VectorD mean = VectorD::Zero();
+  MatrixD scatter = MatrixD::Zero();
+
+  void add(const VectorD& x) {
+    n += 1;
+    const VectorD delta = x - mean;
+    mean += delta / n;
+    scatter.noalias() += delta * (x - mean).transpose();
+  }
+
+  void merge(const Moments& other) {
+    if (other.n == 0) return;
+    const size_t total = n + other.n;
+    const VectorD delta = other.mean - mean;
+    mean += delta * (double(other.n) / total);
+    scatter += other.scatter;
+    scatter.noalias() += (double(n) * other.n / total) * delta * delta.transpose();
+    n = total;
+  }
+
+  MatrixD covariance() const { return scatter / (n - 1); }
+};
+
+// Call f(block, begin, end, moments) on the blocks of N samples, in parallel
+// if TBB is enabled, and merge their moments in block order.
+template <int D, class F>
+Moments<D> blockMoments(size_t N, const F& f) {
+  const size_t nrBlocks = (N + kSamplesPerBlock - 1) / kSamplesPerBlock;
+  std::vector<Moments<D>, Eigen::aligned_allocator<Moments<D> > > blocks(nrBlocks);
+  auto run = [&](size_t b) {
+    const size_t begin = b * kSamplesPerBlock;
+    f(b, begin, std::min(N, begin + kSamplesPerBlock), &blocks[b]);
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(size_t(0), nrBlocks, run);
+#else
+  for (size_t b = 0; b < nrBlocks; b++) run(b);
+#endif
+  Moments<D> total;
+  for (const auto& block : blocks) total.merge(block);
+  return total;
+}
+}  // namespace
+
 PreintegratedImuMeasurements ScenarioRunner::integrate(
     double T, const Bias& estimatedBias, bool corrupted) const {
   gttic_(integrate);
+  return corrupted ? integrate(T, estimatedBias, &gyroSampler_, &accSampler_)
+                   : integrate(T, estimatedBias, nullptr, nullptr);
+}
+
+PreintegratedImuMeasurements ScenarioRunner::integrate(
+    double T, const Bias& estimatedBias, const Sampler* gyroSampler,
+    const Sampler* accSampler) const {
   PreintegratedImuMeasurements pim(p_, estimatedBias);
 
   const double dt = imuSampleTime();
   const size_t nrSteps = T / dt;
   double t = 0;
   for (size_t k = 0; k < nrSteps; k++, t += dt) {
-    Vector3 measuredOmega =
-        corrupted ? measuredAngularVelocity(t) : actualAngularVelocity(t);
-    Vector3 measuredAcc =
-        corrupted ? measuredSpecificForce(t) : actualSpecificForce(t);
+    Vector3 measuredOmega = actualAngularVelocity(t);
+    Vector3 measuredAcc = actualSpecificForce(t);
+    if (gyroSampler) {
+      measuredOmega += estimatedBias_.gyroscope() +
+                       gyroSampler->sample() / sqrt_dt_;
+      measuredAcc += estimatedBias_.accelerometer() +
+                     accSampler->sample() / sqrt_dt_;
+    }
     pim.integrateMeasurement(measuredAcc, measuredOmega, dt);
   }
 
@@ -59,50 +148,36 @@ Matrix9 ScenarioRunner::estimateCovariance(double T, size_t N,
   gttic_(estimateCovariance);
 
   // Get predict prediction from ground truth measurements
-  NavState prediction = predict(integrate(T));
+  const NavState prediction = predict(integrate(T));
 
   // Sample !
-  Matrix samples(9, N);
-  Vector9 sum = Vector9::Zero();
-  for (size_t i = 0; i < N; i++) {
-    auto pim = integrate(T, estimatedBias, true);
-    NavState sampled = predict(pim);
-    Vector9 xi = sampled.localCoordinates(prediction);
-    samples.col(i) = xi;
-    sum += xi;
-  }
+  const Moments<9> moments = blockMoments<9>(
+      N, [&](size_t b, size_t begin, size_t end, Moments<9>* m) {
+        const Sampler gyroSampler(gyroSampler_.model(), streamSeed(kGyroSeed, b));
+        const Sampler accSampler(accSampler_.model(), streamSeed(kAccSeed, b));
+        for (size_t i = begin; i < end; i++) {
+          auto pim = integrate(T, estimatedBias, &gyroSampler, &accSampler);
+          m->add(predict(pim).localCoordinates(prediction));
+        }
+      });
 
   // Compute MC covariance
-  Vector9 sampleMean = sum / N;
-  Matrix9 Q;
-  Q.setZero();
-  for (size_t i = 0; i < N; i++) {
-    Vector9 xi = samples.col(i) - sampleMean;
-    Q += xi * xi.transpose();
-  }
-
-  return Q / (N - 1);
+  return moments.covariance();
 }
 
 Matrix6 ScenarioRunner::estimateNoiseCovariance(size_t N) const {
-  Matrix samples(6, N);
-  Vector6 sum = Vector6::Zero();
-  for (size_t i = 0; i < N; i++) {
-    samples.col(i) << accSampler_.sample() / sqrt_dt_,
-        gyroSampler_.sample() / sqrt_dt_;
-    sum += samples.col(i);
-  }
+  const Moments<6> moments = blockMoments<6>(
+      N, [&](size_t b, size_t begin, size_t end, Moments<6>* m) {
+        const size_t n = end - begin;
+        Matrix samples(n, 6);
+        samples << Sampler(accSampler_.model(), streamSeed(kAccSeed, b)).sample(n),
+            Sampler(gyroSampler_.model(), streamSeed(kGyroSeed, b)).sample(n);
+        samples /= sqrt_dt_;
+        for (size_t i = 0; i < n; i++) m->add(samples.row(i).transpose());
+      });
 
   // Compute MC covariance
-  Vector6 sampleMean = sum / N;
-  Matrix6 Q;
-  Q.setZero();
-  for (size_t i = 0; i < N; i++) {
-    Vector6 xi = samples.col(i) - sampleMean;
-    Q += xi * xi.transpose();
-  }
-
-  return Q / (N - 1);
+  return moments.covariance();
 }
 
 }  // namespace gtsam
@@ -98,12 +98,26 @@ class GTSAM_EXPORT ScenarioRunner {
   NavState predict(const PreintegratedImuMeasurements& pim,
                    const Bias& estimatedBias = Bias()) const;
 
-  /// Compute a Monte Carlo estimate of the predict covariance using N samples
+  /**
+   * Compute a Monte Carlo estimate of the predict covariance using N samples.
+   * Blocks of samples are drawn in parallel if TBB is enabled, each from its
+   * own random streams seeded by the block index, and their covariances are
+   * merged in block order, so the estimate does not depend on the number of
+   * threads and is the same for every call.
+   */
   Matrix9 estimateCovariance(double T, size_t N = 1000,
                              const Bias& estimatedBias = Bias()) const;
 
-  /// Estimate covariance of sampled noise for sanity-check
+  /// Estimate covariance of sampled noise for sanity-check, in parallel as
+  /// estimateCovariance
   Matrix6 estimateNoiseCovariance(size_t N = 1000) const;
+
+ private:
+  /// Integrate measurements for T seconds, corrupted with noise from the
+  /// given samplers if they are not null. Not timed, so it is thread-safe.
+  PreintegratedImuMeasurements integrate(double T, const Bias& estimatedBias,
+                                         const Sampler* gyroSampler,
+                                         const Sampler* accSampler) const;
 };
 
 }  // namespace gtsam
@@ -139,6 +139,46 @@ void TangentPreintegration::update(const Vector3& measuredAcc,
   preintegrated_H_biasOmega_ = (*A) * preintegrated_H_biasOmega_ - (*C);
 }
 
+//------------------------------------------------------------------------------
+void TangentPreintegration::updateSparse(const Vector3& measuredAcc,
+    const Vector3& measuredOmega, const double dt, UpdateBlocks* J,
+    bool reuseDerivatives) {
+  assert(!p().body_P_sensor);
+  const Vector3 a_body = biasHat_.correctAccelerometer(measuredAcc);
+  const Vector3 w_body = biasHat_.correctGyroscope(measuredOmega);
+
+  // Same mean propagation as UpdatePreintegrated
+  so3::DexpFunctor local(preintegrated_.head<3>());
+  Vector3 w_tangent;
+  if (reuseDerivatives) {
+    // Keep dexp and its inverse in J, and only solve for the exact mean
+    w_tangent = local.dexp().lu().solve(w_body);
+  } else {
+    w_tangent = local.applyInvDexp(w_body, J->w_tangent_H_theta, J->invH);
+    J->dexp = local.dexp();
+  }
+  J->R = local.expmap().matrix();
+  J->dt = dt;
+  const Vector3 a_nav = J->R * a_body;
+  const double dt22 = 0.5 * dt * dt;
+
+  deltaTij_ += dt;
+  preintegrated_.segment<3>(3) += preintegrated_.tail<3>() * dt + a_nav * dt22;
+  preintegrated_.tail<3>() += a_nav * dt;
+  preintegrated_.head<3>() += w_tangent * dt;
+
+  J->a_nav_H_theta = J->R * skewSymmetric(-a_body) * J->dexp;
+
+  // new_H_biasAcc = A * old_H_biasAcc - B, as in update
+  J->leftMultiplyA(&preintegrated_H_biasAcc_);
+  preintegrated_H_biasAcc_.middleRows<3>(3) -= J->R * dt22;
+  preintegrated_H_biasAcc_.bottomRows<3>() -= J->R * dt;
+
+  // new_H_biasOmega = A * old_H_biasOmega - C
+  J->leftMultiplyA(&preintegrated_H_biasOmega_);
+  preintegrated_H_biasOmega_.topRows<3>() -= J->invH * dt;
+}
+
 //------------------------------------------------------------------------------
 Vector9 TangentPreintegration::biasCorrectedDelta(
     const imuBias::ConstantBias& bias_i, OptionalJacobian<9, 6> H) const {
@@ -102,6 +102,46 @@ public:
   void update(const Vector3& measuredAcc, const Vector3& measuredOmega,
       const double dt, Matrix9* A, Matrix93* B, Matrix93* C) override;
 
+  /**
+   * The blocks of the Jacobians A, B, and C of UpdatePreintegrated that are
+   * neither zero nor identity. With D the derivative of the angular velocity
+   * in tangent space and Ha that of the acceleration in the navigation frame,
+   * both with respect to theta,
+   *   A = [I + D*dt, 0, 0; Ha*dt^2/2, I, I*dt; Ha*dt, 0, I],
+   *   B = [0; R*dt^2/2; R*dt], C = [invH*dt; 0; 0].
+   */
+  struct UpdateBlocks {
+    Matrix3 w_tangent_H_theta;  ///< D
+    Matrix3 dexp;               ///< dexp at theta, used in Ha
+    Matrix3 a_nav_H_theta;      ///< Ha
+    Matrix3 R;                  ///< nRb, the rotation of the body
+    Matrix3 invH;               ///< inverse of dexp at theta
+    double dt;
+
+    /// Replace the 9*N matrix M by A*M, skipping the zero and identity blocks
+    template <int N>
+    void leftMultiplyA(Eigen::Matrix<double, 9, N>* M) const {
+      const Eigen::Matrix<double, 3, N> M_theta = M->template topRows<3>();
+      M->template middleRows<3>(3) += dt * M->template bottomRows<3>();
+      M->template middleRows<3>(3).noalias() +=
+          (0.5 * dt * dt * a_nav_H_theta) * M_theta;
+      M->template bottomRows<3>().noalias() += (dt * a_nav_H_theta) * M_theta;
+      M->template topRows<3>().noalias() += (dt * w_tangent_H_theta) * M_theta;
+    }
+  };
+
+  /**
+   * Same as update, for a sensor without body_P_sensor, but only computes the
+   * blocks of the Jacobians that are not trivial, and exploits their sparsity
+   * when updating the bias derivatives. If reuseDerivatives is true, dexp,
+   * its inverse, and the derivative D already in J are used rather than
+   * recomputed at the current theta. This only approximates the Jacobians:
+   * the preintegrated mean is always exact.
+   */
+  void updateSparse(const Vector3& measuredAcc, const Vector3& measuredOmega,
+                    const double dt, UpdateBlocks* J,
+                    bool reuseDerivatives = false);
+
   /// Given the estimate of the bias, return a NavState tangent vector
   /// summarizing the preintegrated IMU measurements so far
   /// NOTE(frank): implementation is different in two versions
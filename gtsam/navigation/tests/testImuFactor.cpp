@@ -923,6 +923,75 @@ TEST(ImuFactor, CheckCovariance) {
   EXPECT(assert_equal(expected, actual.preintMeasCov()));
 }
 
+/* ************************************************************************* */
+namespace {
+// 200 Hz measurements of a rotating, accelerating body, in matrix columns
+void highRateMeasurements(Matrix* accs, Matrix* omegas, Matrix* dts) {
+  const size_t n = 400;
+  *accs = Matrix(3, n);
+  *omegas = Matrix(3, n);
+  *dts = Matrix::Constant(1, n, 0.005);
+  for (size_t j = 0; j < n; j++) {
+    const double t = 0.005 * j;
+    accs->col(j) << 0.5 + std::sin(t), 0.2, -kGravity + 0.1 * std::cos(3 * t);
+    omegas->col(j) << 0.3 * std::cos(t), 0.5, -0.2 + 0.4 * std::sin(2 * t);
+  }
+}
+}  // namespace
+
+TEST(ImuFactor, IntegrateMeasurementsBatch) {
+  Matrix accs, omegas, dts;
+  highRateMeasurements(&accs, &omegas, &dts);
+  const Bias bias(Vector3(0.01, -0.02, 0.03), Vector3(0.001, 0.002, -0.001));
+
+  PreintegratedImuMeasurements expected(testing::Params(), bias);
+  for (Eigen::Index j = 0; j < dts.cols(); j++)
+    expected.integrateMeasurement(accs.col(j), omegas.col(j), dts(0, j));
+
+  PreintegratedImuMeasurements actual(testing::Params(), bias);
+  actual.integrateMeasurements(accs, omegas, dts);
+  EXPECT(assert_equal(expected, actual, 1e-12));
+  const Matrix9 expectedCov = expected.preintMeasCov();
+  EXPECT((expectedCov - actual.preintMeasCov()).norm() <
+         1e-12 * expectedCov.norm());
+
+  // Integrating in two batches is the same as integrating in one
+  PreintegratedImuMeasurements halves(testing::Params(), bias);
+  const size_t n = dts.cols(), half = n / 2;
+  halves.integrateMeasurements(half, accs.data(), omegas.data(), dts.data());
+  halves.integrateMeasurements(n - half, accs.data() + 3 * half,
+                               omegas.data() + 3 * half, dts.data() + half);
+  EXPECT(assert_equal(actual, halves, 1e-12));
+
+  dts(0, 7) = 0;
+  CHECK_EXCEPTION(actual.integrateMeasurements(accs, omegas, dts),
+                  std::runtime_error);
+}
+
+#ifdef GTSAM_TANGENT_PREINTEGRATION
+/* ************************************************************************* */
+// Recomputing the derivatives only every few samples keeps the mean exact,
+// and the covariance and bias derivatives close
+TEST(ImuFactor, IntegrateMeasurementsApproximate) {
+  Matrix accs, omegas, dts;
+  highRateMeasurements(&accs, &omegas, &dts);
+
+  PreintegratedImuMeasurements expected(testing::Params());
+  expected.integrateMeasurements(accs, omegas, dts);
+  PreintegratedImuMeasurements actual(testing::Params());
+  actual.integrateMeasurements(accs, omegas, dts, 10);
+
+  EXPECT(assert_equal(expected.preintegrated(), actual.preintegrated(), 1e-12));
+  EXPECT_DOUBLES_EQUAL(expected.deltaTij(), actual.deltaTij(), 1e-12);
+  const Matrix9 expectedCov = expected.preintMeasCov();
+  const Matrix9 actualCov = actual.preintMeasCov();
+  EXPECT((expectedCov - actualCov).norm() < 1e-3 * expectedCov.norm());
+  const Matrix93 expectedH = expected.preintegrated_H_biasOmega();
+  const Matrix93 actualH = actual.preintegrated_H_biasOmega();
+  EXPECT((expectedH - actualH).norm() < 1e-2 * expectedH.norm());
+}
+#endif
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testImuRingBuffer.cpp
+ * @brief   Unit tests for the IMU ring buffer and lazy preintegration
+ * @date    October 2026
+ */
+
+#include <gtsam/navigation/ImuRingBuffer.h>
+#include <gtsam/navigation/CombinedImuFactor.h>
+#include <gtsam/navigation/ImuFactor.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <thread>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+boost::shared_ptr<PreintegrationCombinedParams> params() {
+  auto p = PreintegrationCombinedParams::MakeSharedU(9.81);
+  p->gyroscopeCovariance = 1e-6 * I_3x3;
+  p->accelerometerCovariance = 1e-4 * I_3x3;
+  p->integrationCovariance = 1e-8 * I_3x3;
+  return p;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(ImuRingBuffer, pushPop) {
+  ImuRingBuffer buffer(3);
+  EXPECT_LONGS_EQUAL(3, buffer.capacity());
+  ImuSample sample;
+  EXPECT(!buffer.pop(&sample));
+
+  // Wrap around a few times
+  for (size_t round = 0; round < 3; round++) {
+    for (size_t i = 0; i < 3; i++)
+      EXPECT(buffer.push(i, Vector3::Constant(i), Vector3::Constant(-1.0 * i)));
+    EXPECT(!buffer.push(3, Z_3x1, Z_3x1));
+    EXPECT_LONGS_EQUAL(3, buffer.size());
+    for (size_t i = 0; i < 3; i++) {
+      CHECK(buffer.pop(&sample));
+      EXPECT_DOUBLES_EQUAL(i, sample.t, 0);
+      EXPECT(assert_equal<Vector3>(Vector3::Constant(-1.0 * i), sample.omega));
+    }
+    EXPECT(!buffer.pop(&sample));
+  }
+  EXPECT_LONGS_EQUAL(3, buffer.dropped());
+}
+
+/* ************************************************************************* */
+// A producer thread and a consumer thread see every sample, in order
+TEST(ImuRingBuffer, threads) {
+  ImuRingBuffer buffer(64);
+  const size_t n = 100000;
+  thread producer([&buffer, n] {
+    for (size_t i = 0; i < n; i++)
+      while (!buffer.push(i, Vector3::Constant(i), Z_3x1)) this_thread::yield();
+  });
+
+  size_t received = 0;
+  bool inOrder = true;
+  ImuSample sample;
+  while (received < n) {
+    if (!buffer.pop(&sample)) {
+      this_thread::yield();
+      continue;
+    }
+    inOrder = inOrder && sample.t == received && sample.acc.x() == received;
+    received++;
+  }
+  producer.join();
+  EXPECT(inOrder);
+}
+
+/* ************************************************************************* */
+// Splitting at keyframes integrates the piecewise linear signal exactly
+TEST(ImuPreintegrator, interpolation) {
+  ImuRingBuffer buffer;
+  for (size_t i = 0; i <= 10; i++)  // acceleration a(t) = t along x
+    buffer.push(0.1 * i, Vector3(0.1 * i, 0, 0), Z_3x1);
+
+  const PreintegratedCombinedMeasurements pim(params());
+  ImuPreintegrator<PreintegratedCombinedMeasurements> integrator(&buffer, pim, 0);
+  EXPECT(integrator.covers(1.0));
+  EXPECT(!integrator.covers(1.1));
+
+  // Keyframe between samples: velocity is the integral t^2/2
+  const auto pim1 = integrator.split(0.25);
+  EXPECT_DOUBLES_EQUAL(0.25, pim1.deltaTij(), 1e-12);
+  EXPECT(assert_equal(Vector3(0.03125, 0, 0), pim1.deltaVij(), 1e-12));
+  EXPECT_DOUBLES_EQUAL(0.25, integrator.time(), 0);
+
+  const auto pim2 = integrator.split(0.7);
+  EXPECT_DOUBLES_EQUAL(0.45, pim2.deltaTij(), 1e-12);
+  EXPECT(assert_equal(Vector3((0.49 - 0.0625) / 2, 0, 0), pim2.deltaVij(), 1e-12));
+
+  // After the last sample, the signal is held
+  const auto pim3 = integrator.split(1.2);
+  EXPECT(assert_equal(Vector3((1 - 0.49) / 2 + 0.2, 0, 0), pim3.deltaVij(), 1e-12));
+
+  CHECK_EXCEPTION(integrator.split(1.0), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+// Splitting at a sample does not change the prediction
+TEST(ImuPreintegrator, split) {
+  const Vector3 acc(0.1, 0.2, 9.9), omega(0.1, -0.2, 0.3);
+  ImuRingBuffer buffer;
+  for (size_t i = 0; i <= 100; i++) buffer.push(0.01 * i, acc, omega);
+
+  auto p = boost::make_shared<PreintegrationParams>(*params());
+  const PreintegratedImuMeasurements pim(p);
+  ImuPreintegrator<PreintegratedImuMeasurements> integrator(&buffer, pim, 0);
+  const auto pim1 = integrator.split(0.33);
+  const auto pim2 = integrator.split(1.0);
+
+  PreintegratedImuMeasurements expected(p);
+  for (size_t i = 0; i < 100; i++) expected.integrateMeasurement(acc, omega, 0.01);
+
+  const NavState x0;
+  const NavState x1 = pim1.predict(x0, imuBias::ConstantBias());
+  EXPECT(assert_equal(expected.predict(x0, imuBias::ConstantBias()),
+                      pim2.predict(x1, imuBias::ConstantBias()), 1e-9));
+  EXPECT_DOUBLES_EQUAL(1.0, pim1.deltaTij() + pim2.deltaTij(), 1e-12);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -394,6 +394,24 @@ TEST(ScenarioRunner, AcceleratingAndRotating4) {
   EXPECT(assert_equal(estimatedCov, pim.preintMeasCov(), 0.1));
 }
 
+/* ************************************************************************* */
+// Monte Carlo estimates are reproducible, and sample the right noise
+TEST(ScenarioRunner, MonteCarlo) {
+  const ConstantTwistScenario scenario(Vector3(0, 0, 0.1), Vector3(1, 0, 0));
+  auto p = defaultParams();
+  ScenarioRunner runner(scenario, p, kDt);
+
+  const double T = 0.1;
+  const Matrix9 estimatedCov = runner.estimateCovariance(T, 50);
+  EXPECT(assert_equal(estimatedCov, runner.estimateCovariance(T, 50), 0));
+  EXPECT(assert_equal(estimatedCov, runner.integrate(T).preintMeasCov(), 1e-5));
+
+  Matrix6 expected;
+  expected << p->accelerometerCovariance / kDt, Z_3x3,  //
+      Z_3x3, p->gyroscopeCovariance / kDt;
+  EXPECT(assert_equal(expected, runner.estimateNoiseCovariance(20001), 1e-5));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BatchLinearization.cpp
+ * @brief   Linearize all factors of one concrete type with a single kernel
+ * @date    October 2026
+ */
+
+#include <gtsam/nonlinear/BatchLinearization.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <unordered_map>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+typedef unordered_map<type_index, BatchLinearization::Kernel> KernelMap;
+
+KernelMap& kernels() {
+  static KernelMap map;
+  return map;
+}
+}  // namespace
+
+/* ************************************************************************* */
+void BatchLinearization::Register(const type_index& type,
+                                  const Kernel& kernel) {
+  kernels()[type] = kernel;
+}
+
+/* ************************************************************************* */
+void BatchLinearization::Unregister(const type_index& type) {
+  kernels().erase(type);
+}
+
+/* ************************************************************************* */
+const BatchLinearization::Kernel* BatchLinearization::Find(
+    const type_index& type) {
+  const KernelMap& map = kernels();
+  auto it = map.find(type);
+  return it == map.end() ? nullptr : &it->second;
+}
+
+/* ************************************************************************* */
+GaussianFactorGraph::shared_ptr BatchLinearization::Linearize(
+    const NonlinearFactorGraph& graph, const Values& values) {
+  gttic(BatchLinearization_Linearize);
+
+  auto linearFG = boost::make_shared<GaussianFactorGraph>();
+  linearFG->resize(graph.size());
+
+  // Bucket the factors by dynamic type, keeping the order within a bucket
+  unordered_map<type_index, vector<size_t>> buckets;
+  vector<size_t> others;
+  for (size_t i = 0; i < graph.size(); i++) {
+    const auto& factor = graph[i];
+    if (!factor) continue;
+    const type_index type(typeid(*factor));
+    if (Find(type))
+      buckets[type].push_back(i);
+    else
+      others.push_back(i);
+  }
+
+  for (const auto& bucket : buckets)
+    (*Find(bucket.first))(graph, bucket.second, values, linearFG.get());
+
+  // The rest one by one, in parallel if possible
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, others.size()),
+                    [&](const tbb::blocked_range<size_t>& r) {
+                      for (size_t k = r.begin(); k != r.end(); ++k)
+                        (*linearFG)[others[k]] =
+                            graph[others[k]]->linearize(values);
+                    });
+#else
+  for (size_t i : others) (*linearFG)[i] = graph[i]->linearize(values);
+#endif
+
+  return linearFG;
+}
+
+}  // namespace gtsam
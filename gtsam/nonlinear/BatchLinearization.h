@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BatchLinearization.h
+ * @brief   Linearize all factors of one concrete type with a single kernel
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+
+#include <functional>
+#include <typeindex>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Registry of batched linearization kernels, one per concrete factor type.
+ *
+ * Large graphs typically consist of many factors of only a handful of types,
+ * e.g., thousands of BetweenFactor<Pose3>. Linearize buckets the factors of a
+ * graph by their dynamic type and hands each bucket with a registered kernel
+ * to that kernel at once, so that it can gather the values involved into
+ * contiguous arrays and evaluate all errors and Jacobians in vectorized loops
+ * rather than through one virtual call and several small heap allocations
+ * per factor. Factors of types without a kernel are linearized as usual.
+ *
+ * A kernel must produce exactly what the factors' own linearize would, up to
+ * round-off, and may fall back to it for individual factors it cannot handle,
+ * e.g., those with robust noise models. Kernels are registered by type, so
+ * a kernel for a factor template applies to the exact instantiation only, not
+ * to classes derived from it. Modules that depend on nonlinear, like slam,
+ * register their kernels from static initializers when GTSAM is loaded;
+ * registration is not thread-safe, so register others before linearizing
+ * from several threads.
+ */
+class GTSAM_EXPORT BatchLinearization {
+ public:
+  /**
+   * A kernel linearizes the factors graph[indices[k]], all of the type it was
+   * registered for, at the given values and stores each result in
+   * (*result)[indices[k]], which it may leave null for inactive factors.
+   */
+  typedef std::function<void(const NonlinearFactorGraph& graph,
+                             const std::vector<size_t>& indices,
+                             const Values& values, GaussianFactorGraph* result)>
+      Kernel;
+
+  /// Register (or replace) the kernel for factors of dynamic type `type`
+  static void Register(const std::type_index& type, const Kernel& kernel);
+
+  /// Register (or replace) the kernel for factors of type FACTOR
+  template <class FACTOR>
+  static void Register(const Kernel& kernel) {
+    Register(std::type_index(typeid(FACTOR)), kernel);
+  }
+
+  /// Remove the kernel for type FACTOR, if any
+  template <class FACTOR>
+  static void Unregister() {
+    Unregister(std::type_index(typeid(FACTOR)));
+  }
+
+  /// Remove the kernel for dynamic type `type`, if any
+  static void Unregister(const std::type_index& type);
+
+  /// Return the kernel registered for dynamic type `type`, or nullptr
+  static const Kernel* Find(const std::type_index& type);
+
+  /**
+   * Linearize a graph using the registered kernels where possible. The
+   * result has one (possibly null) factor for every factor in the graph, in
+   * the same order, exactly as NonlinearFactorGraph::linearize.
+   */
+  static GaussianFactorGraph::shared_ptr Linearize(
+      const NonlinearFactorGraph& graph, const Values& values);
+
+  /**
+   * Allocate a JacobianFactor on the given keys with the given block widths
+   * and `rows` rows, without initializing its augmented matrix [A b], for
+   * kernels that write their results straight into it.
+   */
+  template <class KEYS, class DIMENSIONS>
+  static JacobianFactor::shared_ptr AllocateJacobian(
+      const KEYS& keys, const DIMENSIONS& dims, DenseIndex rows,
+      const SharedDiagonal& model = SharedDiagonal()) {
+    return JacobianFactor::shared_ptr(
+        new JacobianFactor(keys, dims, rows, model));
+  }
+};
+
+}  // namespace gtsam
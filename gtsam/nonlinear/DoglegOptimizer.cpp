@@ -84,7 +84,9 @@ double DoglegOptimizer::getDelta() const {
 GaussianFactorGraph::shared_ptr DoglegOptimizer::iterate(void) {
 
   // Linearize graph
-  GaussianFactorGraph::shared_ptr linear = graph_.linearize(state_->values);
+  GaussianFactorGraph::shared_ptr linear =
+      params_.batchLinearization ? graph_.linearizeBatched(state_->values)
+                                 : graph_.linearize(state_->values);
 
   // Pull out parameters we'll use
   const bool dlVerbose = (params_.verbosityDL > DoglegParams::SILENT);
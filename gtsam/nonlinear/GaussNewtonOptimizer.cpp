@@ -46,7 +46,9 @@ GaussianFactorGraph::shared_ptr GaussNewtonOptimizer::iterate() {
 
   // Linearize graph
   gttic(GaussNewtonOptimizer_Linearize);
-  GaussianFactorGraph::shared_ptr linear = graph_.linearize(state_->values);
+  GaussianFactorGraph::shared_ptr linear =
+      params_.batchLinearization ? graph_.linearizeBatched(state_->values)
+                                 : graph_.linearize(state_->values);
   gttoc(GaussNewtonOptimizer_Linearize);
 
   // Solve Factor Graph
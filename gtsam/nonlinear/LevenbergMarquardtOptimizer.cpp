@@ -82,7 +82,8 @@ int LevenbergMarquardtOptimizer::getInnerIterations() const {
 
 /* ************************************************************************* */
 GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::linearize() const {
-  return graph_.linearize(state_->values);
+  return params_.batchLinearization ? graph_.linearizeBatched(state_->values)
+                                    : graph_.linearize(state_->values);
 }
 
 /* ************************************************************************* */
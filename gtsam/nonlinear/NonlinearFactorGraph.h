@@ -145,6 +145,12 @@ namespace gtsam {
     /// Linearize a nonlinear factor graph
     boost::shared_ptr<GaussianFactorGraph> linearize(const Values& linearizationPoint) const;
 
+    /**
+     * Linearize a nonlinear factor graph, factors of the types registered with
+     * BatchLinearization type by type, see BatchLinearization::Linearize.
+     */
+    boost::shared_ptr<GaussianFactorGraph> linearizeBatched(const Values& linearizationPoint) const;
+
     /// typdef for dampen functions used below
     typedef std::function<void(const boost::shared_ptr<HessianFactor>& hessianFactor)> Dampen;
 
@@ -82,6 +82,7 @@ void NonlinearOptimizerParams::print(const std::string& str) const {
   std::cout << "         maximum iterations: " << maxIterations << "\n";
   std::cout << "                  verbosity: " << verbosityTranslator(verbosity)
       << "\n";
+  std::cout << "        batch linearization: " << batchLinearization << "\n";
   std::cout.flush();
 
   switch (linearSolverType) {
@@ -44,10 +44,12 @@ public:
   double errorTol; ///< The maximum total error to stop iterating (default 0.0)
   Verbosity verbosity; ///< The printing verbosity during optimization (default SILENT)
   Ordering::OrderingType orderingType; ///< The method of ordering use during variable elimination (default COLAMD)
+  bool batchLinearization; ///< Linearize with the kernels registered in BatchLinearization (default false)
 
   NonlinearOptimizerParams() :
       maxIterations(100), relativeErrorTol(1e-5), absoluteErrorTol(1e-5), errorTol(
           0.0), verbosity(SILENT), orderingType(Ordering::COLAMD),
+          batchLinearization(false),
           linearSolverType(MULTIFRONTAL_CHOLESKY) {}
 
   virtual ~NonlinearOptimizerParams() {
@@ -64,6 +66,7 @@ public:
   void setRelativeErrorTol(double value) { relativeErrorTol = value; }
   void setAbsoluteErrorTol(double value) { absoluteErrorTol = value; }
   void setErrorTol(double value) { errorTol = value; }
+  void setBatchLinearization(bool value) { batchLinearization = value; }
   void setVerbosity(const std::string& src) {
     verbosity = verbosityTranslator(src);
   }
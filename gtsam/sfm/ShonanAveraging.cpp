@@ -133,6 +133,7 @@ ShonanAveraging<d>::ShonanAveraging(const Measurements &measurements,
   Q_ = buildQ();
   D_ = buildD();
   L_ = D_ - Q_;
+  buildPatternOfA();
 }
 
 /* ************************************************************************* */
@@ -421,6 +422,60 @@ Sparse ShonanAveraging<d>::buildQ() const {
   return Q;
 }
 
+/* ************************************************************************* */
+template <size_t d>
+void ShonanAveraging<d>::buildPatternOfA() {
+  const size_t N = nrUnknowns();
+  const Eigen::Index dN = d * N;
+
+  // -Q, plus explicit zeros on the block-diagonal that Lambda will fill in
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(Q_.nonZeros() + d * d * N);
+  for (Eigen::Index k = 0; k < Q_.outerSize(); ++k)
+    for (Sparse::InnerIterator it(Q_, k); it; ++it)
+      triplets.emplace_back(it.row(), it.col(), -it.value());
+  for (size_t j = 0; j < N; j++)
+    for (size_t c = 0; c < d; c++)
+      for (size_t r = 0; r < d; r++)
+        triplets.emplace_back(d * j + r, d * j + c, 0.0);
+  minusQ_.resize(dN, dN);
+  minusQ_.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Find where each entry of the block-diagonal is stored, in the same
+  // column-major order as the d*dN matrix returned by lambdaBlocks
+  const auto *outer = minusQ_.outerIndexPtr();
+  const auto *inner = minusQ_.innerIndexPtr();
+  lambdaIndices_.resize(d * dN);
+  for (Eigen::Index col = 0; col < dN; col++) {
+    const Eigen::Index dj = col - col % d;
+    for (size_t r = 0; r < d; r++) {
+      const Sparse::StorageIndex row = dj + r;
+      lambdaIndices_[d * col + r] =
+          std::lower_bound(inner + outer[col], inner + outer[col + 1], row) -
+          inner;
+    }
+  }
+}
+
+/* ************************************************************************* */
+template <size_t d>
+Matrix ShonanAveraging<d>::lambdaBlocks(const Matrix &S) const {
+  const size_t N = nrUnknowns();
+  Matrix blocks(d, d * N);
+
+  // Do sparse-dense multiply to get Q*S', once rather than for every block
+  const Matrix QSt = Q_ * S.transpose();
+
+  for (size_t j = 0; j < N; j++) {
+    // Compute B, the building block for the j^th diagonal block of Lambda
+    const size_t dj = d * j;
+    const Eigen::Matrix<double, d, d> B =
+        QSt.middleRows<d>(dj) * S.middleCols<d>(dj);
+    blocks.middleCols<d>(dj) = 0.5 * (B + B.transpose());
+  }
+  return blocks;
+}
+
 /* ************************************************************************* */
 template <size_t d>
 Sparse ShonanAveraging<d>::computeLambda(const Matrix &S) const {
@@ -432,18 +487,13 @@ Sparse ShonanAveraging<d>::computeLambda(const Matrix &S) const {
   std::vector<Eigen::Triplet<double>> triplets;
   triplets.reserve(stride * N);
 
-  // Do sparse-dense multiply to get Q*S'
-  auto QSt = Q_ * S.transpose();
-
+  const Matrix blocks = lambdaBlocks(S);
   for (size_t j = 0; j < N; j++) {
-    // Compute B, the building block for the j^th diagonal block of Lambda
-    const size_t dj = d * j;
-    Matrix B = QSt.middleRows(dj, d) * S.middleCols<d>(dj);
-
     // Elements of jth block-diagonal
+    const size_t dj = d * j;
     for (size_t r = 0; r < d; r++)
       for (size_t c = 0; c < d; c++)
-        triplets.emplace_back(dj + r, dj + c, 0.5 * (B(r, c) + B(c, r)));
+        triplets.emplace_back(dj + r, dj + c, blocks(r, dj + c));
   }
 
   // Construct and return a sparse matrix from these triplets
@@ -466,8 +516,7 @@ template <size_t d>
 Sparse ShonanAveraging<d>::computeA(const Values &values) const {
   assert(values.size() == nrUnknowns());
   const Matrix S = StiefelElementMatrix(values);
-  auto Lambda = computeLambda(S);
-  return Lambda - Q_;
+  return computeA(S);
 }
 
 /* ************************************************************************* */
@@ -535,13 +584,18 @@ static bool SparseMinimumEigenValue(
     Vector *minEigenVector = 0, size_t *numIterations = 0,
     size_t maxIterations = 1000,
     double minEigenvalueNonnegativityTolerance = 10e-4,
-    Eigen::Index numLanczosVectors = 20) {
-  // a. Estimate the largest-magnitude eigenvalue of this matrix using Lanczos
+    Eigen::Index numLanczosVectors = 20, Vector *lmEigenVector = 0,
+    const Vector *minEigenVectorGuess = 0) {
+  // a. Estimate the largest-magnitude eigenvalue of this matrix using Lanczos,
+  // starting from the given estimate of its eigenvector if there is one
   MatrixProdFunctor lmOperator(A);
   Spectra::SymEigsSolver<double, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN,
                          MatrixProdFunctor>
       lmEigenValueSolver(&lmOperator, 1, std::min(numLanczosVectors, A.rows()));
-  lmEigenValueSolver.init();
+  if (lmEigenVector && lmEigenVector->size() == A.rows())
+    lmEigenValueSolver.init(lmEigenVector->data());
+  else
+    lmEigenValueSolver.init();
 
   const int lmConverged = lmEigenValueSolver.compute(
       maxIterations, 1e-4, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN);
@@ -550,6 +604,7 @@ static bool SparseMinimumEigenValue(
   if (lmConverged != 1) return false;
 
   const double lmEigenValue = lmEigenValueSolver.eigenvalues()(0);
+  if (lmEigenVector) *lmEigenVector = lmEigenValueSolver.eigenvectors(1).col(0);
 
   if (lmEigenValue < 0) {
     // The largest-magnitude eigenvalue is negative, and therefore also the
@@ -589,10 +644,15 @@ static bool SparseMinimumEigenValue(
   // Lanczos iterations; this allows for rapid convergence in the case that
   // the relaxation is exact (since are starting close to a solution), while
   // simultaneously allowing the iterations to escape from this fixed point in
-  // the case that the relaxation is not exact.
+  // the case that the relaxation is not exact. If we have a guess for the
+  // minimum eigenvector, e.g., from the previous level of the staircase, we
+  // fuzz in its direction rather than in a random one.
   Vector v0 = S.row(0).transpose();
   Vector perturbation(v0.size());
-  perturbation.setRandom();
+  if (minEigenVectorGuess && minEigenVectorGuess->size() == v0.size())
+    perturbation = *minEigenVectorGuess;
+  else
+    perturbation.setRandom();
   perturbation.normalize();
   Vector xinit = v0 + (.03 * v0.norm()) * perturbation;  // Perturb v0 by ~3%
 
@@ -620,20 +680,38 @@ static bool SparseMinimumEigenValue(
 /* ************************************************************************* */
 template <size_t d>
 Sparse ShonanAveraging<d>::computeA(const Matrix &S) const {
-  auto Lambda = computeLambda(S);
-  return Lambda - Q_;
+  // Copy -Q, which has the sparsity pattern of A, and add Lambda in place
+  Sparse A = minusQ_;
+  const Matrix blocks = lambdaBlocks(S);
+  double *values = A.valuePtr();
+  for (size_t k = 0; k < lambdaIndices_.size(); k++)
+    values[lambdaIndices_[k]] += blocks.data()[k];
+  return A;
 }
 
 /* ************************************************************************* */
 template <size_t d>
 double ShonanAveraging<d>::computeMinEigenValue(const Values &values,
                                                 Vector *minEigenVector) const {
+  CertificateEigenvectors eigenvectors;
+  const double minEigenValue = computeMinEigenValue(values, eigenvectors);
+  if (minEigenVector) *minEigenVector = eigenvectors.minimum;
+  return minEigenValue;
+}
+
+/* ************************************************************************* */
+template <size_t d>
+double ShonanAveraging<d>::computeMinEigenValue(
+    const Values &values, CertificateEigenvectors &eigenvectors) const {
   assert(values.size() == nrUnknowns());
   const Matrix S = StiefelElementMatrix(values);
   auto A = computeA(S);
 
   double minEigenValue;
-  bool success = SparseMinimumEigenValue(A, S, &minEigenValue, minEigenVector);
+  const Vector guess = eigenvectors.minimum;
+  bool success = SparseMinimumEigenValue(
+      A, S, &minEigenValue, &eigenvectors.minimum, 0, 1000, 10e-4, 20,
+      &eigenvectors.largest, &guess);
   if (!success) {
     throw std::runtime_error(
         "SparseMinimumEigenValue failed to compute minimum eigenvalue.");
@@ -790,13 +868,14 @@ std::pair<Values, double> ShonanAveraging<d>::run(const Values &initialEstimate,
                                                   size_t pMax) const {
   Values Qstar;
   Values initialSOp = LiftTo<Rot>(pMin, initialEstimate);  // lift to pMin!
+  CertificateEigenvectors eigenvectors;  // warm-starts the next level
   for (size_t p = pMin; p <= pMax; p++) {
     // Optimize until convergence at this level
     Qstar = tryOptimizingAt(p, initialSOp);
 
     // Check certificate of global optimzality
-    Vector minEigenVector;
-    double minEigenValue = computeMinEigenValue(Qstar, &minEigenVector);
+    double minEigenValue = computeMinEigenValue(Qstar, eigenvectors);
+    const Vector &minEigenVector = eigenvectors.minimum;
     if (minEigenValue > parameters_.optimalityThreshold) {
       // If at global optimum, round and return solution
       const Values SO3Values = roundSolution(Qstar);
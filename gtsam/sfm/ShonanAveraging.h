@@ -118,6 +118,11 @@ class GTSAM_EXPORT ShonanAveraging {
   Sparse Q_;  // Sparse measurement matrix, == \tilde{R} in Eriksson18cvpr
   Sparse L_;  // connection Laplacian L = D - Q, needed for optimality check
 
+  // -Q, with explicit zeros for the d*d diagonal blocks of Lambda, so that
+  // computeA only needs to add Lambda's entries at lambdaIndices_
+  Sparse minusQ_;
+  std::vector<Eigen::Index> lambdaIndices_;
+
   /**
    * Build 3Nx3N sparse matrix consisting of rotation measurements, arranged as
    * (i,j) and (j,i) blocks within a sparse matrix.
@@ -127,6 +132,12 @@ class GTSAM_EXPORT ShonanAveraging {
   /// Build 3Nx3N sparse degree matrix D
   Sparse buildD() const;
 
+  /// Build minusQ_ and lambdaIndices_, the pattern of A reused by computeA
+  void buildPatternOfA();
+
+  /// The d*d diagonal blocks of Lambda(S), side by side in a d*dN matrix
+  Matrix lambdaBlocks(const Matrix &S) const;
+
  public:
   /// @name Standard Constructors
   /// @{
@@ -202,6 +213,23 @@ class GTSAM_EXPORT ShonanAveraging {
   double computeMinEigenValue(const Values &values,
                               Vector *minEigenVector = nullptr) const;
 
+  /// Eigenvectors of A found by computeMinEigenValue, to warm-start Lanczos
+  struct CertificateEigenvectors {
+    Vector largest;  ///< eigenvector of the largest-magnitude eigenvalue
+    Vector minimum;  ///< eigenvector of the minimum eigenvalue
+  };
+
+  /**
+   * Compute minimum eigenvalue for optimality check, starting the Lanczos
+   * iterations from the eigenvectors in `eigenvectors` unless they are empty,
+   * and storing the new eigenvectors there. A only changes a little from one
+   * level of the Riemannian staircase to the next, so the eigenvectors found
+   * at the previous level make good starting points, as in run.
+   * @param values: should be of type SOn
+   */
+  double computeMinEigenValue(const Values &values,
+                              CertificateEigenvectors &eigenvectors) const;
+
   /// Project pxdN Stiefel manifold matrix S to Rot3^N
   Values roundSolutionS(const Matrix &S) const;
 
@@ -352,6 +352,28 @@ TEST(ShonanAveraging3, PriorWeights) {
   auto result = shonan.run(initial, 3, 3);
   EXPECT_DOUBLES_EQUAL(0.0015, shonan.cost(result.first), 1e-4);
 }
+/* ************************************************************************* */
+// computeA reuses the sparsity pattern of -Q, and warm-started eigenvalue
+// computations agree with cold ones
+TEST(ShonanAveraging3, computeMinEigenValueWarmStart) {
+  std::mt19937 rng(7);
+  const Values random =
+      ShonanAveraging3::LiftTo<Rot3>(4, kShonan.initializeRandomly(rng));
+  const Matrix expectedA = kShonan.computeLambda_(random) - kShonan.denseQ();
+  EXPECT(assert_equal(expectedA, kShonan.computeA_(random)));
+
+  const double expected = kShonan.computeMinEigenValue(random);
+  ShonanAveraging3::CertificateEigenvectors eigenvectors;
+  EXPECT_DOUBLES_EQUAL(expected,
+                       kShonan.computeMinEigenValue(random, eigenvectors), 1e-3);
+  EXPECT_LONGS_EQUAL(15, eigenvectors.largest.size());
+  EXPECT_LONGS_EQUAL(15, eigenvectors.minimum.size());
+
+  // Starting from the eigenvectors just found
+  EXPECT_DOUBLES_EQUAL(expected,
+                       kShonan.computeMinEigenValue(random, eigenvectors), 1e-3);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
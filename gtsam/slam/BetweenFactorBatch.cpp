@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BetweenFactorBatch.cpp
+ * @brief   Batched linearization kernel for BetweenFactor<Pose3>
+ * @date    October 2026
+ */
+
+#include <gtsam/slam/BetweenFactorBatch.h>
+#include <gtsam/geometry/Pose3Batch.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_POSE3_EXPMAP
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+void LinearizeBetweenFactorsPose3(const NonlinearFactorGraph& graph,
+                                  const vector<size_t>& indices,
+                                  const Values& values,
+                                  GaussianFactorGraph* result) {
+  gttic(LinearizeBetweenFactorsPose3);
+  typedef BetweenFactor<Pose3> Factor;
+
+  // Gather the factors with Gaussian noise models and their poses
+  vector<const Factor*> factors;
+  vector<size_t> slots;
+  vector<Pose3> measured, poses1, poses2;
+  factors.reserve(indices.size());
+  slots.reserve(indices.size());
+  measured.reserve(indices.size());
+  poses1.reserve(indices.size());
+  poses2.reserve(indices.size());
+  for (size_t i : indices) {
+    const Factor* factor = static_cast<const Factor*>(graph[i].get());
+    const SharedNoiseModel& model = factor->noiseModel();
+    if (model && (model->isConstrained() ||
+                  !dynamic_cast<const noiseModel::Gaussian*>(model.get()))) {
+      (*result)[i] = factor->linearize(values);
+      continue;
+    }
+    factors.push_back(factor);
+    slots.push_back(i);
+    measured.push_back(factor->measured());
+    poses1.push_back(values.at<Pose3>(factor->key1()));
+    poses2.push_back(values.at<Pose3>(factor->key2()));
+  }
+  if (factors.empty()) return;
+
+  // h(x) = x1^-1 * x2 and the error Logmap(z^-1 * h(x)), as evaluateError
+  const Pose3Batch hx = Pose3Batch(poses1).between(Pose3Batch(poses2));
+  const Vector6Batch error = Pose3Batch::Logmap(Pose3Batch(measured).between(hx));
+
+  // H1 = -Ad(h(x)^-1) = [-R^T, 0; R^T [t]x, -R^T], H2 = I
+  const Matrix3Batch& R = hx.rotations().matrices();
+  const Vector3Batch& t = hx.translations();
+  const Eigen::Index n = R.rows();
+  const Eigen::ArrayXd zeros = Eigen::ArrayXd::Zero(n);
+  const Eigen::ArrayXd skew[9] = {zeros,      -t.col(2), t.col(1),
+                                  t.col(2),   zeros,     -t.col(0),
+                                  -t.col(1),  t.col(0),  zeros};
+  Matrix3Batch RtSkew(n, 9);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      RtSkew.col(3 * i + j) = R.col(i) * skew[j] + R.col(3 + i) * skew[3 + j] +
+                              R.col(6 + i) * skew[6 + j];
+
+  // Write [H1 H2 -e] straight into the factors and whiten in place
+  const vector<DenseIndex> dims{6, 6};
+  for (Eigen::Index k = 0; k < n; k++) {
+    const Factor& factor = *factors[k];
+    JacobianFactor::shared_ptr jacobian =
+        BatchLinearization::AllocateJacobian(factor.keys(), dims, 6);
+    Matrix& Ab = jacobian->matrixObject().matrix();
+    Ab.setZero();
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) {
+        Ab(i, j) = -R(k, 3 * j + i);
+        Ab(3 + i, 3 + j) = -R(k, 3 * j + i);
+        Ab(3 + i, j) = RtSkew(k, 3 * i + j);
+      }
+    Ab.block<6, 6>(0, 6).setIdentity();
+    Ab.col(12) = -error.row(k).transpose().matrix();
+    if (factor.noiseModel())
+      static_cast<const noiseModel::Gaussian&>(*factor.noiseModel())
+          .WhitenInPlace(Ab);
+    (*result)[slots[k]] = jacobian;
+  }
+}
+
+/* ************************************************************************* */
+namespace {
+// Registers the kernel when the library is loaded, as BatchLinearization
+// itself must not depend on slam
+struct RegisterBetweenFactorsPose3 {
+  RegisterBetweenFactorsPose3() {
+#if defined(GTSAM_POSE3_EXPMAP) && !defined(SLOW_BUT_CORRECT_BETWEENFACTOR)
+    BatchLinearization::Register<BetweenFactor<Pose3>>(
+        LinearizeBetweenFactorsPose3);
+#endif
+  }
+} registerBetweenFactorsPose3;
+}  // namespace
+
+}  // namespace gtsam
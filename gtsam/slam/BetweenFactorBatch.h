@@ -0,0 +1,43 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BetweenFactorBatch.h
+ * @brief   Batched linearization kernel for BetweenFactor<Pose3>
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/BatchLinearization.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+namespace gtsam {
+
+/**
+ * BatchLinearization::Kernel for BetweenFactor<Pose3>: gathers all poses into
+ * Pose3Batch arrays, evaluates the errors Logmap(z^-1 * x1^-1 * x2) and the
+ * Jacobians -Ad(h(x)^-1) and I for all factors in one pass, and whitens each
+ * factor's [A b] in place. Factors with robust or constrained noise models
+ * are linearized one by one.
+ *
+ * The kernel is registered with BatchLinearization when GTSAM is loaded, if
+ * the errors are the exponential coordinates of BetweenFactor::evaluateError,
+ * i.e., when GTSAM_POSE3_EXPMAP is defined and SLOW_BUT_CORRECT_BETWEENFACTOR
+ * is not. A program linked against a static GTSAM library only gets the
+ * registration if it uses this function, and should register it itself.
+ */
+GTSAM_EXPORT void LinearizeBetweenFactorsPose3(
+    const NonlinearFactorGraph& graph, const std::vector<size_t>& indices,
+    const Values& values, GaussianFactorGraph* result);
+
+}  // namespace gtsam
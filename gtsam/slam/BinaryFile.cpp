@@ -0,0 +1,568 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BinaryFile.cpp
+ * @brief   Versioned binary file format for factor graphs and Values
+ * @date    October 2026
+ */
+
+#include <gtsam/slam/BinaryFile.h>
+
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/sam/BearingRangeFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+#include <cstring>
+#include <functional>
+#include <typeindex>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+
+const char kMagic[8] = {'G', 'T', 'S', 'A', 'M', 'B', 'I', 'N'};
+const uint32_t kVersion = 1;
+const uint32_t kByteOrderMark = 0x01020304;
+const uint32_t kNoNoiseModel = 0xFFFFFFFF;
+const size_t kHeaderBytes = 16, kChunkHeaderBytes = 24;
+const uint64_t kMaxChunkCount = 1 << 16;
+const uint64_t kMaxNoiseDimension = 1 << 12;
+
+enum ChunkKind : uint32_t { SCHEMA = 1, NOISE = 2, VALUES = 3, FACTORS = 4 };
+enum NoiseKind : uint32_t { UNIT = 0, ISOTROPIC = 1, DIAGONAL = 2, GAUSSIAN = 3 };
+
+size_t padded(size_t bytes) { return (bytes + 7) & ~size_t(7); }
+
+template <class T>
+void append(vector<char>& buffer, const T& x) {
+  const char* p = reinterpret_cast<const char*>(&x);
+  buffer.insert(buffer.end(), p, p + sizeof(T));
+}
+
+template <class T>
+T readAs(const char* p) {
+  T x;
+  memcpy(&x, p, sizeof(T));
+  return x;
+}
+
+/* ************************************************************************* */
+// Value codecs, by run-time type for writing and by name for reading
+
+struct ValueCodec {
+  string name;
+  uint32_t size;
+  function<void(const Value&, double*)> encode;
+  function<void(Values&, Key, const double*)> insert;
+};
+
+template <class T>
+ValueCodec valueCodec() {
+  typedef BinaryEncoding<T> E;
+  ValueCodec codec;
+  codec.name = E::Name();
+  codec.size = E::size;
+  codec.encode = [](const Value& value, double* d) {
+    E::Encode(static_cast<const GenericValue<T>&>(value).value(), d);
+  };
+  codec.insert = [](Values& values, Key key, const double* d) {
+    values.insert(key, E::Decode(d));
+  };
+  return codec;
+}
+
+const map<type_index, ValueCodec>& valueCodecs() {
+  static const map<type_index, ValueCodec> codecs = {
+      {typeid(GenericValue<Point2>), valueCodec<Point2>()},
+      {typeid(GenericValue<Point3>), valueCodec<Point3>()},
+      {typeid(GenericValue<Rot2>), valueCodec<Rot2>()},
+      {typeid(GenericValue<Rot3>), valueCodec<Rot3>()},
+      {typeid(GenericValue<Pose2>), valueCodec<Pose2>()},
+      {typeid(GenericValue<Pose3>), valueCodec<Pose3>()}};
+  return codecs;
+}
+
+/* ************************************************************************* */
+// Factor codecs
+
+struct FactorCodec {
+  string name;
+  uint32_t keys, size;
+  size_t dim;  // dimension of the error, which the noise model must match
+  function<void(const NonlinearFactor&, double*)> encode;
+  function<NonlinearFactor::shared_ptr(const Key*, const double*,
+                                       const SharedNoiseModel&)>
+      decode;
+};
+
+template <class T>
+FactorCodec priorCodec() {
+  typedef BinaryEncoding<T> E;
+  FactorCodec codec;
+  codec.name = string("PriorFactor<") + E::Name() + ">";
+  codec.keys = 1;
+  codec.size = E::size;
+  codec.dim = traits<T>::dimension;
+  codec.encode = [](const NonlinearFactor& factor, double* d) {
+    E::Encode(static_cast<const PriorFactor<T>&>(factor).prior(), d);
+  };
+  codec.decode = [](const Key* keys, const double* d,
+                    const SharedNoiseModel& model) {
+    return boost::make_shared<PriorFactor<T> >(keys[0], E::Decode(d), model);
+  };
+  return codec;
+}
+
+template <class T>
+FactorCodec betweenCodec() {
+  typedef BinaryEncoding<T> E;
+  FactorCodec codec;
+  codec.name = string("BetweenFactor<") + E::Name() + ">";
+  codec.keys = 2;
+  codec.size = E::size;
+  codec.dim = traits<T>::dimension;
+  codec.encode = [](const NonlinearFactor& factor, double* d) {
+    E::Encode(static_cast<const BetweenFactor<T>&>(factor).measured(), d);
+  };
+  codec.decode = [](const Key* keys, const double* d,
+                    const SharedNoiseModel& model) {
+    return boost::make_shared<BetweenFactor<T> >(keys[0], keys[1],
+                                                 E::Decode(d), model);
+  };
+  return codec;
+}
+
+FactorCodec bearingRangeCodec() {
+  typedef BearingRangeFactor<Pose2, Point2> F;
+  FactorCodec codec;
+  codec.name = "BearingRangeFactor<Pose2,Point2>";
+  codec.keys = 2;
+  codec.size = 3;  // bearing as cos and sin, range
+  codec.dim = 2;
+  codec.encode = [](const NonlinearFactor& factor, double* d) {
+    const auto& measured = static_cast<const F&>(factor).measured();
+    BinaryEncoding<Rot2>::Encode(measured.bearing(), d);
+    d[2] = measured.range();
+  };
+  codec.decode = [](const Key* keys, const double* d,
+                    const SharedNoiseModel& model) {
+    return boost::make_shared<F>(keys[0], keys[1],
+                                 BinaryEncoding<Rot2>::Decode(d), d[2], model);
+  };
+  return codec;
+}
+
+const map<type_index, FactorCodec>& factorCodecs() {
+  static const map<type_index, FactorCodec> codecs = {
+      {typeid(PriorFactor<Point2>), priorCodec<Point2>()},
+      {typeid(PriorFactor<Point3>), priorCodec<Point3>()},
+      {typeid(PriorFactor<Rot2>), priorCodec<Rot2>()},
+      {typeid(PriorFactor<Rot3>), priorCodec<Rot3>()},
+      {typeid(PriorFactor<Pose2>), priorCodec<Pose2>()},
+      {typeid(PriorFactor<Pose3>), priorCodec<Pose3>()},
+      {typeid(BetweenFactor<Point2>), betweenCodec<Point2>()},
+      {typeid(BetweenFactor<Point3>), betweenCodec<Point3>()},
+      {typeid(BetweenFactor<Rot2>), betweenCodec<Rot2>()},
+      {typeid(BetweenFactor<Rot3>), betweenCodec<Rot3>()},
+      {typeid(BetweenFactor<Pose2>), betweenCodec<Pose2>()},
+      {typeid(BetweenFactor<Pose3>), betweenCodec<Pose3>()},
+      {typeid(BearingRangeFactor<Pose2, Point2>), bearingRangeCodec()}};
+  return codecs;
+}
+
+/// Find a codec by the name stored in a schema chunk
+template <class CODEC>
+const CODEC* findByName(const map<type_index, CODEC>& codecs,
+                        const string& name) {
+  for (const auto& entry : codecs)
+    if (entry.second.name == name) return &entry.second;
+  return nullptr;
+}
+
+/* ************************************************************************* */
+// Noise models are stored as their kind, dimension and parameters
+
+vector<double> noiseParameters(const noiseModel::Base& model, NoiseKind* kind) {
+  const type_info& type = typeid(model);
+  if (type == typeid(noiseModel::Unit)) {
+    *kind = UNIT;
+    return vector<double>();
+  } else if (type == typeid(noiseModel::Isotropic)) {
+    *kind = ISOTROPIC;
+    return vector<double>(
+        1, static_cast<const noiseModel::Isotropic&>(model).sigma());
+  } else if (type == typeid(noiseModel::Diagonal)) {
+    *kind = DIAGONAL;
+    const Vector sigmas = static_cast<const noiseModel::Diagonal&>(model).sigmas();
+    return vector<double>(sigmas.data(), sigmas.data() + sigmas.size());
+  } else if (type == typeid(noiseModel::Gaussian)) {
+    *kind = GAUSSIAN;
+    const Matrix R = static_cast<const noiseModel::Gaussian&>(model).R();
+    return vector<double>(R.data(), R.data() + R.size());  // column-major
+  }
+  throw invalid_argument(string("BinaryFileWriter: unsupported noise model ") +
+                         type.name());
+}
+
+SharedNoiseModel noiseModelFrom(uint32_t kind, uint64_t dim, const double* d,
+                                size_t n) {
+  // dim comes straight from the file: bound it before sizing anything by it
+  bool valid = dim <= kMaxNoiseDimension;
+  if (valid) {
+    switch (kind) {
+      case UNIT: valid = n == 0; break;
+      case ISOTROPIC: valid = n == 1; break;
+      case DIAGONAL: valid = n == dim; break;
+      case GAUSSIAN: valid = dim > 0 && n % dim == 0 && n / dim == dim; break;
+      default: valid = false;
+    }
+  }
+  if (!valid) throw runtime_error("MappedBinaryFile: invalid noise model");
+  switch (kind) {
+    case UNIT:
+      return noiseModel::Unit::Create(dim);
+    case ISOTROPIC:
+      return noiseModel::Isotropic::Sigma(dim, d[0], false);
+    case DIAGONAL:
+      return noiseModel::Diagonal::Sigmas(Eigen::Map<const Vector>(d, dim),
+                                          false);
+    default:
+      return noiseModel::Gaussian::SqrtInformation(
+          Eigen::Map<const Matrix>(d, dim, dim), false);
+  }
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BinaryFileWriter::BinaryFileWriter(const string& filename)
+    : os_(filename.c_str(), ios::binary | ios::trunc), filename_(filename) {
+  if (!os_) throw runtime_error("BinaryFileWriter: cannot open " + filename);
+  write(kMagic, sizeof(kMagic));
+  write(&kVersion, sizeof(kVersion));
+  write(&kByteOrderMark, sizeof(kByteOrderMark));
+}
+
+/* ************************************************************************* */
+BinaryFileWriter::~BinaryFileWriter() {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::write(const void* data, size_t bytes) {
+  os_.write(static_cast<const char*>(data), bytes);
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::writeChunk(uint32_t kind, uint32_t type, uint64_t count,
+                                  const void* payload, size_t bytes) {
+  const uint64_t paddedBytes = padded(bytes);
+  write(&kind, sizeof(kind));
+  write(&type, sizeof(type));
+  write(&count, sizeof(count));
+  write(&paddedBytes, sizeof(paddedBytes));
+  write(payload, bytes);
+  const char zeros[8] = {0};
+  write(zeros, paddedBytes - bytes);
+}
+
+/* ************************************************************************* */
+uint32_t BinaryFileWriter::typeId(const string& name, uint32_t kind,
+                                  uint32_t keys, uint32_t size) {
+  auto it = types_.find(name);
+  if (it != types_.end()) return it->second;
+
+  const uint32_t id = types_.size();
+  vector<char> schema;
+  append(schema, kind);
+  append(schema, keys);
+  append(schema, size);
+  append(schema, uint32_t(name.size()));
+  schema.insert(schema.end(), name.begin(), name.end());
+  writeChunk(SCHEMA, id, 0, schema.data(), schema.size());
+  types_[name] = id;
+  return id;
+}
+
+/* ************************************************************************* */
+uint32_t BinaryFileWriter::noiseId(const SharedNoiseModel& model) {
+  if (!model) return kNoNoiseModel;
+  NoiseKind kind;
+  const vector<double> parameters = noiseParameters(*model, &kind);
+  const uint32_t dim = model->dim();
+
+  // Identical noise models are stored once
+  string content(reinterpret_cast<const char*>(&kind), sizeof(kind));
+  content.append(reinterpret_cast<const char*>(&dim), sizeof(dim));
+  content.append(reinterpret_cast<const char*>(parameters.data()),
+                 parameters.size() * sizeof(double));
+  auto it = noiseModels_.find(content);
+  if (it != noiseModels_.end()) return it->second;
+
+  const uint32_t id = noiseModels_.size();
+  writeChunk(NOISE, kind, dim, parameters.data(),
+             parameters.size() * sizeof(double));
+  noiseModels_[content] = id;
+  return id;
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::startChunk(uint32_t kind, uint32_t type) {
+  if (chunk_.count > 0 &&
+      (chunk_.kind != kind || chunk_.type != type ||
+       chunk_.count >= kMaxChunkCount))
+    flush();
+  chunk_.kind = kind;
+  chunk_.type = type;
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::flush() {
+  if (chunk_.count == 0) return;
+  const size_t keyBytes = chunk_.keys.size() * sizeof(Key);
+  const uint64_t bytes = keyBytes + chunk_.payload.size();
+  write(&chunk_.kind, sizeof(chunk_.kind));
+  write(&chunk_.type, sizeof(chunk_.type));
+  write(&chunk_.count, sizeof(chunk_.count));
+  write(&bytes, sizeof(bytes));
+  write(chunk_.keys.data(), keyBytes);
+  write(chunk_.payload.data(), chunk_.payload.size());
+  chunk_.count = 0;
+  chunk_.keys.clear();
+  chunk_.payload.clear();
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::add(Key key, const Value& value) {
+  auto it = valueCodecs().find(typeid(value));
+  if (it == valueCodecs().end())
+    throw invalid_argument(string("BinaryFileWriter: unsupported value type ") +
+                           typeid(value).name());
+  const ValueCodec& codec = it->second;
+  startChunk(VALUES, typeId(codec.name, VALUES, 0, codec.size));
+
+  const size_t offset = chunk_.payload.size();
+  chunk_.payload.resize(offset + codec.size * sizeof(double));
+  double d[BinaryEncoding<Pose3>::size];
+  codec.encode(value, d);
+  memcpy(chunk_.payload.data() + offset, d, codec.size * sizeof(double));
+  chunk_.keys.push_back(key);
+  ++chunk_.count;
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::add(const Values& values) {
+  for (const auto& key_value : values) add(key_value.key, key_value.value);
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::add(const NonlinearFactor::shared_ptr& factor) {
+  if (!factor) throw invalid_argument("BinaryFileWriter: null factor");
+  auto it = factorCodecs().find(typeid(*factor));
+  if (it == factorCodecs().end())
+    throw invalid_argument(string("BinaryFileWriter: unsupported factor type ") +
+                           typeid(*factor).name());
+  const FactorCodec& codec = it->second;
+  const uint32_t noise = noiseId(
+      static_cast<const NoiseModelFactor&>(*factor).noiseModel());
+  startChunk(FACTORS, typeId(codec.name, FACTORS, codec.keys, codec.size));
+
+  // Record: noise model index, padding, keys, parameters
+  append(chunk_.payload, noise);
+  append(chunk_.payload, uint32_t(0));
+  for (Key key : factor->keys()) append(chunk_.payload, key);
+  double d[BinaryEncoding<Pose3>::size];
+  codec.encode(*factor, d);
+  for (size_t i = 0; i < codec.size; i++) append(chunk_.payload, d[i]);
+  ++chunk_.count;
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::add(const NonlinearFactorGraph& graph) {
+  for (const auto& factor : graph)
+    if (factor) add(factor);
+}
+
+/* ************************************************************************* */
+void BinaryFileWriter::close() {
+  if (!os_.is_open()) return;
+  flush();
+  os_.close();
+  if (os_.fail())
+    throw runtime_error("BinaryFileWriter: error writing " + filename_);
+}
+
+/* ************************************************************************* */
+void writeBinary(const string& filename, const NonlinearFactorGraph& graph,
+                 const Values& values) {
+  BinaryFileWriter writer(filename);
+  writer.add(values);
+  writer.add(graph);
+  writer.close();
+}
+
+/* ************************************************************************* */
+MappedBinaryFile::MappedBinaryFile(const string& filename)
+    : file_(filename) {
+  const char* data = file_.data();
+  const size_t size = file_.size();
+  try {
+    if (size < kHeaderBytes || memcmp(data, kMagic, sizeof(kMagic)) != 0)
+      throw runtime_error("not a GTSAM binary file");
+    version_ = readAs<uint32_t>(data + 8);
+    if (version_ != kVersion)
+      throw runtime_error("unsupported format version " + to_string(version_));
+    if (readAs<uint32_t>(data + 12) != kByteOrderMark)
+      throw runtime_error("file was written with a different byte order");
+
+    // Index the chunks
+    size_t offset = kHeaderBytes;
+    while (offset < size) {
+      if (size - offset < kChunkHeaderBytes)
+        throw runtime_error("truncated chunk header");
+      const char* header = data + offset;
+      const uint32_t kind = readAs<uint32_t>(header);
+      const uint32_t type = readAs<uint32_t>(header + 4);
+      const uint64_t count = readAs<uint64_t>(header + 8);
+      const uint64_t bytes = readAs<uint64_t>(header + 16);
+      const char* payload = header + kChunkHeaderBytes;
+      if (bytes > size - offset - kChunkHeaderBytes || bytes % 8 != 0)
+        throw runtime_error("truncated chunk");
+
+      if (kind == SCHEMA) {
+        if (bytes < 16) throw runtime_error("invalid schema");
+        Schema schema;
+        schema.kind = readAs<uint32_t>(payload);
+        schema.keys = readAs<uint32_t>(payload + 4);
+        schema.size = readAs<uint32_t>(payload + 8);
+        const uint32_t length = readAs<uint32_t>(payload + 12);
+        if (length > bytes - 16) throw runtime_error("invalid schema");
+        schema.name.assign(payload + 16, length);
+        // Only known types can be decoded, and only with the layout their
+        // codec writes: records are indexed by the schema but decoded by name
+        bool matches;
+        if (schema.kind == VALUES) {
+          const ValueCodec* codec = findByName(valueCodecs(), schema.name);
+          if (!codec) throw runtime_error("unknown type " + schema.name);
+          matches = schema.keys == 0 && schema.size == codec->size;
+        } else if (schema.kind == FACTORS) {
+          const FactorCodec* codec = findByName(factorCodecs(), schema.name);
+          if (!codec) throw runtime_error("unknown type " + schema.name);
+          matches = schema.keys == codec->keys && schema.size == codec->size;
+        } else {
+          throw runtime_error("invalid schema");
+        }
+        if (!matches)
+          throw runtime_error("schema does not match type " + schema.name);
+        schemas_[type] = schema;
+      } else if (kind == NOISE) {
+        noiseModels_.push_back(noiseModelFrom(
+            type, count, reinterpret_cast<const double*>(payload), bytes / 8));
+      } else if (kind == VALUES || kind == FACTORS) {
+        auto it = schemas_.find(type);
+        if (it == schemas_.end() || it->second.kind != kind)
+          throw runtime_error("chunk of undeclared type");
+        const Schema& schema = it->second;
+        const size_t stride = kind == VALUES
+                                  ? 8 + 8 * schema.size
+                                  : 8 + 8 * (schema.keys + schema.size);
+        if (count > kMaxChunkCount || bytes % stride != 0 ||
+            count != bytes / stride)
+          throw runtime_error("chunk size does not match its type");
+        if (kind == VALUES) {
+          ValueBlock block;
+          block.type = schema.name;
+          block.size = schema.size;
+          block.count = count;
+          block.keys = reinterpret_cast<const Key*>(payload);
+          block.data = reinterpret_cast<const double*>(payload + 8 * count);
+          valueBlocks_.push_back(block);
+        } else {
+          FactorBlock block = {type, static_cast<size_t>(count), payload};
+          factorBlocks_.push_back(block);
+        }
+      }
+      // Unknown chunk kinds are skipped, for forward compatibility
+      offset += kChunkHeaderBytes + bytes;
+    }
+  } catch (const runtime_error& e) {
+    throw runtime_error("MappedBinaryFile: " + filename + ": " + e.what());
+  }
+}
+
+/* ************************************************************************* */
+size_t MappedBinaryFile::nrValues() const {
+  size_t n = 0;
+  for (const ValueBlock& block : valueBlocks_) n += block.count;
+  return n;
+}
+
+/* ************************************************************************* */
+size_t MappedBinaryFile::nrFactors() const {
+  size_t n = 0;
+  for (const FactorBlock& block : factorBlocks_) n += block.count;
+  return n;
+}
+
+/* ************************************************************************* */
+Values MappedBinaryFile::values() const {
+  Values values;
+  for (const ValueBlock& block : valueBlocks_) {
+    const ValueCodec* codec = findByName(valueCodecs(), block.type);
+    for (size_t i = 0; i < block.count; i++)
+      codec->insert(values, block.keys[i], block.data + i * block.size);
+  }
+  return values;
+}
+
+/* ************************************************************************* */
+NonlinearFactorGraph MappedBinaryFile::graph() const {
+  NonlinearFactorGraph graph;
+  graph.reserve(nrFactors());
+  for (const FactorBlock& block : factorBlocks_) {
+    const Schema& schema = schemas_.at(block.type);
+    const FactorCodec* codec = findByName(factorCodecs(), schema.name);
+    const size_t stride = 8 + 8 * (schema.keys + schema.size);
+    for (size_t i = 0; i < block.count; i++) {
+      const char* record = block.records + i * stride;
+      const uint32_t noise = readAs<uint32_t>(record);
+      if (noise != kNoNoiseModel && noise >= noiseModels_.size())
+        throw runtime_error("MappedBinaryFile: undeclared noise model");
+      if (noise != kNoNoiseModel && noiseModels_[noise]->dim() != codec->dim)
+        throw runtime_error("MappedBinaryFile: noise model of dimension " +
+                            to_string(noiseModels_[noise]->dim()) + " for " +
+                            schema.name);
+      const Key* keys = reinterpret_cast<const Key*>(record + 8);
+      const double* d =
+          reinterpret_cast<const double*>(record + 8 + 8 * schema.keys);
+      graph.push_back(codec->decode(
+          keys, d,
+          noise == kNoNoiseModel ? SharedNoiseModel() : noiseModels_[noise]));
+    }
+  }
+  return graph;
+}
+
+/* ************************************************************************* */
+pair<NonlinearFactorGraph::shared_ptr, Values::shared_ptr> readBinary(
+    const string& filename) {
+  const MappedBinaryFile file(filename);
+  return make_pair(boost::make_shared<NonlinearFactorGraph>(file.graph()),
+                   boost::make_shared<Values>(file.values()));
+}
+
+}  // namespace gtsam
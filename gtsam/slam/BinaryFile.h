@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BinaryFile.h
+ * @brief   Versioned binary file format for factor graphs and Values, that
+ *          can be written as a stream and read from a memory-mapped file
+ * @date    October 2026
+ *
+ * A file starts with a header (magic "GTSAMBIN", format version, byte order
+ * mark) followed by a sequence of chunks. Every chunk has a 24-byte header
+ * giving its kind, a type id, a count and its payload size, so readers can
+ * skip what they do not need, and all payloads are 8-byte aligned:
+ *  - SCHEMA chunks describe a type before its first use: its name, e.g.
+ *    "Pose3" or "BetweenFactor<Pose3>", its number of keys and its number of
+ *    parameters, which are stored as doubles,
+ *  - NOISE chunks hold one noise model each, shared by all factors with an
+ *    identical noise model,
+ *  - VALUES chunks hold `count` values of one type as an array of keys
+ *    followed by an array of parameters,
+ *  - FACTORS chunks hold `count` factors of one type, each a noise model
+ *    index, its keys and its parameters.
+ *
+ * Because values are stored as plain arrays, MappedBinaryFile can hand them
+ * out in place, without building a Values, and both values and factors are
+ * constructed straight from the mapped pages instead of through an archive.
+ * Supported are the Point2, Point3, Rot2, Rot3, Pose2 and Pose3 values,
+ * PriorFactor and BetweenFactor on all of them, BearingRangeFactor<Pose2,
+ * Point2>, and the Unit, Isotropic, Diagonal and Gaussian noise models.
+ * Writing anything else throws std::invalid_argument.
+ */
+
+#pragma once
+
+#include <gtsam/base/MappedFile.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * How a value type is stored in a binary file: its schema name, its number
+ * of parameters, and conversions from and to an array of doubles.
+ */
+template <class T>
+struct BinaryEncoding;
+
+template <>
+struct BinaryEncoding<Point2> {
+  static const char* Name() { return "Point2"; }
+  static const size_t size = 2;
+  static void Encode(const Point2& p, double* d) { d[0] = p.x(); d[1] = p.y(); }
+  static Point2 Decode(const double* d) { return Point2(d[0], d[1]); }
+};
+
+template <>
+struct BinaryEncoding<Point3> {
+  static const char* Name() { return "Point3"; }
+  static const size_t size = 3;
+  static void Encode(const Point3& p, double* d) {
+    d[0] = p.x(); d[1] = p.y(); d[2] = p.z();
+  }
+  static Point3 Decode(const double* d) { return Point3(d[0], d[1], d[2]); }
+};
+
+template <>
+struct BinaryEncoding<Rot2> {
+  static const char* Name() { return "Rot2"; }
+  static const size_t size = 2;
+  static void Encode(const Rot2& R, double* d) { d[0] = R.c(); d[1] = R.s(); }
+  static Rot2 Decode(const double* d) { return Rot2::fromCosSin(d[0], d[1]); }
+};
+
+template <>
+struct BinaryEncoding<Rot3> {
+  static const char* Name() { return "Rot3"; }
+  static const size_t size = 9;  ///< rotation matrix, row-major
+  static void Encode(const Rot3& R, double* d) {
+    Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor> > M(d);
+    M = R.matrix();
+  }
+  static Rot3 Decode(const double* d) {
+    return Rot3(Matrix3(
+        Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(d)));
+  }
+};
+
+template <>
+struct BinaryEncoding<Pose2> {
+  static const char* Name() { return "Pose2"; }
+  static const size_t size = 4;  ///< x, y, cos, sin
+  static void Encode(const Pose2& T, double* d) {
+    d[0] = T.x(); d[1] = T.y();
+    BinaryEncoding<Rot2>::Encode(T.r(), d + 2);
+  }
+  static Pose2 Decode(const double* d) {
+    return Pose2(BinaryEncoding<Rot2>::Decode(d + 2), Point2(d[0], d[1]));
+  }
+};
+
+template <>
+struct BinaryEncoding<Pose3> {
+  static const char* Name() { return "Pose3"; }
+  static const size_t size = 12;  ///< rotation matrix, then translation
+  static void Encode(const Pose3& T, double* d) {
+    BinaryEncoding<Rot3>::Encode(T.rotation(), d);
+    BinaryEncoding<Point3>::Encode(T.translation(), d + 9);
+  }
+  static Pose3 Decode(const double* d) {
+    return Pose3(BinaryEncoding<Rot3>::Decode(d),
+                 BinaryEncoding<Point3>::Decode(d + 9));
+  }
+};
+
+/**
+ * Writes a binary file incrementally, so that a large graph never has to be
+ * held in memory in full. Values and factors may be added in any order;
+ * consecutive ones of the same type are written as one chunk.
+ */
+class GTSAM_EXPORT BinaryFileWriter {
+ public:
+  /// Create the file and write its header. Throws std::runtime_error.
+  explicit BinaryFileWriter(const std::string& filename);
+
+  /// Flushes and closes the file, see close()
+  ~BinaryFileWriter();
+
+  /// Append a single value
+  void add(Key key, const Value& value);
+
+  /// Append all values
+  void add(const Values& values);
+
+  /// Append a single factor
+  void add(const NonlinearFactor::shared_ptr& factor);
+
+  /// Append all factors
+  void add(const NonlinearFactorGraph& graph);
+
+  /// Write any buffered chunk and close the file. Throws on I/O errors.
+  void close();
+
+ private:
+  struct Chunk {
+    uint32_t kind = 0, type = 0;
+    uint64_t count = 0;
+    std::vector<Key> keys;        ///< keys of a VALUES chunk
+    std::vector<char> payload;    ///< parameters, or factor records
+  };
+
+  uint32_t typeId(const std::string& name, uint32_t kind, uint32_t keys,
+                  uint32_t size);
+  uint32_t noiseId(const SharedNoiseModel& model);
+  void startChunk(uint32_t kind, uint32_t type);
+  void writeChunk(uint32_t kind, uint32_t type, uint64_t count,
+                  const void* payload, size_t bytes);
+  void write(const void* data, size_t bytes);
+  void flush();
+
+  std::ofstream os_;
+  std::string filename_;
+  Chunk chunk_;  ///< chunk being filled
+  std::map<std::string, uint32_t> types_;
+  std::map<std::string, uint32_t> noiseModels_;  ///< by encoded content
+};
+
+/// Write a graph and its values to a binary file.
+GTSAM_EXPORT void writeBinary(const std::string& filename,
+                              const NonlinearFactorGraph& graph,
+                              const Values& values);
+
+/**
+ * A binary file mapped into memory (read into memory on platforms without
+ * mmap). Values can be read in place through valueBlocks(); values() and
+ * graph() construct the GTSAM objects directly from the mapped buffer.
+ */
+class GTSAM_EXPORT MappedBinaryFile {
+ public:
+  /// A run of values of one type, pointing into the mapped file
+  struct ValueBlock {
+    std::string type;      ///< schema name, e.g. "Pose3"
+    size_t size;           ///< number of parameters of each value
+    size_t count;          ///< number of values
+    const Key* keys;       ///< count keys
+    const double* data;    ///< count * size parameters
+
+    /// Decode the i-th value, which must be of type T
+    template <class T>
+    T at(size_t i) const {
+      if (type != BinaryEncoding<T>::Name())
+        throw std::invalid_argument("ValueBlock::at: block holds " + type);
+      if (i >= count)
+        throw std::out_of_range("ValueBlock::at: index out of range");
+      return BinaryEncoding<T>::Decode(data + i * size);
+    }
+  };
+
+  /// Map the file and index its chunks. Throws std::runtime_error if the
+  /// file cannot be read or is not a valid binary file of this version.
+  explicit MappedBinaryFile(const std::string& filename);
+
+  /// Format version of the file
+  uint32_t version() const { return version_; }
+
+  /// Values in the file, as blocks in the mapped memory
+  const std::vector<ValueBlock>& valueBlocks() const { return valueBlocks_; }
+
+  size_t nrValues() const;   ///< total number of values
+  size_t nrFactors() const;  ///< total number of factors
+
+  /// Construct all values
+  Values values() const;
+
+  /// Construct all factors, in the order in which they were written. Throws
+  /// std::runtime_error if a noise model does not match its factor.
+  NonlinearFactorGraph graph() const;
+
+ private:
+  struct Schema {
+    std::string name;
+    uint32_t kind, keys, size;
+  };
+  struct FactorBlock {
+    uint32_t type;
+    size_t count;
+    const char* records;
+  };
+
+  MappedFile file_;
+  uint32_t version_ = 0;
+  std::map<uint32_t, Schema> schemas_;
+  std::vector<ValueBlock> valueBlocks_;
+  std::vector<FactorBlock> factorBlocks_;
+  std::vector<SharedNoiseModel> noiseModels_;
+};
+
+/// Read a graph and its values from a binary file.
+GTSAM_EXPORT std::pair<NonlinearFactorGraph::shared_ptr, Values::shared_ptr>
+readBinary(const std::string& filename);
+
+}  // namespace gtsam
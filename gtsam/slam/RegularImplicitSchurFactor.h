@@ -11,8 +11,10 @@
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/VectorValues.h>
 
+#include <cassert>
 #include <iosfwd>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -20,6 +22,10 @@ namespace gtsam {
 
 /**
  * RegularImplicitSchurFactor
+ *
+ * The Hessian-vector products, gradients and diagonals do not allocate, and
+ * can be called on several factors at once from different threads, as
+ * GaussianFactorGraph::multiplyHessianAdd does when built with TBB.
  */
 template<class CAMERA>
 class RegularImplicitSchurFactor: public GaussianFactor {
@@ -39,9 +45,15 @@ protected:
 
   typedef Eigen::Matrix<double, ZDim, D> MatrixZD; ///< type of an F block
   typedef Eigen::Matrix<double, D, D> MatrixDD; ///< camera hessian
+  typedef Eigen::Matrix<double, ZDim, 3> MatrixZ3; ///< type of an E block
+  typedef Eigen::Matrix<double, D, 1> VectorD; ///< camera vector
+
+  // Use eigen magic to access raw memory
+  typedef Eigen::Map<VectorD> DMap;
+  typedef Eigen::Map<const VectorD> ConstDMap;
 
   const std::vector<MatrixZD, Eigen::aligned_allocator<MatrixZD> > FBlocks_; ///< All ZDim*D F blocks (one for each camera)
-  const Matrix PointCovariance_; ///< the 3*3 matrix P = inv(E'E) (2*2 if degenerate)
+  const Matrix PointCovariance_; ///< the 3*3 matrix P = inv(E'E)
   const Matrix E_; ///< The 2m*3 E Jacobian with respect to the point
   const Vector b_; ///< 2m-dimensional RHS vector
 
@@ -51,11 +63,16 @@ public:
   RegularImplicitSchurFactor() {
   }
 
-  /// Construct from blocks of F, E, inv(E'*E), and RHS vector b
+  /// Construct from blocks of F, E, inv(E'*E), and RHS vector b.
+  /// Only 3D points are supported: throws std::invalid_argument unless E has
+  /// three columns and P is 3*3.
   RegularImplicitSchurFactor(const KeyVector& keys,
       const std::vector<MatrixZD, Eigen::aligned_allocator<MatrixZD> >& FBlocks, const Matrix& E, const Matrix& P,
       const Vector& b) :
       GaussianFactor(keys), FBlocks_(FBlocks), PointCovariance_(P), E_(E), b_(b) {
+    if (E.cols() != 3 || P.rows() != 3 || P.cols() != 3)
+      throw std::invalid_argument(
+          "RegularImplicitSchurFactor: E must be 2m*3 and P 3*3");
   }
 
   /// Destructor
@@ -149,26 +166,9 @@ public:
 
   /// Add the diagonal of the Hessian for this factor to existing VectorValues
   void hessianDiagonalAdd(VectorValues &d) const override {
-    // diag(Hessian) = diag(F' * (I - E * PointCov * E') * F);
     for (size_t k = 0; k < size(); ++k) { // for each camera
-      Key j = keys_[k];
-
-      // Calculate Fj'*Ej for the current camera (observing a single point)
-      // D x 3 = (D x ZDim) * (ZDim x 3)
-      const MatrixZD& Fj = FBlocks_[k];
-      Eigen::Matrix<double, D, 3> FtE = Fj.transpose()
-                                        * E_.block<ZDim, 3>(ZDim * k, 0);
-
-      Eigen::Matrix<double, D, 1> dj;
-      for (int k = 0; k < D; ++k) { // for each diagonal element of the camera hessian
-        // Vector column_k_Fj = Fj.col(k);
-        dj(k) = Fj.col(k).squaredNorm(); // dot(column_k_Fj, column_k_Fj);
-        // Vector column_k_FtE = FtE.row(k);
-        // (1 x 1) = (1 x 3) * (3 * 3) * (3 x 1)
-        dj(k) -= FtE.row(k) * PointCovariance_ * FtE.row(k).transpose();
-      }
-
-      auto result = d.emplace(j, dj);
+      const VectorD dj = hessianDiagonalBlock(k);
+      auto result = d.emplace(keys_[k], dj);
       if(!result.second) {
         result.first->second += dj;
       }
@@ -180,28 +180,8 @@ public:
    * d(output) = d(input) + deltaHessianFactor
    */
   void hessianDiagonal(double* d) const override {
-    // diag(Hessian) = diag(F' * (I - E * PointCov * E') * F);
-    // Use eigen magic to access raw memory
-    typedef Eigen::Matrix<double, D, 1> DVector;
-    typedef Eigen::Map<DVector> DMap;
-
-    for (size_t pos = 0; pos < size(); ++pos) { // for each camera in the factor
-      Key j = keys_[pos];
-
-      // Calculate Fj'*Ej for the current camera (observing a single point)
-      // D x 3 = (D x ZDim) * (ZDim x 3)
-      const MatrixZD& Fj = FBlocks_[pos];
-      Eigen::Matrix<double, D, 3> FtE = Fj.transpose()
-          * E_.block<ZDim, 3>(ZDim * pos, 0);
-
-      DVector dj;
-      for (int k = 0; k < D; ++k) { // for each diagonal element of the camera hessian
-        dj(k) = Fj.col(k).squaredNorm();
-        // (1 x 1) = (1 x 3) * (3 * 3) * (3 x 1)
-        dj(k) -= FtE.row(k) * PointCovariance_ * FtE.row(k).transpose();
-      }
-      DMap(d + D * j) += dj;
-    }
+    for (size_t pos = 0; pos < size(); ++pos) // for each camera in the factor
+      DMap(d + D * keys_[pos]) += hessianDiagonalBlock(pos);
   }
 
   /// Return the block diagonal of the Hessian for this factor
@@ -212,20 +192,10 @@ public:
       Key j = keys_[pos];
       // F'*F - F'*E*P*E'*F  e.g. (9*2)*(2*9) - (9*2)*(2*3)*(3*3)*(3*2)*(2*9)
       const MatrixZD& Fj = FBlocks_[pos];
-      //      Eigen::Matrix<double, D, 3> FtE = Fj.transpose()
-      //          * E_.block<ZDim, 3>(ZDim * pos, 0);
-      //      blocks[j] = Fj.transpose() * Fj
-      //          - FtE * PointCovariance_ * FtE.transpose();
-
-      const Matrix23& Ej = E_.block<ZDim, 3>(ZDim * pos, 0);
-      blocks[j] = Fj.transpose()
-          * (Fj - Ej * PointCovariance_ * Ej.transpose() * Fj);
-
-      // F'*(I - E*P*E')*F, TODO: this should work, but it does not :-(
-      //      static const Eigen::Matrix<double, ZDim, ZDim> I2 = eye(ZDim);
-      //      Matrix2 Q = //
-      //          I2 - E_.block<ZDim, 3>(ZDim * pos, 0) * PointCovariance_ * E_.block<ZDim, 3>(ZDim * pos, 0).transpose();
-      //      blocks[j] = Fj.transpose() * Q * Fj;
+      const MatrixZ3 Ej = Eblock(pos);
+      const MatrixDD Hjj = Fj.transpose()
+          * (Fj - Ej * (pointCovariance() * (Ej.transpose() * Fj)));
+      blocks[j] = Hjj;
     }
     return blocks;
   }
@@ -293,19 +263,20 @@ public:
    * (x'*H*x - 2*x'*eta + f) = x'*F'*Q*F*x - 2*x'*F'*Q *b + f = x'*F'*Q*(F*x - 2*b) + f
    */
   double error(const VectorValues& x) const override {
+    Error2s& e1 = Scratch(size());
 
-    // resize does not do malloc if correct size
-    e1.resize(size());
-    e2.resize(size());
-
-    // e1 = F * x - b = (2m*dm)*dm
-    for (size_t k = 0; k < size(); ++k)
+    // e1 = F * x, and d = P * E' * (e1 - ZDim*b)
+    Vector3 d1 = Vector3::Zero();
+    for (size_t k = 0; k < size(); ++k) {
       e1[k] = FBlocks_[k] * x.at(keys_[k]);
-    projectError2(e1, e2);
+      d1 += Eblock(k).transpose() * (e1[k] - ZDim * bk(k));
+    }
+    const Vector3 d2 = pointCovariance() * d1;
 
+    // e1' * (e1 - ZDim*b - E*d)
     double result = 0;
     for (size_t k = 0; k < size(); ++k)
-      result += dot(e1[k], e2[k]);
+      result += dot(e1[k], e1[k] - ZDim * bk(k) - Eblock(k) * d2);
 
     double f = b_.squaredNorm();
     return 0.5 * (result + f);
@@ -315,23 +286,24 @@ public:
   // This is wrong and does not match the definition in Hessian,
   // but it matches the definition of the Jacobian factor (JF)
   double errorJF(const VectorValues& x) const {
+    Error2s& e1 = Scratch(size());
 
-    // resize does not do malloc if correct size
-    e1.resize(size());
-    e2.resize(size());
-
-    // e1 = F * x - b = (2m*dm)*dm
-    for (size_t k = 0; k < size(); ++k)
-      e1[k] = FBlocks_[k] * x.at(keys_[k]) - b_.segment<ZDim>(k * ZDim);
-    projectError(e1, e2);
+    // e1 = F * x - b = (2m*dm)*dm, and d = P * E' * e1
+    Vector3 d1 = Vector3::Zero();
+    for (size_t k = 0; k < size(); ++k) {
+      e1[k] = FBlocks_[k] * x.at(keys_[k]) - bk(k);
+      d1 += Eblock(k).transpose() * e1[k];
+    }
+    const Vector3 d2 = pointCovariance() * d1;
 
     double result = 0;
     for (size_t k = 0; k < size(); ++k)
-      result += dot(e2[k], e2[k]);
+      result += (e1[k] - Eblock(k) * d2).squaredNorm();
 
     // std::cout << "implicitFactor::error result " << result << std::endl;
     return 0.5 * result;
   }
+
   /**
    * @brief Calculate corrected error Q*e = (I - E*P*E')*e
    */
@@ -351,37 +323,25 @@ public:
       e2[k] = e1[k] - E_.block<ZDim, 3>(ZDim * k, 0) * d2;
   }
 
-  /// Scratch space for multiplyHessianAdd
-  mutable Error2s e1, e2;
-
   /**
    * @brief double* Hessian-vector multiply, i.e. y += F'*alpha*(I - E*P*E')*F*x
    * RAW memory access! Assumes keys start at 0 and go to M-1, and x and and y are laid out that way
    */
   void multiplyHessianAdd(double alpha, const double* x, double* y) const {
+    Error2s& e = Scratch(size());
 
-    // Use eigen magic to access raw memory
-    typedef Eigen::Matrix<double, D, 1> DVector;
-    typedef Eigen::Map<DVector> DMap;
-    typedef Eigen::Map<const DVector> ConstDMap;
-
-    // resize does not do malloc if correct size
-    e1.resize(size());
-    e2.resize(size());
-
-    // e1 = F * x = (2m*dm)*dm
+    // e = F * x = (2m*dm)*dm, and d = P * E' * e
+    Vector3 d1 = Vector3::Zero();
     for (size_t k = 0; k < size(); ++k) {
-      Key key = keys_[k];
-      e1[k] = FBlocks_[k] * ConstDMap(x + D * key);
+      e[k] = FBlocks_[k] * ConstDMap(x + D * keys_[k]);
+      d1 += Eblock(k).transpose() * e[k];
     }
+    const Vector3 d2 = alpha * (pointCovariance() * d1);
 
-    projectError(e1, e2);
-
-    // y += F.transpose()*e2 = (2d*2m)*2m
-    for (size_t k = 0; k < size(); ++k) {
-      Key key = keys_[k];
-      DMap(y + D * key) += FBlocks_[k].transpose() * alpha * e2[k];
-    }
+    // y += F.transpose()*alpha*(e - E*d) = (2d*2m)*2m
+    for (size_t k = 0; k < size(); ++k)
+      DMap(y + D * keys_[k]) +=
+          FBlocks_[k].transpose() * (alpha * e[k] - Eblock(k) * d2);
   }
 
   void multiplyHessianAdd(double alpha, const double* x, double* y,
@@ -393,18 +353,17 @@ public:
    */
   void multiplyHessianAdd(double alpha, const VectorValues& x,
       VectorValues& y) const override {
+    Error2s& e = Scratch(size());
 
-    // resize does not do malloc if correct size
-    e1.resize(size());
-    e2.resize(size());
-
-    // e1 = F * x = (2m*dm)*dm
-    for (size_t k = 0; k < size(); ++k)
-      e1[k] = FBlocks_[k] * x.at(keys_[k]);
-
-    projectError(e1, e2);
+    // e = F * x = (2m*dm)*dm, and d = P * E' * e
+    Vector3 d1 = Vector3::Zero();
+    for (size_t k = 0; k < size(); ++k) {
+      e[k] = FBlocks_[k] * x.at(keys_[k]);
+      d1 += Eblock(k).transpose() * e[k];
+    }
+    const Vector3 d2 = alpha * (pointCovariance() * d1);
 
-    // y += F.transpose()*e2 = (2d*2m)*2m
+    // y += F.transpose()*alpha*(e - E*d) = (2d*2m)*2m
     for (size_t k = 0; k < size(); ++k) {
       Key key = keys_[k];
       static const Vector empty;
@@ -413,7 +372,7 @@ public:
       // Create the value as a zero vector if it does not exist.
       if (it.second)
         yi = Vector::Zero(FBlocks_[k].cols());
-      yi += FBlocks_[k].transpose() * alpha * e2[k];
+      yi.noalias() += FBlocks_[k].transpose() * (alpha * e[k] - Eblock(k) * d2);
     }
   }
 
@@ -436,18 +395,12 @@ public:
    * Calculate gradient, which is -F'Q*b, see paper
    */
   VectorValues gradientAtZero() const override {
-    // calculate Q*b
-    e1.resize(size());
-    e2.resize(size());
-    for (size_t k = 0; k < size(); k++)
-      e1[k] = b_.segment<ZDim>(ZDim * k);
-    projectError(e1, e2);
-
-    // g = F.transpose()*e2
+    // g = -F.transpose()*Q*b
+    const Vector3 d = projectedPoint();
     VectorValues g;
     for (size_t k = 0; k < size(); ++k) {
       Key key = keys_[k];
-      g.insert(key, -FBlocks_[k].transpose() * e2[k]);
+      g.insert(key, -FBlocks_[k].transpose() * (bk(k) - Eblock(k) * d));
     }
 
     // return it
@@ -458,28 +411,62 @@ public:
    * Calculate gradient, which is -F'Q*b, see paper - RAW MEMORY ACCESS
    */
   void gradientAtZero(double* d) const override {
+    const Vector3 p = projectedPoint();
+    for (size_t k = 0; k < size(); ++k) // for each camera in the factor
+      DMap(d + D * keys_[k]) -=
+          FBlocks_[k].transpose() * (bk(k) - Eblock(k) * p);
+  }
+  /// Gradient wrt a key at any values
+  Vector gradient(Key key, const VectorValues& x) const override {
+    throw std::runtime_error(
+        "gradient for RegularImplicitSchurFactor is not implemented yet");
+  }
 
-    // Use eigen magic to access raw memory
-    typedef Eigen::Matrix<double, D, 1> DVector;
-    typedef Eigen::Map<DVector> DMap;
+private:
 
-    // calculate Q*b
-    e1.resize(size());
-    e2.resize(size());
+  /// The ZDim*3 block of E for the camera at position pos
+  Eigen::Block<const Matrix, ZDim, 3> Eblock(size_t pos) const {
+    return E_.block<ZDim, 3>(ZDim * pos, 0);
+  }
+
+  /// The ZDim-dimensional part of b for the camera at position pos
+  Eigen::VectorBlock<const Vector, ZDim> bk(size_t pos) const {
+    return b_.segment<ZDim>(ZDim * pos);
+  }
+
+  /// The point covariance as a fixed-size matrix, so products do not allocate
+  Eigen::Map<const Matrix3> pointCovariance() const {
+    assert(PointCovariance_.rows() == 3 && PointCovariance_.cols() == 3);
+    return Eigen::Map<const Matrix3>(PointCovariance_.data());
+  }
+
+  /// P * E' * b, the point correction for the right-hand side
+  Vector3 projectedPoint() const {
+    Vector3 d = Vector3::Zero();
     for (size_t k = 0; k < size(); k++)
-      e1[k] = b_.segment<ZDim>(ZDim * k);
-    projectError(e1, e2);
+      d += Eblock(k).transpose() * bk(k);
+    return pointCovariance() * d;
+  }
 
-    for (size_t k = 0; k < size(); ++k) { // for each camera in the factor
-      Key j = keys_[k];
-      DMap(d + D * j) += -FBlocks_[k].transpose() * e2[k];
-    }
+  /// diag(F' * (I - E * P * E') * F) for the camera at position pos
+  VectorD hessianDiagonalBlock(size_t pos) const {
+    // Calculate Fj'*Ej for the current camera (observing a single point)
+    // D x 3 = (D x ZDim) * (ZDim x 3)
+    const MatrixZD& Fj = FBlocks_[pos];
+    const Eigen::Matrix<double, D, 3> FtE = Fj.transpose() * Eblock(pos);
+    return Fj.colwise().squaredNorm().transpose()
+        - (FtE * pointCovariance()).cwiseProduct(FtE).rowwise().sum();
   }
 
-  /// Gradient wrt a key at any values
-  Vector gradient(Key key, const VectorValues& x) const override {
-    throw std::runtime_error(
-        "gradient for RegularImplicitSchurFactor is not implemented yet");
+  /**
+   * Scratch space for one error per camera. It is per thread, so that
+   * different factors can be multiplied concurrently, and does not allocate
+   * once it has grown to the largest factor.
+   */
+  static Error2s& Scratch(size_t n) {
+    static thread_local Error2s scratch;
+    scratch.resize(n);
+    return scratch;
   }
 
 };
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    SmartFactorCache.h
+ * @brief   Graph-level cache of smart factor linearizations
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/slam/SmartFactorBase.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Linearizes graphs with many smart factors on cameras of type CAMERA, and
+ * remembers the linear factor of every smart factor together with its keys and
+ * the camera values it was computed at. On the next call, smart factors with
+ * the same keys, none of whose cameras moved by more than `tol` from those
+ * values, reuse their cached linear factor, i.e.,
+ * their Schur complement, without re-triangulating; only the others are
+ * re-triangulated and linearized, in parallel when GTSAM is built with TBB.
+ * All other factors are linearized as in NonlinearFactorGraph::linearize.
+ *
+ * Cached factors are matched by factor pointer, so the graph may change
+ * between calls, e.g., in fixed-lag smoothing, and factors that are no longer
+ * in the graph are dropped from the cache. Reused linear factors are shared
+ * between the graphs returned by successive calls. To use the cache in
+ * LevenbergMarquardtOptimizer, override its linearize() to call this.
+ */
+template <class CAMERA>
+class SmartFactorCache {
+ public:
+  typedef SmartFactorBase<CAMERA> SmartFactor;
+
+  /// @param tol camera values that moved less than this count as unchanged
+  explicit SmartFactorCache(double tol = 1e-9) : tol_(tol) {}
+
+  /// Linearize the graph, reusing the cache where possible
+  GaussianFactorGraph::shared_ptr linearize(const NonlinearFactorGraph& graph,
+                                            const Values& values) {
+    gttic(SmartFactorCache_linearize);
+
+    // Reuse clean smart factors, collect the others
+    auto linearFG = boost::make_shared<GaussianFactorGraph>();
+    linearFG->resize(graph.size());
+    Cache cache;
+    std::vector<size_t> todo, duplicates;
+    reused_ = 0;
+    for (size_t i = 0; i < graph.size(); i++) {
+      const NonlinearFactor::shared_ptr& factor = graph[i];
+      if (!factor) continue;
+      if (!dynamic_cast<const SmartFactor*>(factor.get())) {
+        todo.push_back(i);
+        continue;
+      }
+      if (cache.count(factor.get())) {  // same factor twice in the graph
+        duplicates.push_back(i);
+        continue;
+      }
+      auto cached = cache_.find(factor.get());
+      if (cached != cache_.end() && isClean(cached->second, values)) {
+        (*linearFG)[i] = cached->second.linear;
+        cache[factor.get()] = std::move(cached->second);
+        reused_++;
+      } else {
+        cache[factor.get()].factor = factor;
+        todo.push_back(i);
+      }
+    }
+    relinearized_ = cache.size() - reused_;
+
+    // Linearize, and re-triangulate, the rest
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, todo.size()),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        for (size_t k = r.begin(); k != r.end(); ++k)
+                          (*linearFG)[todo[k]] =
+                              graph[todo[k]]->linearize(values);
+                      });
+#else
+    for (size_t i : todo) (*linearFG)[i] = graph[i]->linearize(values);
+#endif
+    // and remember the camera values they were linearized at
+    for (size_t i : todo) {
+      auto it = cache.find(graph[i].get());
+      if (it == cache.end()) continue;
+      it->second.linear = (*linearFG)[i];
+      it->second.keys = graph[i]->keys();
+      it->second.linearizationPoint.clear();
+      it->second.linearizationPoint.reserve(graph[i]->size());
+      for (Key key : *graph[i])
+        it->second.linearizationPoint.push_back(values.at(key).clone());
+    }
+    for (size_t i : duplicates) (*linearFG)[i] = cache[graph[i].get()].linear;
+
+    cache_.swap(cache);
+    return linearFG;
+  }
+
+  /// Forget all cached linearizations
+  void clear() { cache_.clear(); }
+
+  /// Number of cached smart factors
+  size_t size() const { return cache_.size(); }
+
+  /// Number of smart factors reused in the last call to linearize
+  size_t reused() const { return reused_; }
+
+  /// Number of smart factors linearized in the last call to linearize
+  size_t relinearized() const { return relinearized_; }
+
+ private:
+  /// The factor is kept alive so that its address is not reused
+  struct Entry {
+    NonlinearFactor::shared_ptr factor;
+    GaussianFactor::shared_ptr linear;
+    KeyVector keys;  ///< keys of the factor when linearized
+    /// values at keys linear was computed at, in the same order
+    std::vector<boost::shared_ptr<Value> > linearizationPoint;
+  };
+  typedef std::unordered_map<const NonlinearFactor*, Entry> Cache;
+
+  /// Whether the factor has no new measurements and no camera moved by more
+  /// than tol_ since entry was linearized, so that small steps cannot add up
+  /// to a large one unnoticed
+  bool isClean(const Entry& entry, const Values& values) const {
+    if (entry.factor->keys() != entry.keys) return false;
+    for (size_t k = 0; k < entry.keys.size(); k++) {
+      auto it = values.find(entry.keys[k]);
+      const Value& value = *entry.linearizationPoint[k];
+      if (it == values.end() || typeid(it->value) != typeid(value) ||
+          !it->value.equals_(value, tol_))
+        return false;
+    }
+    return true;
+  }
+
+  double tol_;
+  Cache cache_;  ///< linear factor of each smart factor in the last graph
+  size_t reused_ = 0, relinearized_ = 0;
+};
+
+}  // namespace gtsam
@@ -36,6 +36,7 @@
 
 #include <gtsam/base/GenericValue.h>
 #include <gtsam/base/Lie.h>
+#include <gtsam/base/MappedFile.h>
 #include <gtsam/base/Matrix.h>
 #include <gtsam/base/Value.h>
 #include <gtsam/base/Vector.h>
@@ -46,9 +47,20 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/optional.hpp>
 
+#include <gtsam/config.h> // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
 using namespace std;
@@ -439,126 +451,374 @@ parseFactors<Pose2>(const std::string &filename,
 }
 
 /* ************************************************************************* */
-using BearingRange2D = BearingRange<Pose2, Point2>;
+// Fast path for load2D and load3D. The file is memory-mapped and split into
+// chunks at line boundaries, which are tokenized independently (in parallel
+// when TBB is available) into numeric records. The records are then turned
+// into values and factors in file order, so the result is the same as when
+// parsing line by line with the istream parsers above.
+namespace {
+
+// Line types understood by the tokenizer
+enum class G2oTag : uint8_t {
+  VERTEX_SE2,       // id x y yaw
+  VERTEX_XY,        // id x y
+  EDGE_SE2,         // id1 id2 x y yaw, then 6 noise parameters
+  BR,               // id1 id2 bearing range bearing_std range_std
+  LANDMARK,         // id1 id2 x y v1 v2 v3
+  VERTEX3,          // id x y z roll pitch yaw
+  VERTEX_SE3_QUAT,  // id x y z qx qy qz qw
+  VERTEX_TRACKXYZ,  // id x y z
+  EDGE3,            // id1 id2 x y z roll pitch yaw, optionally 21 information
+  EDGE_SE3_QUAT     // id1 id2 x y z qx qy qz qw, then 21 information
+};
 
-template <> struct ParseMeasurement<BearingRange2D> {
-  // arguments
-  size_t maxIndex;
+struct G2oTagInfo {
+  const char *name;
+  G2oTag tag;
+  size_t nrIds, nrNumbers, nrRequired;
+};
 
-  // The actual parser
-  boost::optional<BinaryMeasurement<BearingRange2D>>
-  operator()(istream &is, const string &tag) {
-    if (tag != "BR" && tag != "LANDMARK")
-      return boost::none;
+const G2oTagInfo kG2oTags[] = {
+    {"VERTEX2", G2oTag::VERTEX_SE2, 1, 3, 3},
+    {"VERTEX_SE2", G2oTag::VERTEX_SE2, 1, 3, 3},
+    {"VERTEX", G2oTag::VERTEX_SE2, 1, 3, 3},
+    {"VERTEX_XY", G2oTag::VERTEX_XY, 1, 2, 2},
+    {"EDGE2", G2oTag::EDGE_SE2, 2, 9, 9},
+    {"EDGE", G2oTag::EDGE_SE2, 2, 9, 9},
+    {"EDGE_SE2", G2oTag::EDGE_SE2, 2, 9, 9},
+    {"ODOMETRY", G2oTag::EDGE_SE2, 2, 9, 9},
+    {"BR", G2oTag::BR, 2, 4, 4},
+    {"LANDMARK", G2oTag::LANDMARK, 2, 5, 5},
+    {"VERTEX3", G2oTag::VERTEX3, 1, 6, 6},
+    {"VERTEX_SE3:QUAT", G2oTag::VERTEX_SE3_QUAT, 1, 7, 7},
+    {"VERTEX_TRACKXYZ", G2oTag::VERTEX_TRACKXYZ, 1, 3, 3},
+    {"EDGE3", G2oTag::EDGE3, 2, 27, 6},
+    {"EDGE_SE3:QUAT", G2oTag::EDGE_SE3_QUAT, 2, 28, 28}};
+
+// One parsed line. Its `size` numbers are in G2oChunk::numbers, from
+// `offset` on.
+struct G2oRecord {
+  G2oTag tag;
+  size_t id1, id2;
+  size_t offset, size;
+};
 
-    size_t id1, id2;
-    is >> id1 >> id2;
-    double bearing, range, bearing_std, range_std;
+// The records of a range of lines, and the noise models created for them
+struct G2oChunk {
+  const char *begin, *end;
+  vector<G2oRecord> records;
+  vector<double> numbers;
+  vector<SharedNoiseModel> models;  // filled in by the caller, per record
 
-    if (tag == "BR") {
-      is >> bearing >> range >> bearing_std >> range_std;
+  const double *numbersOf(const G2oRecord &record) const {
+    return numbers.data() + record.offset;
+  }
+};
+
+// Chunks are large enough that scheduling them costs next to nothing
+const size_t kG2oChunkBytes = 1 << 20;
+
+// Powers of ten that are exact in double precision
+const double kExactPowersOf10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline const char *skipBlanks(const char *p, const char *end) {
+  while (p < end && isBlank(*p))
+    ++p;
+  return p;
+}
+
+// Parse an unsigned integer, which has to be followed by a blank.
+bool parseIndex(const char *&p, const char *end, size_t &index) {
+  p = skipBlanks(p, end);
+  const char *start = p;
+  index = 0;
+  for (; p < end && isDigit(*p); ++p)
+    index = 10 * index + (*p - '0');
+  return p != start && (p == end || isBlank(*p));
+}
+
+// Parse a floating point number, which has to be followed by a blank. Numbers
+// with at most 19 significant digits and a decimal exponent of at most 22 in
+// magnitude are converted with a single, correctly rounded multiplication or
+// division by an exact power of ten. Everything else, including "inf" and
+// "nan", is handed to strtod. Either way the result equals that of strtod.
+bool parseDouble(const char *&p, const char *end, double &x) {
+  p = skipBlanks(p, end);
+  const char *start = p;
+  const bool negative = p < end && *p == '-';
+  if (p < end && (*p == '-' || *p == '+'))
+    ++p;
+
+  uint64_t mantissa = 0;
+  int nrSignificant = 0, exponent = 0;
+  bool anyDigits = false, exact = true;
+  auto addDigit = [&](char c) {
+    anyDigits = true;
+    if (mantissa == 0 && c == '0')
+      return; // leading zeros are not significant
+    if (nrSignificant == 19) {
+      exact = false;
+      return;
     }
+    mantissa = 10 * mantissa + (c - '0');
+    ++nrSignificant;
+  };
+  for (; p < end && isDigit(*p); ++p)
+    addDigit(*p);
+  if (p < end && *p == '.') {
+    for (++p; p < end && isDigit(*p); ++p, --exponent)
+      addDigit(*p);
+  }
+  if (anyDigits && p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    const bool negativeExponent = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+'))
+      ++p;
+    int e = 0;
+    const char *digits = p;
+    for (; p < end && isDigit(*p); ++p)
+      e = std::min(10 * e + (*p - '0'), 100000);
+    if (p == digits)
+      exact = false;
+    exponent += negativeExponent ? -e : e;
+  }
+
+  if (anyDigits && exact && (p == end || isBlank(*p)) &&
+      mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+    const double m = static_cast<double>(mantissa);
+    x = exponent < 0 ? m / kExactPowersOf10[-exponent]
+                     : m * kExactPowersOf10[exponent];
+    if (negative)
+      x = -x;
+    return true;
+  }
+
+  // Slow path: strtod needs a null-terminated copy of the token
+  while (p < end && !isBlank(*p) && *p != '\n')
+    ++p;
+  char token[64];
+  const size_t length = p - start;
+  if (length == 0 || length >= sizeof(token))
+    return false;
+  std::copy(start, p, token);
+  token[length] = '\0';
+  char *tokenEnd;
+  x = strtod(token, &tokenEnd);
+  return tokenEnd == token + length;
+}
 
-    // A landmark measurement, converted to bearing-range
-    if (tag == "LANDMARK") {
-      double lmx, lmy;
-      double v1, v2, v3;
-
-      is >> lmx >> lmy >> v1 >> v2 >> v3;
-
-      // Convert x,y to bearing,range
-      bearing = atan2(lmy, lmx);
-      range = sqrt(lmx * lmx + lmy * lmy);
-
-      // In our experience, the x-y covariance on landmark sightings is not
-      // very good, so assume it describes the uncertainty at a range of 10m,
-      // and convert that to bearing/range uncertainty.
-      if (std::abs(v1 - v3) < 1e-4) {
-        bearing_std = sqrt(v1 / 10.0);
-        range_std = sqrt(v1);
-      } else {
-        // TODO(frank): we are ignoring the non-uniform covariance
-        bearing_std = 1;
-        range_std = 1;
+// Tokenize all lines in [chunk.begin, chunk.end), skipping unknown tags.
+void tokenize(G2oChunk &chunk) {
+  const char *p = chunk.begin, *end = chunk.end;
+  while (p < end) {
+    const char *line = p;
+    const char *eol = static_cast<const char *>(memchr(p, '\n', end - p));
+    if (!eol)
+      eol = end;
+
+    p = skipBlanks(p, eol);
+    const char *tag = p;
+    while (p < eol && !isBlank(*p))
+      ++p;
+    const size_t length = p - tag;
+    const G2oTagInfo *info = nullptr;
+    for (const G2oTagInfo &candidate : kG2oTags)
+      if (strlen(candidate.name) == length &&
+          memcmp(candidate.name, tag, length) == 0)
+        info = &candidate;
+
+    if (info) {
+      G2oRecord record{info->tag, 0, 0, chunk.numbers.size(), 0};
+      bool ok = parseIndex(p, eol, record.id1);
+      if (ok && info->nrIds == 2)
+        ok = parseIndex(p, eol, record.id2);
+      double x;
+      for (; ok && record.size < info->nrNumbers; record.size++) {
+        if (record.size >= info->nrRequired && skipBlanks(p, eol) == eol)
+          break;
+        ok = parseDouble(p, eol, x);
+        chunk.numbers.push_back(x);
       }
+      // Optional numbers, like the information matrix of EDGE3, come all or
+      // none
+      if (record.size != info->nrRequired && record.size != info->nrNumbers)
+        ok = false;
+      if (!ok)
+        throw std::runtime_error("g2o parser encountered malformed line: " +
+                                 string(line, eol));
+      chunk.records.push_back(record);
     }
+    p = eol + 1;
+  }
+}
 
-    // optional filter
-    if (maxIndex && id1 > maxIndex)
-      return boost::none;
+// Call f(chunk) for every chunk, in parallel when TBB is available
+template <typename F> void forEachChunk(vector<G2oChunk> &chunks, const F &f) {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(size_t(0), chunks.size(),
+                    [&](size_t k) { f(chunks[k]); });
+#else
+  for (G2oChunk &chunk : chunks)
+    f(chunk);
+#endif
+}
 
-    // Create noise model
-    auto measurementNoise = noiseModel::Diagonal::Sigmas(
-        (Vector(2) << bearing_std, range_std).finished());
+// Map a file and tokenize it. The mapping is released before returning, as
+// the records hold copies of all numbers.
+vector<G2oChunk> tokenizeG2o(const string &filename) {
+  std::unique_ptr<MappedFile> file;
+  try {
+    file.reset(new MappedFile(filename));
+  } catch (const std::runtime_error &) {
+    throw invalid_argument("parse: can not find file " + filename);
+  }
 
-    return BinaryMeasurement<BearingRange2D>(
-        id1, L(id2), BearingRange2D(bearing, range), measurementNoise);
+  // Split at the first line break after every kG2oChunkBytes bytes
+  vector<G2oChunk> chunks(std::max<size_t>(1, file->size() / kG2oChunkBytes));
+  const char *begin = file->data();
+  for (size_t k = 0; k < chunks.size(); k++) {
+    const char *end = file->end();
+    if (k + 1 < chunks.size()) {
+      end = std::max(begin, file->data() + (k + 1) * file->size() /
+                                               chunks.size());
+      end = static_cast<const char *>(memchr(end, '\n', file->end() - end));
+      end = end ? end + 1 : file->end();
+    }
+    chunks[k].begin = begin;
+    chunks[k].end = end;
+    begin = end;
   }
-};
+
+  forEachChunk(chunks, tokenize);
+  return chunks;
+}
+
+// Convert a BR or LANDMARK record to a bearing-range measurement
+BearingRange<Pose2, Point2> bearingRange(const G2oRecord &record,
+                                         const double *v, double *sigmas) {
+  if (record.tag == G2oTag::BR) {
+    sigmas[0] = v[2];
+    sigmas[1] = v[3];
+    return BearingRange<Pose2, Point2>(v[0], v[1]);
+  }
+
+  // A landmark measurement, converted to bearing-range
+  const double lmx = v[0], lmy = v[1], v1 = v[2], v3 = v[4];
+  const double bearing = atan2(lmy, lmx);
+  const double range = sqrt(lmx * lmx + lmy * lmy);
+
+  // In our experience, the x-y covariance on landmark sightings is not
+  // very good, so assume it describes the uncertainty at a range of 10m,
+  // and convert that to bearing/range uncertainty.
+  if (std::abs(v1 - v3) < 1e-4) {
+    sigmas[0] = sqrt(v1 / 10.0);
+    sigmas[1] = sqrt(v1);
+  } else {
+    // TODO(frank): we are ignoring the non-uniform covariance
+    sigmas[0] = 1;
+    sigmas[1] = 1;
+  }
+  return BearingRange<Pose2, Point2>(bearing, range);
+}
+
+}  // namespace
 
 /* ************************************************************************* */
 GraphAndValues load2D(const string &filename, SharedNoiseModel model,
                       size_t maxIndex, bool addNoise, bool smart,
                       NoiseFormat noiseFormat,
                       KernelFunctionType kernelFunctionType) {
+  vector<G2oChunk> chunks = tokenizeG2o(filename);
+  auto outOfRange = [maxIndex](size_t id) {
+    return maxIndex && id > maxIndex;
+  };
+
+  // Noise models only depend on their own line, so are created in parallel.
+  // A model read from file is created even when `model` overrides it, as
+  // reading it validates the noise format.
+  forEachChunk(chunks, [&](G2oChunk &chunk) {
+    chunk.models.resize(chunk.records.size());
+    for (size_t i = 0; i < chunk.records.size(); i++) {
+      const G2oRecord &record = chunk.records[i];
+      if (record.tag != G2oTag::EDGE_SE2 || outOfRange(record.id1) ||
+          outOfRange(record.id2))
+        continue;
+      const Vector6 v(Eigen::Map<const Vector6>(chunk.numbersOf(record) + 3));
+      chunk.models[i] =
+          createNoiseModel(v, smart, noiseFormat, kernelFunctionType);
+    }
+  });
 
   // Single pass for poses and landmarks.
   auto initial = boost::make_shared<Values>();
-  Parser<int> insert = [maxIndex, &initial](istream &is, const string &tag) {
-    if (auto indexedPose = parseVertexPose(is, tag)) {
-      if (!maxIndex || indexedPose->first <= maxIndex)
-        initial->insert(indexedPose->first, indexedPose->second);
-    } else if (auto indexedLandmark = parseVertexLandmark(is, tag)) {
-      if (!maxIndex || indexedLandmark->first <= maxIndex)
-        initial->insert(L(indexedLandmark->first), indexedLandmark->second);
+  for (const G2oChunk &chunk : chunks) {
+    for (const G2oRecord &record : chunk.records) {
+      if (outOfRange(record.id1))
+        continue;
+      const double *v = chunk.numbersOf(record);
+      if (record.tag == G2oTag::VERTEX_SE2)
+        initial->insert(record.id1, Pose2(v[0], v[1], v[2]));
+      else if (record.tag == G2oTag::VERTEX_XY)
+        initial->insert(L(record.id1), Point2(v[0], v[1]));
     }
-    return 0;
-  };
-  parseLines(filename, insert);
+  }
 
-  // Single pass for Pose2 and bearing-range factors.
+  // Single pass for Pose2 and bearing-range factors, which also inserts new
+  // variables into `initial` when needed.
   auto graph = boost::make_shared<NonlinearFactorGraph>();
-
-  // Instantiate factor parser
-  ParseFactor<Pose2> parseBetweenFactor(
-      {addNoise ? createSampler(model) : nullptr, maxIndex, smart, noiseFormat,
-       kernelFunctionType, model});
-
-  // Instantiate bearing-range parser
-  ParseMeasurement<BearingRange2D> parseBearingRange{maxIndex};
-
-  // Combine in a single parser that adds factors to `graph`, but also inserts
-  // new variables into `initial` when needed.
-  Parser<int> parse = [&](istream &is, const string &tag) {
-    if (auto f = parseBetweenFactor(is, tag)) {
-      graph->push_back(*f);
-
-      // Insert vertices if pure odometry file
-      Key key1 = (*f)->key1(), key2 = (*f)->key2();
-      if (!initial->exists(key1))
-        initial->insert(key1, Pose2());
-      if (!initial->exists(key2))
-        initial->insert(key2, initial->at<Pose2>(key1) * (*f)->measured());
-    } else if (auto m = parseBearingRange(is, tag)) {
-      Key key1 = m->key1(), key2 = m->key2();
-      BearingRange2D br = m->measured();
-      graph->emplace_shared<BearingRangeFactor<Pose2, Point2>>(key1, key2, br,
-                                                               m->noiseModel());
-
-      // Insert poses or points if they do not exist yet
-      if (!initial->exists(key1))
-        initial->insert(key1, Pose2());
-      if (!initial->exists(key2)) {
-        Pose2 pose = initial->at<Pose2>(key1);
-        Point2 local = br.bearing() * Point2(br.range(), 0);
-        Point2 global = pose.transformFrom(local);
-        initial->insert(key2, global);
+  boost::shared_ptr<Sampler> sampler = addNoise ? createSampler(model) : nullptr;
+  for (G2oChunk &chunk : chunks) {
+    for (size_t i = 0; i < chunk.records.size(); i++) {
+      const G2oRecord &record = chunk.records[i];
+      const double *v = chunk.numbersOf(record);
+      const Key key1 = record.id1;
+      if (record.tag == G2oTag::EDGE_SE2) {
+        if (outOfRange(record.id1) || outOfRange(record.id2))
+          continue;
+        const Key key2 = record.id2;
+
+        // Get pose and optionally add noise
+        Pose2 pose(v[0], v[1], v[2]);
+        if (sampler)
+          pose = pose.retract(sampler->sample());
+        graph->emplace_shared<BetweenFactor<Pose2>>(
+            key1, key2, pose, model ? model : chunk.models[i]);
+
+        // Insert vertices if pure odometry file
+        if (!initial->exists(key1))
+          initial->insert(key1, Pose2());
+        if (!initial->exists(key2))
+          initial->insert(key2, initial->at<Pose2>(key1) * pose);
+      } else if (record.tag == G2oTag::BR || record.tag == G2oTag::LANDMARK) {
+        if (outOfRange(record.id1))
+          continue;
+        const Key key2 = L(record.id2);
+        double sigmas[2];
+        const BearingRange<Pose2, Point2> br = bearingRange(record, v, sigmas);
+        graph->emplace_shared<BearingRangeFactor<Pose2, Point2>>(
+            key1, key2, br, noiseModel::Diagonal::Sigmas(Vector2(sigmas)));
+
+        // Insert poses or points if they do not exist yet
+        if (!initial->exists(key1))
+          initial->insert(key1, Pose2());
+        if (!initial->exists(key2)) {
+          Pose2 pose = initial->at<Pose2>(key1);
+          Point2 local = br.bearing() * Point2(br.range(), 0);
+          Point2 global = pose.transformFrom(local);
+          initial->insert(key2, global);
+        }
       }
     }
-    return 0;
-  };
-
-  parseLines(filename, parse);
+    chunk = G2oChunk(); // release memory as we go
+  }
 
   return make_pair(graph, initial);
 }
@@ -626,13 +886,73 @@ GraphAndValues readG2o(const string &g2oFile, const bool is3D,
   }
 }
 
+/* ************************************************************************* */
+// Buffered output for writeG2o. Numbers are formatted as by an ostream with
+// default precision, straight into a large buffer that is written out when
+// full, instead of going through the stream one token at a time.
+namespace {
+class G2oWriter {
+ public:
+  explicit G2oWriter(const string &filename)
+      : stream_(filename.c_str(), ios::out | ios::binary),
+        buffer_(kBufferBytes), size_(0) {}
+  ~G2oWriter() { flush(); }
+
+  G2oWriter &operator<<(const char *s) {
+    while (*s) {
+      reserve(1);
+      buffer_[size_++] = *s++;
+    }
+    return *this;
+  }
+  G2oWriter &operator<<(char c) {
+    reserve(1);
+    buffer_[size_++] = c;
+    return *this;
+  }
+  G2oWriter &operator<<(double x) {
+    reserve(kMaxNumberBytes);
+    size_ += snprintf(&buffer_[size_], kMaxNumberBytes, "%g", x);
+    return *this;
+  }
+  G2oWriter &operator<<(uint64_t i) {
+    char digits[20];
+    size_t n = 0;
+    do {
+      digits[n++] = '0' + i % 10;
+      i /= 10;
+    } while (i);
+    reserve(n);
+    while (n)
+      buffer_[size_++] = digits[--n];
+    return *this;
+  }
+
+ private:
+  static const size_t kBufferBytes = 1 << 20, kMaxNumberBytes = 32;
+
+  void reserve(size_t n) {
+    if (size_ + n > buffer_.size())
+      flush();
+  }
+  void flush() {
+    stream_.write(buffer_.data(), size_);
+    size_ = 0;
+  }
+
+  ofstream stream_;
+  vector<char> buffer_;
+  size_t size_;
+};
+}  // namespace
+
 /* ************************************************************************* */
 void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
               const string &filename) {
-  fstream stream(filename.c_str(), fstream::out);
+  G2oWriter stream(filename);
 
   // Use a lambda here to more easily modify behavior in future.
-  auto index = [](gtsam::Key key) { return Symbol(key).index(); };
+  auto index = [](gtsam::Key key) { return uint64_t(Symbol(key).index()); };
 
   // save 2D poses
   for (const auto key_value : estimate) {
@@ -641,7 +961,7 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
       continue;
     const Pose2 &pose = p->value();
     stream << "VERTEX_SE2 " << index(key_value.key) << " " << pose.x() << " "
-           << pose.y() << " " << pose.theta() << endl;
+           << pose.y() << " " << pose.theta() << '\n';
   }
 
   // save 3D poses
@@ -654,7 +974,7 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
     const auto q = pose.rotation().toQuaternion();
     stream << "VERTEX_SE3:QUAT " << index(key_value.key) << " " << t.x() << " "
            << t.y() << " " << t.z() << " " << q.x() << " " << q.y() << " "
-           << q.z() << " " << q.w() << endl;
+           << q.z() << " " << q.w() << '\n';
   }
 
   // save 2D landmarks
@@ -664,7 +984,7 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
       continue;
     const Point2 &point = p->value();
     stream << "VERTEX_XY " << index(key_value.key) << " " << point.x() << " "
-           << point.y() << endl;
+           << point.y() << '\n';
   }
 
   // save 3D landmarks
@@ -674,7 +994,7 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
       continue;
     const Point3 &point = p->value();
     stream << "VERTEX_TRACKXYZ " << index(key_value.key) << " " << point.x()
-           << " " << point.y() << " " << point.z() << endl;
+           << " " << point.y() << " " << point.z() << '\n';
   }
 
   // save edges (2D or 3D)
@@ -698,7 +1018,7 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
           stream << " " << Info(i, j);
         }
       }
-      stream << endl;
+      stream << '\n';
     }
 
     auto factor3D = boost::dynamic_pointer_cast<BetweenFactor<Pose3>>(factor_);
@@ -732,19 +1052,23 @@ void writeG2o(const NonlinearFactorGraph &graph, const Values &estimate,
           stream << " " << InfoG2o(i, j);
         }
       }
-      stream << endl;
+      stream << '\n';
     }
   }
-  stream.close();
 }
 
 /* ************************************************************************* */
 // parse quaternion in x,y,z,w order, and normalize to unit length
+static Quaternion normalizedQuaternion(double x, double y, double z,
+                                       double w) {
+  const double norm = sqrt(w * w + x * x + y * y + z * z), f = 1.0 / norm;
+  return Quaternion(f * w, f * x, f * y, f * z);
+}
+
 istream &operator>>(istream &is, Quaternion &q) {
   double x, y, z, w;
   is >> x >> y >> z >> w;
-  const double norm = sqrt(w * w + x * x + y * y + z * z), f = 1.0 / norm;
-  q = Quaternion(f * w, f * x, f * y, f * z);
+  q = normalizedQuaternion(x, y, z, w);
   return is;
 }
 
@@ -811,6 +1135,28 @@ istream &operator>>(istream &is, Matrix6 &m) {
   return is;
 }
 
+// Same, from an array of 21 numbers
+static Matrix6 symmetricFromUpper(const double *v) {
+  Matrix6 m;
+  for (size_t i = 0; i < 6; i++)
+    for (size_t j = i; j < 6; j++) {
+      m(i, j) = *v++;
+      m(j, i) = m(i, j);
+    }
+  return m;
+}
+
+/* ************************************************************************* */
+// EDGE_SE3:QUAT stores the information matrix in t,R order, unlike GTSAM
+static Matrix6 informationFromG2o(const Matrix6 &m) {
+  Matrix6 mgtsam;
+  mgtsam.block<3, 3>(0, 0) = m.block<3, 3>(3, 3); // cov rotation
+  mgtsam.block<3, 3>(3, 3) = m.block<3, 3>(0, 0); // cov translation
+  mgtsam.block<3, 3>(0, 3) = m.block<3, 3>(0, 3); // off diagonal
+  mgtsam.block<3, 3>(3, 0) = m.block<3, 3>(3, 0); // off diagonal
+  return mgtsam;
+}
+
 /* ************************************************************************* */
 // Pose3 measurement parser
 template <> struct ParseMeasurement<Pose3> {
@@ -852,16 +1198,9 @@ template <> struct ParseMeasurement<Pose3> {
       if (sampler)
         T12 = T12.retract(sampler->sample());
 
-      // EDGE_SE3:QUAT stores covariance in t,R order, unlike GTSAM:
-      Matrix6 mgtsam;
-      mgtsam.block<3, 3>(0, 0) = m.block<3, 3>(3, 3); // cov rotation
-      mgtsam.block<3, 3>(3, 3) = m.block<3, 3>(0, 0); // cov translation
-      mgtsam.block<3, 3>(0, 3) = m.block<3, 3>(0, 3); // off diagonal
-      mgtsam.block<3, 3>(3, 0) = m.block<3, 3>(3, 0); // off diagonal
-      SharedNoiseModel model = noiseModel::Gaussian::Information(mgtsam);
-
       return BinaryMeasurement<Pose3>(
-          id1, id2, T12, noiseModel::Gaussian::Information(mgtsam));
+          id1, id2, T12,
+          noiseModel::Gaussian::Information(informationFromG2o(m)));
     } else
       return boost::none;
   }
@@ -922,25 +1261,66 @@ parseFactors<Pose3>(const std::string &filename,
 
 /* ************************************************************************* */
 GraphAndValues load3D(const string &filename) {
-  auto graph = boost::make_shared<NonlinearFactorGraph>();
-  auto initial = boost::make_shared<Values>();
-
-  // Instantiate factor parser. maxIndex is always zero for load3D.
-  ParseFactor<Pose3> parseFactor({nullptr, 0});
+  vector<G2oChunk> chunks = tokenizeG2o(filename);
+
+  // Noise models only depend on their own line, so are created in parallel
+  forEachChunk(chunks, [](G2oChunk &chunk) {
+    chunk.models.resize(chunk.records.size());
+    for (size_t i = 0; i < chunk.records.size(); i++) {
+      const G2oRecord &record = chunk.records[i];
+      const double *v = chunk.numbersOf(record);
+      if (record.tag == G2oTag::EDGE3 && record.size == 6)
+        chunk.models[i] = noiseModel::Unit::Create(6);
+      else if (record.tag == G2oTag::EDGE3)
+        chunk.models[i] =
+            noiseModel::Gaussian::Information(symmetricFromUpper(v + 6));
+      else if (record.tag == G2oTag::EDGE_SE3_QUAT)
+        chunk.models[i] = noiseModel::Gaussian::Information(
+            informationFromG2o(symmetricFromUpper(v + 7)));
+    }
+  });
 
   // Single pass for variables and factors. Unlike 2D version, does *not* insert
   // variables into `initial` if referenced but not present.
-  Parser<int> parse = [&](istream &is, const string &tag) {
-    if (auto indexedPose = parseVertexPose3(is, tag)) {
-      initial->insert(indexedPose->first, indexedPose->second);
-    } else if (auto indexedLandmark = parseVertexPoint3(is, tag)) {
-      initial->insert(L(indexedLandmark->first), indexedLandmark->second);
-    } else if (auto factor = parseFactor(is, tag)) {
-      graph->push_back(*factor);
+  auto graph = boost::make_shared<NonlinearFactorGraph>();
+  auto initial = boost::make_shared<Values>();
+  for (G2oChunk &chunk : chunks) {
+    for (size_t i = 0; i < chunk.records.size(); i++) {
+      const G2oRecord &record = chunk.records[i];
+      const double *v = chunk.numbersOf(record);
+      switch (record.tag) {
+      case G2oTag::VERTEX3: // x y z roll pitch yaw
+        initial->insert(record.id1, Pose3(Rot3::Ypr(v[5], v[4], v[3]),
+                                          Point3(v[0], v[1], v[2])));
+        break;
+      case G2oTag::VERTEX_SE3_QUAT:
+        initial->insert(
+            record.id1,
+            Pose3(normalizedQuaternion(v[3], v[4], v[5], v[6]),
+                  Point3(v[0], v[1], v[2])));
+        break;
+      case G2oTag::VERTEX_TRACKXYZ:
+        initial->insert(L(record.id1), Point3(v[0], v[1], v[2]));
+        break;
+      case G2oTag::EDGE3:
+        graph->emplace_shared<BetweenFactor<Pose3>>(
+            record.id1, record.id2,
+            Pose3(Rot3::Ypr(v[5], v[4], v[3]), Point3(v[0], v[1], v[2])),
+            chunk.models[i]);
+        break;
+      case G2oTag::EDGE_SE3_QUAT:
+        graph->emplace_shared<BetweenFactor<Pose3>>(
+            record.id1, record.id2,
+            Pose3(normalizedQuaternion(v[3], v[4], v[5], v[6]),
+                  Point3(v[0], v[1], v[2])),
+            chunk.models[i]);
+        break;
+      default: // 2D lines are ignored
+        break;
+      }
     }
-    return 0;
-  };
-  parseLines(filename, parse);
+    chunk = G2oChunk(); // release memory as we go
+  }
 
   return make_pair(graph, initial);
 }
@@ -164,6 +164,11 @@ GTSAM_EXPORT GraphAndValues load2D(
  * @param noiseFormat how noise parameters are stored
  * @param kernelFunctionType whether to wrap the noise model in a robust kernel
  * @return graph and initial values
+ *
+ * The file is memory-mapped and tokenized in chunks of about 1MB, in parallel
+ * when GTSAM is built with TBB. Lines with an unknown tag are skipped, while
+ * a line with a known tag but missing or malformed numbers throws a
+ * std::runtime_error.
  */
 GTSAM_EXPORT GraphAndValues load2D(const std::string& filename,
     SharedNoiseModel model = SharedNoiseModel(), size_t maxIndex = 0, bool addNoise =
@@ -205,7 +210,10 @@ GTSAM_EXPORT GraphAndValues readG2o(const std::string& g2oFile, const bool is3D
 GTSAM_EXPORT void writeG2o(const NonlinearFactorGraph& graph,
     const Values& estimate, const std::string& filename);
 
-/// Load TORO 3D Graph
+/**
+ * Load TORO 3D Graph, parsed like in load2D. EDGE3 lines without an
+ * information matrix get a unit noise model.
+ */
 GTSAM_EXPORT GraphAndValues load3D(const std::string& filename);
 
 /// A measurement with its camera index
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testBetweenFactorBatch.cpp
+ * @brief   Unit tests for batched linearization of BetweenFactor<Pose3>
+ * @date    October 2026
+ */
+
+#include <gtsam/slam/BetweenFactorBatch.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/nonlinear/GaussNewtonOptimizer.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::X;
+
+namespace {
+// A noisy ring of poses with every kind of noise model
+void createProblem(NonlinearFactorGraph* graph, Values* values) {
+  const size_t n = 20;
+  for (size_t i = 0; i < n; i++)
+    values->insert(X(i), Pose3::Expmap((Vector6() << 0.1 * i, -0.2, 0.3 * i,
+                                        i, 2.0 - i, 0.5 * i).finished()));
+
+  Matrix6 covariance = I_6x6;
+  covariance(0, 1) = covariance(1, 0) = 0.3;
+  const SharedNoiseModel models[] = {
+      noiseModel::Isotropic::Sigma(6, 0.1),
+      noiseModel::Diagonal::Sigmas(
+          (Vector6() << 0.1, 0.2, 0.3, 1.0, 2.0, 3.0).finished()),
+      noiseModel::Unit::Create(6), noiseModel::Gaussian::Covariance(covariance),
+      noiseModel::Robust::Create(noiseModel::mEstimator::Huber::Create(1.0),
+                                 noiseModel::Isotropic::Sigma(6, 0.1)),
+      noiseModel::Constrained::All(6)};
+
+  graph->addPrior(X(0), Pose3(), noiseModel::Isotropic::Sigma(6, 0.01));
+  for (size_t i = 0; i < n; i++) {
+    const size_t j = (i + 1) % n, k = (i + 7) % n;
+    const Pose3 noise = Pose3::Expmap(0.05 * Vector6::Constant(i % 3));
+    const Pose3 zj = values->at<Pose3>(X(i)).between(values->at<Pose3>(X(j)));
+    const Pose3 zk = values->at<Pose3>(X(i)).between(values->at<Pose3>(X(k)));
+    graph->emplace_shared<BetweenFactor<Pose3>>(X(i), X(j), zj * noise,
+                                                models[i % 6]);
+    graph->emplace_shared<BetweenFactor<Pose3>>(X(i), X(k), zk.inverse(),
+                                                models[(i + 1) % 4]);
+  }
+  graph->push_back(NonlinearFactor::shared_ptr());
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, Registered) {
+#if defined(GTSAM_POSE3_EXPMAP) && !defined(SLOW_BUT_CORRECT_BETWEENFACTOR)
+  EXPECT(BatchLinearization::Find(typeid(BetweenFactor<Pose3>)));
+#endif
+  EXPECT(!BatchLinearization::Find(typeid(BetweenFactor<Point3>)));
+}
+
+// The kernel only matches BetweenFactor<Pose3> with the chart it assumes
+#if defined(GTSAM_POSE3_EXPMAP) && !defined(SLOW_BUT_CORRECT_BETWEENFACTOR)
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, Linearize) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createProblem(&graph, &values);
+
+  // Call the kernel on all between factors, in the order of the graph
+  vector<size_t> indices;
+  for (size_t i = 1; i + 1 < graph.size(); i++) indices.push_back(i);
+  GaussianFactorGraph actual(vector<GaussianFactor::shared_ptr>(graph.size()));
+  LinearizeBetweenFactorsPose3(graph, indices, values, &actual);
+
+  const GaussianFactorGraph expected = *graph.linearize(values);
+  EXPECT(!actual[0]);
+  for (size_t i : indices) {
+    const auto e = boost::dynamic_pointer_cast<JacobianFactor>(expected[i]);
+    const auto a = boost::dynamic_pointer_cast<JacobianFactor>(actual[i]);
+    CHECK(a && e);
+    EXPECT(assert_equal(*e, *a, 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, LinearizeGraph) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createProblem(&graph, &values);
+
+  const GaussianFactorGraph expected = *graph.linearize(values);
+  const GaussianFactorGraph actual = *graph.linearizeBatched(values);
+  EXPECT_LONGS_EQUAL(graph.size(), actual.size());
+  EXPECT(!actual.back());
+  EXPECT(assert_equal(expected, actual, 1e-9));
+
+  // Without kernels, the batched path linearizes factor by factor
+  BatchLinearization::Unregister<BetweenFactor<Pose3>>();
+  EXPECT(assert_equal(expected, *graph.linearizeBatched(values), 1e-9));
+  BatchLinearization::Register<BetweenFactor<Pose3>>(
+      LinearizeBetweenFactorsPose3);
+}
+#endif
+
+/* ************************************************************************* */
+TEST(BetweenFactorBatch, Optimize) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createProblem(&graph, &values);
+  graph.resize(graph.size() - 1);
+
+  // Drop the constrained factors, which Gauss-Newton cannot satisfy exactly
+  NonlinearFactorGraph unconstrained;
+  for (const auto& factor : graph) {
+    const auto nm = boost::dynamic_pointer_cast<NoiseModelFactor>(factor);
+    if (!nm->noiseModel()->isConstrained()) unconstrained.push_back(factor);
+  }
+
+  GaussNewtonParams params;
+  params.setMaxIterations(3);
+  const Values expected =
+      GaussNewtonOptimizer(unconstrained, values, params).optimize();
+  params.setBatchLinearization(true);
+  const Values actual =
+      GaussNewtonOptimizer(unconstrained, values, params).optimize();
+  EXPECT(assert_equal(expected, actual, 1e-7));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
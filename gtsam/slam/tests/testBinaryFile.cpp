@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testBinaryFile.cpp
+ * @date October 2026
+ * @brief unit tests for the memory-mapped binary file format
+ */
+
+#include <gtsam/slam/BinaryFile.h>
+
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/sam/BearingRangeFactor.h>
+#include <gtsam/sam/RangeFactor.h>
+#include <gtsam/slam/dataset.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+namespace {
+/// Name of a temporary binary file next to the given data set
+string binaryFileName(const string& dataset) {
+  string filename = createRewrittenFileName(findExampleDataFile(dataset));
+  return filename.replace(filename.size() - 4, 4, ".bin");
+}
+
+/// Overwrite the type and count of the first chunk of the given kind, and
+/// truncate the file after that chunk with the given payload size
+void patchChunk(const string& filename, uint32_t kind, uint32_t type,
+                uint64_t count, uint64_t bytes) {
+  string contents;
+  {
+    ifstream is(filename.c_str(), ios::binary);
+    contents.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+  }
+  size_t offset = 16;
+  while (*reinterpret_cast<const uint32_t*>(&contents[offset]) != kind)
+    offset += 24 + *reinterpret_cast<const uint64_t*>(&contents[offset + 16]);
+  contents.resize(offset + 24 + bytes);
+  contents.replace(offset + 4, 4, reinterpret_cast<const char*>(&type), 4);
+  contents.replace(offset + 8, 8, reinterpret_cast<const char*>(&count), 8);
+  contents.replace(offset + 16, 8, reinterpret_cast<const char*>(&bytes), 8);
+  ofstream os(filename.c_str(), ios::binary);
+  os << contents;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BinaryFile, roundTrip2D) {
+  NonlinearFactorGraph::shared_ptr expectedGraph;
+  Values::shared_ptr expectedValues;
+  boost::tie(expectedGraph, expectedValues) =
+      readG2o(findExampleDataFile("pose2example"));
+  expectedGraph->addPrior(0, Pose2(), noiseModel::Unit::Create(3));
+  expectedGraph->emplace_shared<BearingRangeFactor<Pose2, Point2> >(
+      X(1), L(1), Rot2::fromAngle(0.3), 2.0,
+      noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.2)));
+  expectedValues->insert(L(1), Point2(1, 2));
+
+  const string filename = binaryFileName("pose2example");
+  writeBinary(filename, *expectedGraph, *expectedValues);
+
+  NonlinearFactorGraph::shared_ptr actualGraph;
+  Values::shared_ptr actualValues;
+  boost::tie(actualGraph, actualValues) = readBinary(filename);
+  EXPECT(assert_equal(*expectedValues, *actualValues, 1e-12));
+  EXPECT(assert_equal(*expectedGraph, *actualGraph, 1e-12));
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, roundTrip3D) {
+  NonlinearFactorGraph::shared_ptr expectedGraph;
+  Values::shared_ptr expectedValues;
+  boost::tie(expectedGraph, expectedValues) =
+      readG2o(findExampleDataFile("pose3example"), true);
+  expectedGraph->addPrior(0, Pose3(), noiseModel::Isotropic::Sigma(6, 0.1));
+  expectedGraph->addPrior(1, Rot3(), noiseModel::Unit::Create(3));
+
+  const string filename = binaryFileName("pose3example");
+  writeBinary(filename, *expectedGraph, *expectedValues);
+
+  NonlinearFactorGraph::shared_ptr actualGraph;
+  Values::shared_ptr actualValues;
+  boost::tie(actualGraph, actualValues) = readBinary(filename);
+  EXPECT(assert_equal(*expectedValues, *actualValues, 1e-9));
+  EXPECT(assert_equal(*expectedGraph, *actualGraph, 1e-9));
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+// Values are written as they arrive and can be read in place
+TEST(BinaryFile, streamingAndInPlace) {
+  const string filename = binaryFileName("pose2example");
+  const auto model = noiseModel::Isotropic::Sigma(3, 0.5);
+  {
+    BinaryFileWriter writer(filename);
+    for (size_t i = 0; i < 5; i++) {
+      writer.add(X(i), GenericValue<Pose2>(Pose2(i, 0, 0.1 * i)));
+      if (i > 0)
+        writer.add(boost::make_shared<BetweenFactor<Pose2> >(
+            X(i - 1), X(i), Pose2(1, 0, 0.1), model));
+    }
+    writer.add(L(0), GenericValue<Point3>(Point3(1, 2, 3)));
+  }
+
+  const MappedBinaryFile file(filename);
+  EXPECT_LONGS_EQUAL(1, file.version());
+  EXPECT_LONGS_EQUAL(6, file.nrValues());
+  EXPECT_LONGS_EQUAL(4, file.nrFactors());
+
+  // Consecutive values share a block, values between factors do not
+  const auto& blocks = file.valueBlocks();
+  LONGS_EQUAL(5, blocks.size());
+  EXPECT_LONGS_EQUAL(2, blocks[0].count);
+  EXPECT(blocks[1].type == "Pose2");
+  EXPECT(blocks[1].keys[0] == X(2));
+  EXPECT(assert_equal(Pose2(1, 0, 0.1), blocks[0].at<Pose2>(1)));
+  EXPECT(assert_equal(Pose2(2, 0, 0.2), blocks[1].at<Pose2>(0)));
+  EXPECT(assert_equal(Point3(1, 2, 3), blocks[4].at<Point3>(0)));
+  CHECK_EXCEPTION(blocks[4].at<Pose2>(0), std::invalid_argument);
+  CHECK_EXCEPTION(blocks[4].at<Point3>(1), std::out_of_range);
+
+  // All factors share a single noise model
+  const NonlinearFactorGraph graph = file.graph();
+  auto first = boost::dynamic_pointer_cast<NoiseModelFactor>(graph.at(0));
+  auto last = boost::dynamic_pointer_cast<NoiseModelFactor>(graph.at(3));
+  CHECK(first && last);
+  EXPECT(first->noiseModel() == last->noiseModel());
+  EXPECT(model->equals(*first->noiseModel()));
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, unsupported) {
+  const string filename = binaryFileName("pose2example");
+  BinaryFileWriter writer(filename);
+  CHECK_EXCEPTION(
+      writer.add(boost::make_shared<RangeFactor<Pose2, Point2> >(
+          X(0), L(0), 1.0, noiseModel::Unit::Create(1))),
+      std::invalid_argument);
+  CHECK_EXCEPTION(writer.add(X(0), GenericValue<double>(1.0)),
+                  std::invalid_argument);
+  writer.close();
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, invalid) {
+  const string filename = binaryFileName("pose2example");
+  {
+    ofstream os(filename.c_str());
+    os << "VERTEX_SE2 0 0 0 0\n";
+  }
+  CHECK_EXCEPTION(MappedBinaryFile file(filename), std::runtime_error);
+  remove(filename.c_str());
+  CHECK_EXCEPTION(MappedBinaryFile file(filename), std::runtime_error);
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, schemaMismatch) {
+  const string filename = binaryFileName("pose2example");
+  {
+    BinaryFileWriter writer(filename);
+    writer.add(boost::make_shared<PriorFactor<Pose2> >(
+        X(0), Pose2(), noiseModel::Unit::Create(3)));
+  }
+  // Claim two keys and one parameter less: same record size, wrong layout
+  string contents;
+  {
+    ifstream is(filename.c_str(), ios::binary);
+    contents.assign(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+  }
+  const size_t name = contents.find("PriorFactor<Pose2>");
+  CHECK(name != string::npos);
+  const uint32_t keys = 2, size = 3;
+  contents.replace(name - 12, 4, reinterpret_cast<const char*>(&keys), 4);
+  contents.replace(name - 8, 4, reinterpret_cast<const char*>(&size), 4);
+  {
+    ofstream os(filename.c_str(), ios::binary);
+    os << contents;
+  }
+  CHECK_EXCEPTION(MappedBinaryFile file(filename), std::runtime_error);
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, corruptCounts) {
+  const string filename = binaryFileName("pose2example");
+  const uint32_t kValues = 3, kNoise = 2, kUnit = 0, kGaussian = 3;
+
+  // A values chunk whose count times record size overflows to its size
+  {
+    BinaryFileWriter writer(filename);
+    writer.add(L(0), GenericValue<Point2>(Point2(1, 2)));
+  }
+  uint64_t count = uint64_t(1) << 61;
+  patchChunk(filename, kValues, 0, count, 0);
+  CHECK_EXCEPTION(MappedBinaryFile file(filename), std::runtime_error);
+
+  // A noise model whose dimension squared overflows to its size, and a unit
+  // noise model with an absurd dimension
+  for (uint32_t kind : {kGaussian, kUnit}) {
+    {
+      BinaryFileWriter writer(filename);
+      writer.add(boost::make_shared<PriorFactor<Pose2> >(
+          X(0), Pose2(), noiseModel::Unit::Create(3)));
+    }
+    count = uint64_t(1) << 32;
+    patchChunk(filename, kNoise, kind, count, 0);
+    CHECK_EXCEPTION(MappedBinaryFile file(filename), std::runtime_error);
+  }
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+TEST(BinaryFile, noiseModelMismatch) {
+  const string filename = binaryFileName("pose2example");
+  {
+    BinaryFileWriter writer(filename);
+    writer.add(boost::make_shared<BetweenFactor<Pose2> >(
+        X(0), X(1), Pose2(), noiseModel::Unit::Create(2)));
+  }
+  const MappedBinaryFile file(filename);
+  CHECK_EXCEPTION(file.graph(), std::runtime_error);
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -26,6 +26,8 @@
 
 #include <CppUnitLite/TestHarness.h>
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -151,6 +153,89 @@ TEST(dataSet, load2DVictoriaPark) {
   EXPECT_LONGS_EQUAL(L(5), graph->at(4)->keys()[1]);
 }
 
+/* ************************************************************************* */
+// w20000 is parsed in two chunks, which must give exactly the factors that
+// parsing it line by line gives
+TEST(dataSet, load2DChunked) {
+  const string filename = findExampleDataFile("w20000.txt");
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = load2D(filename);
+  const auto expected = parseFactors<Pose2>(filename);
+  LONGS_EQUAL(expected.size(), graph->size());
+  size_t nrDifferent = 0;
+  for (size_t i = 0; i < expected.size(); i++)
+    if (!expected[i]->equals(*graph->at(i), 0.0)) nrDifferent++;
+  EXPECT_LONGS_EQUAL(0, nrDifferent);
+  EXPECT_LONGS_EQUAL(20061, initial->size());
+}
+
+/* ************************************************************************* */
+TEST(dataSet, load2DNumberFormats) {
+  const string filename =
+      createRewrittenFileName(findExampleDataFile("pose2example"));
+  {
+    ofstream os(filename.c_str());
+    os << "# comment\n\n"
+       << "VERTEX_SE2 0 1.5e3 -.25 +0.75\r\n"
+       << "  VERTEX_SE2\t1 0.1000000000000000055511151231257827 1E-30 "
+          "12345678901234567890\n"
+       << "VERTEX_XY 2 -0 3.\n"
+       << "VERTEX_XY 3 1 2";  // no line break at the end
+  }
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = load2D(filename);
+  EXPECT_LONGS_EQUAL(4, initial->size());
+  EXPECT(assert_equal(Pose2(1500, -0.25, 0.75), initial->at<Pose2>(0), 0.0));
+  EXPECT(assert_equal(Pose2(0.1, 1e-30, 12345678901234567890.0),
+                      initial->at<Pose2>(1), 0.0));
+  EXPECT(assert_equal(Point2(0, 3), initial->at<Point2>(L(2)), 0.0));
+  EXPECT(assert_equal(Point2(1, 2), initial->at<Point2>(L(3)), 0.0));
+
+  // Lines with missing or invalid numbers are rejected
+  {
+    ofstream os(filename.c_str());
+    os << "EDGE_SE2 0 1 0.5 0 0 1 0 0 1 0\n";
+  }
+  CHECK_EXCEPTION(load2D(filename), std::runtime_error);
+  {
+    ofstream os(filename.c_str());
+    os << "VERTEX_SE2 0 1.5x 0 0\n";
+  }
+  CHECK_EXCEPTION(load2D(filename), std::runtime_error);
+  remove(filename.c_str());
+}
+
+/* ************************************************************************* */
+// EDGE3 lines in sphere_smallnoise have no information matrix
+TEST(dataSet, load3DWithoutInformation) {
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) =
+      load3D(findExampleDataFile("sphere_smallnoise.graph"));
+  EXPECT_LONGS_EQUAL(2200, initial->size());
+  LONGS_EQUAL(8647, graph->size());
+  auto factor = boost::dynamic_pointer_cast<BetweenFactor<Pose3>>(graph->at(0));
+  CHECK(factor);
+  EXPECT(assert_equal(Pose3(Rot3::Ypr(0.144005, 0.0249381, -0.0319376),
+                            Point3(0.142135, 2.35517, -0.0102327)),
+                      factor->measured()));
+  EXPECT(factor->noiseModel()->isUnit());
+
+  // A truncated information matrix is rejected
+  const string filename =
+      createRewrittenFileName(findExampleDataFile("sphere_smallnoise.graph"));
+  {
+    ofstream os(filename.c_str());
+    os << "VERTEX3 0 0 0 0 0 0 0\n"
+       << "VERTEX3 1 1 0 0 0 0 0\n"
+       << "EDGE3 0 1 1 0 0 0 0 0 1 0 0 0 0 0 1 0 0 0\n";
+  }
+  CHECK_EXCEPTION(load3D(filename), std::runtime_error);
+  remove(filename.c_str());
+}
+
 /* ************************************************************************* */
 TEST( dataSet, Balbianello)
 {
@@ -25,6 +25,7 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/linear/GaussianFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/base/timing.h>
 
 #include <boost/assign/list_of.hpp>
@@ -56,6 +57,12 @@ TEST( regularImplicitSchurFactor, creation ) {
   RegularImplicitSchurFactor<CalibratedCamera> expected(keys, FBlocks, E, P, b);
   Matrix expectedP = expected.getPointCovariance();
   EXPECT(assert_equal(expectedP, P));
+
+  // Only 3D points are supported
+  typedef RegularImplicitSchurFactor<CalibratedCamera> Factor;
+  const Matrix E2 = E.leftCols<2>();
+  CHECK_EXCEPTION(Factor(keys, FBlocks, E2, (E2.transpose() * E2).inverse(), b),
+                  std::invalid_argument);
 }
 
 /* ************************************************************************* */
@@ -278,6 +285,40 @@ TEST(regularImplicitSchurFactor, hessianDiagonal)
   EXPECT(assert_equal(actualBD[3],actualInfo2.block<6,6>(12,12)));
 }
 
+/* ************************************************************************* */
+// A graph of implicit Schur factors sharing cameras, with a Jacobian prior.
+// With TBB, graphs of 1000 factors or more are multiplied in parallel chunks.
+TEST(regularImplicitSchurFactor, graphMultiplyHessianAdd) {
+  Matrix E = Matrix::Zero(6, 3);
+  E.block<2,2>(0, 0) = I_2x2;
+  E.block<2,3>(2, 0) = 2 * Matrix::Ones(2, 3);
+  E.block<2,2>(4, 1) = I_2x2;
+  Matrix3 P = (E.transpose() * E).inverse();
+
+  GaussianFactorGraph graph;
+  for (size_t j = 0; j < 1000; j++) {
+    const KeyVector keys_j {j % 5, (j + 1) % 5, (j + 3) % 5};
+    graph.push_back(boost::make_shared<
+        RegularImplicitSchurFactor<CalibratedCamera> >(
+        keys_j, FBlocks, (1.0 + j % 20) * E,
+        P / ((1.0 + j % 20) * (1.0 + j % 20)), b));
+  }
+  graph.add(2, Matrix::Identity(6, 6), Vector::Zero(6));
+
+  VectorValues x;
+  for (size_t i = 0; i < 5; i++) x.insert(i, Vector::LinSpaced(6, i, 2 * i));
+
+  // Sum of the products of the factors one by one
+  VectorValues expected;
+  for (const auto& factor : graph) factor->multiplyHessianAdd(0.5, x, expected);
+
+  VectorValues actual;
+  graph.multiplyHessianAdd(0.5, x, actual);
+  EXPECT(assert_equal(expected, actual, 1e-9));
+  graph.multiplyHessianAdd(-0.5, x, actual);
+  EXPECT(assert_equal(VectorValues::Zero(expected), actual, 1e-9));
+}
+
 /* ************************************************************************* */
 int main(void) {
   TestResult tr;
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testSmartFactorCache.cpp
+ * @brief   Unit tests for SmartFactorCache
+ * @date    October 2026
+ */
+
+#include "smartFactorScenarios.h"
+#include <gtsam/slam/SmartFactorCache.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace vanillaPose2;
+
+namespace {
+const Key x1 = 1, x2 = 2, x3 = 3;
+
+// Three landmarks seen in {x1,x2,x3}, {x1,x2} and {x2,x3}, and a prior
+NonlinearFactorGraph createGraph() {
+  const Point3 landmarks[] = {landmark1, landmark2, landmark3};
+  const KeyVector views[] = {{x1, x2, x3}, {x1, x2}, {x2, x3}};
+  const Camera cameras[] = {cam1, cam2, cam3};
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < 3; j++) {
+    auto factor = boost::make_shared<SmartFactor>(unit2, sharedK2);
+    for (Key key : views[j])
+      factor->add(cameras[key - 1].project(landmarks[j]), key);
+    graph.push_back(factor);
+  }
+  graph.addPrior(x1, level_pose, noiseModel::Isotropic::Sigma(6, 0.1));
+  return graph;
+}
+
+Values createValues(const Pose3& pose3) {
+  Values values;
+  values.insert(x1, level_pose);
+  values.insert(x2, pose_right);
+  values.insert(x3, pose3);
+  return values;
+}
+
+// Levenberg-Marquardt with cached smart factor linearizations
+class CachedOptimizer : public LevenbergMarquardtOptimizer {
+ public:
+  using LevenbergMarquardtOptimizer::LevenbergMarquardtOptimizer;
+  GaussianFactorGraph::shared_ptr linearize() const override {
+    return cache.linearize(graph(), values());
+  }
+  mutable SmartFactorCache<Camera> cache;
+};
+}  // namespace
+
+/* ************************************************************************* */
+TEST(SmartFactorCache, linearize) {
+  const NonlinearFactorGraph graph = createGraph();
+  Values values = createValues(pose_above);
+  SmartFactorCache<Camera> cache;
+
+  // First call linearizes everything
+  const GaussianFactorGraph actual1 = *cache.linearize(graph, values);
+  EXPECT(assert_equal(*graph.linearize(values), actual1, 1e-9));
+  EXPECT_LONGS_EQUAL(3, cache.size());
+  EXPECT_LONGS_EQUAL(0, cache.reused());
+  EXPECT_LONGS_EQUAL(3, cache.relinearized());
+
+  // Nothing moved: all smart factors are reused, as is
+  const GaussianFactorGraph actual2 = *cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(3, cache.reused());
+  EXPECT_LONGS_EQUAL(0, cache.relinearized());
+  for (size_t i = 0; i < 3; i++) EXPECT(actual1[i] == actual2[i]);
+  EXPECT(actual1[3] != actual2[3]);
+
+  // Moving x3 only relinearizes the factors that see it
+  const Pose3 moved = pose_above * Pose3(Rot3::Ypr(0.01, 0, 0), Point3(0.1, 0, 0));
+  values.update(x3, moved);
+  const GaussianFactorGraph actual3 = *cache.linearize(graph, values);
+  EXPECT(assert_equal(*createGraph().linearize(values), actual3, 1e-9));
+  EXPECT_LONGS_EQUAL(1, cache.reused());
+  EXPECT_LONGS_EQUAL(2, cache.relinearized());
+  EXPECT(actual1[1] == actual3[1]);
+
+  // Factors no longer in the graph are dropped
+  NonlinearFactorGraph smaller;
+  smaller.push_back(graph[1]);
+  smaller.push_back(graph[1]);
+  const GaussianFactorGraph actual4 = *cache.linearize(smaller, values);
+  EXPECT_LONGS_EQUAL(1, cache.size());
+  EXPECT_LONGS_EQUAL(1, cache.reused());
+  EXPECT(actual4[0] == actual1[1] && actual4[1] == actual1[1]);
+
+  cache.clear();
+  EXPECT_LONGS_EQUAL(0, cache.size());
+}
+
+/* ************************************************************************* */
+TEST(SmartFactorCache, addMeasurement) {
+  const NonlinearFactorGraph graph = createGraph();
+  const Values values = createValues(pose_above);
+  SmartFactorCache<Camera> cache;
+  const GaussianFactorGraph actual1 = *cache.linearize(graph, values);
+
+  // A factor that gains a measurement is relinearized, although its address
+  // and the cameras it saw before did not change
+  auto factor = boost::dynamic_pointer_cast<SmartFactor>(graph[1]);
+  CHECK(factor);
+  factor->add(cam3.project(landmark2), x3);
+  const GaussianFactorGraph actual2 = *cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(2, cache.reused());
+  EXPECT_LONGS_EQUAL(1, cache.relinearized());
+  EXPECT(actual1[1] != actual2[1]);
+  EXPECT(assert_equal(*graph.linearize(values), actual2, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(SmartFactorCache, smallSteps) {
+  const NonlinearFactorGraph graph = createGraph();
+  Values values = createValues(pose_above);
+  SmartFactorCache<Camera> cache(1e-3);
+  cache.linearize(graph, values);
+
+  // Steps below tol are ignored until they add up to more than tol
+  const Pose3 step(Rot3(), Point3(4e-4, 0, 0));
+  Pose3 pose3 = pose_above;
+  for (size_t k = 1; k <= 3; k++) {
+    pose3 = pose3 * step;
+    values.update(x3, pose3);
+    cache.linearize(graph, values);
+    EXPECT_LONGS_EQUAL(k < 3 ? 3 : 1, cache.reused());
+  }
+
+  // and then measured from where the factors were relinearized
+  pose3 = pose3 * step;
+  values.update(x3, pose3);
+  cache.linearize(graph, values);
+  EXPECT_LONGS_EQUAL(3, cache.reused());
+}
+
+/* ************************************************************************* */
+TEST(SmartFactorCache, optimize) {
+  const NonlinearFactorGraph graph = createGraph();
+  const Values initial = createValues(
+      pose_above * Pose3(Rot3::Ypr(0.01, 0.01, 0), Point3(0.1, -0.1, 0.05)));
+  const Values expected =
+      LevenbergMarquardtOptimizer(graph, initial).optimize();
+  CachedOptimizer optimizer(graph, initial);
+  EXPECT(assert_equal(expected, optimizer.optimize(), 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
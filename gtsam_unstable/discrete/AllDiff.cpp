@@ -10,6 +10,8 @@
 #include <gtsam/base/Testable.h>
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+
 namespace gtsam {
 
   /* ************************************************************************* */
@@ -59,29 +61,194 @@ namespace gtsam {
   }
 
   /* ************************************************************************* */
-  bool AllDiff::ensureArcConsistency(size_t j, std::vector<Domain>& domains) const {
-    // Though strictly not part of allDiff, we check for
-    // a value in domains[j] that does not occur in any other connected domain.
-    // If found, we make this a singleton...
-    // TODO: make a new constraint where this really is true
-    Domain& Dj = domains[j];
-    if (Dj.checkAllDiff(keys_, domains)) return true;
-
-    // Check all other domains for singletons and erase corresponding values
-    // This is the same as arc-consistency on the equivalent binary constraints
-    bool changed = false;
-    for(Key k: keys_)
-      if (k != j) {
-        const Domain& Dk = domains[k];
-        if (Dk.isSingleton()) { // check if singleton
-          size_t value = Dk.firstValue();
-          if (Dj.contains(value)) {
-            Dj.erase(value); // erase value if true
-            changed = true;
+  DiscreteKeys AllDiff::discreteKeys() const {
+    DiscreteKeys dkeys;
+    for (size_t i = 0; i < keys_.size(); i++)
+      dkeys.push_back(discreteKey(i));
+    return dkeys;
+  }
+
+  /* ************************************************************************* */
+  namespace {
+    // Bipartite graph between the variables of an AllDiff and their values,
+    // with a maximum matching, after Regin, "A filtering algorithm for
+    // constraints of difference in CSPs", AAAI 1994.
+    class ValueGraph {
+      const std::vector<const Domain*> domains_; // one per variable
+      std::vector<size_t> value_;    // value matched to each variable, or npos
+      std::vector<size_t> variable_; // variable matched to each value, or npos
+
+      static const size_t npos = Domain::npos;
+
+      // Look for an augmenting path from variable i, Kuhn's algorithm
+      bool augment(size_t i, std::vector<bool>& visited) {
+        const Domain& D = *domains_[i];
+        for (size_t a = D.firstValue(); a != npos; a = D.nextValue(a)) {
+          if (visited[a]) continue;
+          visited[a] = true;
+          if (variable_[a] == npos || augment(variable_[a], visited)) {
+            value_[i] = a;
+            variable_[a] = i;
+            return true;
+          }
+        }
+        return false;
+      }
+
+    public:
+      ValueGraph(const std::vector<const Domain*>& domains, size_t nrValues) :
+          domains_(domains), value_(domains.size(), npos),
+          variable_(nrValues, npos) {
+      }
+
+      // Match every variable to a distinct value, false if impossible
+      bool match() {
+        for (size_t i = 0; i < domains_.size(); i++) {
+          std::vector<bool> visited(variable_.size(), false);
+          if (!augment(i, visited)) return false;
+        }
+        return true;
+      }
+
+      // Find the values of every variable that take part in some maximum
+      // matching, after match(). In the graph with an edge from each matched
+      // value a to every other value of the variable matched to a, value b of
+      // variable i, if not matched to it, appears in some maximum matching iff
+      // b can reach a free value, or lies on a cycle through i's own matched
+      // value, i.e., is in its strongly connected component.
+      void analyze() {
+        const size_t nrValues = variable_.size();
+        reachesFree_.assign(nrValues, false);
+        std::vector<size_t> stack;
+        for (size_t a = 0; a < nrValues; a++)
+          if (variable_[a] == npos) {
+            reachesFree_[a] = true;
+            stack.push_back(a);
+          }
+        while (!stack.empty()) {
+          const size_t b = stack.back();
+          stack.pop_back();
+          // a reaches b if a is matched to a variable k that also allows b
+          for (size_t k = 0; k < domains_.size(); k++) {
+            const size_t a = value_[k];
+            if (a != b && !reachesFree_[a] && domains_[k]->contains(b)) {
+              reachesFree_[a] = true;
+              stack.push_back(a);
+            }
+          }
+        }
+
+        component_.assign(nrValues, npos);
+        index_.assign(nrValues, npos);
+        low_.assign(nrValues, 0);
+        onStack_.assign(nrValues, false);
+        stack_.clear();
+        counter_ = 0;
+        nrComponents_ = 0;
+        for (size_t a = 0; a < nrValues; a++)
+          if (index_[a] == npos) strongConnect(a);
+      }
+
+      // Whether value a of variable i takes part in some maximum matching,
+      // after analyze()
+      bool supports(size_t i, size_t a) const {
+        return a == value_[i] || reachesFree_[a] ||
+               component_[a] == component_[value_[i]];
+      }
+
+    private:
+      std::vector<bool> reachesFree_, onStack_;
+      std::vector<size_t> component_, index_, low_, stack_;
+      size_t counter_ = 0, nrComponents_ = 0;
+
+      // Tarjan's algorithm, from value a
+      void strongConnect(size_t a) {
+        index_[a] = low_[a] = counter_++;
+        stack_.push_back(a);
+        onStack_[a] = true;
+        if (variable_[a] != npos) {
+          const Domain& D = *domains_[variable_[a]];
+          for (size_t b = D.firstValue(); b != npos; b = D.nextValue(b)) {
+            if (b == a) continue;
+            if (index_[b] == npos) {
+              strongConnect(b);
+              low_[a] = std::min(low_[a], low_[b]);
+            } else if (onStack_[b]) {
+              low_[a] = std::min(low_[a], index_[b]);
+            }
           }
         }
+        if (low_[a] == index_[a]) {
+          size_t b;
+          do {
+            b = stack_.back();
+            stack_.pop_back();
+            onStack_[b] = false;
+            component_[b] = nrComponents_;
+          } while (b != a);
+          nrComponents_++;
+        }
+      }
+    };
+
+    const size_t ValueGraph::npos;
+
+    // The value graph of an AllDiff on the given keys, matched and analyzed.
+    // Throws std::runtime_error if the AllDiff is unsatisfiable.
+    ValueGraph analyzedGraph(const KeyVector& keys, const Domains& domains) {
+      size_t nrValues = 0;
+      std::vector<const Domain*> variables;
+      for (Key k : keys) {
+        const Domain& Dk = domains.at(k);
+        variables.push_back(&Dk);
+        nrValues = std::max(nrValues, Dk.cardinality());
+      }
+      ValueGraph graph(variables, nrValues);
+      if (!graph.match()) throw std::runtime_error("Unsatisfiable");
+      graph.analyze();
+      return graph;
+    }
+
+    // Erase the values of variable i of the graph that it does not support
+    bool prune(const ValueGraph& graph, size_t i, Domain& D) {
+      bool changed = false;
+      for (size_t a = D.firstValue(); a != Domain::npos; a = D.nextValue(a))
+        if (!graph.supports(i, a)) {
+          D.erase(a);
+          changed = true;
+        }
+      return changed;
+    }
+  }
+
+  /* ************************************************************************* */
+  bool AllDiff::ensureArcConsistency(size_t j, Domains& domains) const {
+    // Erase the values of j that take part in no solution of the AllDiff,
+    // i.e., that are not in any matching of all variables to distinct values.
+    // This subsumes erasing the values of singleton domains, and making j a
+    // singleton if it is the only one to allow some value, when there are as
+    // many values as variables.
+    const size_t i =
+        std::find(keys_.begin(), keys_.end(), j) - keys_.begin();
+    if (i == keys_.size()) throw std::invalid_argument(
+        "AllDiff check on wrong domain");
+    const ValueGraph graph = analyzedGraph(keys_, domains);
+    return prune(graph, i, domains.at(j));
+  }
+
+  /* ************************************************************************* */
+  bool AllDiff::filter(Domains& domains, KeySet* changed) const {
+    // One matching decides the values of all variables at once, and leaves
+    // the AllDiff arc-consistent: erasing values that are in no matching
+    // does not take any other value out of all matchings
+    const ValueGraph graph = analyzedGraph(keys_, domains);
+    bool anyChange = false;
+    for (size_t i = 0; i < keys_.size(); i++)
+      if (prune(graph, i, domains.at(keys_[i]))) {
+        changed->insert(keys_[i]);
+        anyChange = true;
       }
-    return changed;
+    return anyChange;
   }
 
   /* ************************************************************************* */
@@ -97,10 +264,10 @@ namespace gtsam {
 
   /* ************************************************************************* */
   Constraint::shared_ptr AllDiff::partiallyApply(
-      const std::vector<Domain>& domains) const {
+      const Domains& domains) const {
     DiscreteFactor::Values known;
     for(Key k: keys_) {
-        const Domain& Dk = domains[k];
+        const Domain& Dk = domains.at(k);
         if (Dk.isSingleton())
           known[k] = Dk.firstValue();
       }
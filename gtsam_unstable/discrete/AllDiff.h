@@ -65,13 +65,19 @@ namespace gtsam {
      * @param j domain to be checked
      * @param domains all other domains
      */
-    bool ensureArcConsistency(size_t j, std::vector<Domain>& domains) const override;
+    bool ensureArcConsistency(size_t j, Domains& domains) const override;
+
+    /// Ensure arc-consistency of all variables from a single matching
+    bool filter(Domains& domains, KeySet* changed) const override;
+
+    /// Keys with their cardinalities
+    DiscreteKeys discreteKeys() const override;
 
     /// Partially apply known values
     Constraint::shared_ptr partiallyApply(const Values&) const override;
 
     /// Partially apply known values, domain version
-    Constraint::shared_ptr partiallyApply(const std::vector<Domain>&) const override;
+    Constraint::shared_ptr partiallyApply(const Domains&) const override;
   };
 
 } // namespace gtsam
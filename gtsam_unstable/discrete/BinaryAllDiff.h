@@ -10,6 +10,7 @@
 #include <gtsam_unstable/discrete/Domain.h>
 #include <gtsam_unstable/discrete/Constraint.h>
 #include <gtsam/discrete/DecisionTreeFactor.h>
+#include <boost/make_shared.hpp>
 
 namespace gtsam {
 
@@ -75,25 +76,58 @@ namespace gtsam {
 
     /*
      * Ensure Arc-consistency
+     * A value of j only lacks support if the other domain is a singleton
      * @param j domain to be checked
      * @param domains all other domains
      */
-    ///
-    bool ensureArcConsistency(size_t j, std::vector<Domain>& domains) const override {
-//      throw std::runtime_error(
-//          "BinaryAllDiff::ensureArcConsistency not implemented");
-      return false;
+    bool ensureArcConsistency(size_t j, Domains& domains) const override {
+      if (j != keys_[0] && j != keys_[1]) throw std::invalid_argument(
+          "BinaryAllDiff check on wrong domain");
+      const Domain& Dk = domains.at(j == keys_[0] ? keys_[1] : keys_[0]);
+      Domain& Dj = domains.at(j);
+      if (!Dk.isSingleton() || !Dj.contains(Dk.firstValue())) return false;
+      Dj.erase(Dk.firstValue());
+      if (Dj.nrValues() == 0) throw std::runtime_error("Unsatisfiable");
+      return true;
+    }
+
+    /// Keys with their cardinalities
+    DiscreteKeys discreteKeys() const override {
+      DiscreteKeys keys;
+      keys.push_back(DiscreteKey(keys_[0], cardinality0_));
+      keys.push_back(DiscreteKey(keys_[1], cardinality1_));
+      return keys;
     }
 
     /// Partially apply known values
-    Constraint::shared_ptr partiallyApply(const Values&) const override {
-      throw std::runtime_error("BinaryAllDiff::partiallyApply not implemented");
+    Constraint::shared_ptr partiallyApply(const Values& values) const override {
+      Values::const_iterator it0 = values.find(keys_[0]);
+      Values::const_iterator it1 = values.find(keys_[1]);
+      if (it0 != values.end() && it1 != values.end()) {
+        if (it0->second == it1->second) throw std::runtime_error(
+            "BinaryAllDiff::partiallyApply: unsatisfiable");
+        return boost::make_shared<Domain>(
+            DiscreteKey(keys_[0], cardinality0_), it0->second);
+      }
+      if (it0 == values.end() && it1 == values.end())
+        return boost::make_shared<BinaryAllDiff>(*this);
+      // One key is known: the other may take any value but that one
+      const bool known0 = it0 != values.end();
+      Domain domain(known0 ? DiscreteKey(keys_[1], cardinality1_)
+                           : DiscreteKey(keys_[0], cardinality0_));
+      domain.erase(known0 ? it0->second : it1->second);
+      return boost::make_shared<Domain>(domain);
     }
 
     /// Partially apply known values, domain version
     Constraint::shared_ptr partiallyApply(
-        const std::vector<Domain>&) const override {
-      throw std::runtime_error("BinaryAllDiff::partiallyApply not implemented");
+        const Domains& domains) const override {
+      Values known;
+      for (Key k : keys_) {
+        const Domain& Dk = domains.at(k);
+        if (Dk.isSingleton()) known[k] = Dk.firstValue();
+      }
+      return partiallyApply(known);
     }
   };
 
@@ -8,6 +8,10 @@
 #include <gtsam_unstable/discrete/Domain.h>
 #include <gtsam_unstable/discrete/CSP.h>
 #include <gtsam/base/Testable.h>
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 
@@ -15,89 +19,179 @@ namespace gtsam {
 
   /// Find the best total assignment - can be expensive
   CSP::sharedValues CSP::optimalAssignment() const {
-    DiscreteBayesNet::shared_ptr chordal = this->eliminateSequential();
+    DiscreteBayesNet::shared_ptr chordal = pruned().eliminateSequential();
     sharedValues mpe = chordal->optimize();
     return mpe;
   }
 
   /// Find the best total assignment - can be expensive
   CSP::sharedValues CSP::optimalAssignment(const Ordering& ordering) const {
-    DiscreteBayesNet::shared_ptr chordal = this->eliminateSequential(ordering);
+    DiscreteBayesNet::shared_ptr chordal =
+        pruned().eliminateSequential(ordering);
     sharedValues mpe = chordal->optimize();
     return mpe;
   }
 
-  void CSP::runArcConsistency(size_t cardinality, size_t nrIterations, bool print) const {
-    // Create VariableIndex
-    VariableIndex index(*this);
-    // index.print();
+  namespace {
+    // Erase the values of j without support in a factor that is not a
+    // constraint, i.e., for which the table is zero given the other domains
+    bool reviseTable(const DiscreteFactor& factor, Key j,
+        Domains& domains) {
+      DecisionTreeFactor product = factor.toDecisionTreeFactor();
+      Ordering others;
+      for (Key k : factor.keys())
+        if (k != j) {
+          const Domain& Dk = domains.at(k);
+          if (Dk.nrValues() < Dk.cardinality()) product = Dk * product;
+          others.push_back(k);
+        }
+      DecisionTreeFactor::shared_ptr support = others.empty()
+          ? boost::make_shared<DecisionTreeFactor>(product)
+          : product.combine(others, Potentials::ADT::Ring::max);
 
-    size_t n = index.size();
+      Domain& Dj = domains.at(j);
+      bool changed = false;
+      DiscreteFactor::Values values;
+      for (size_t a = Dj.firstValue(); a != Domain::npos;
+          a = Dj.nextValue(a)) {
+        values[j] = a;
+        if ((*support)(values) <= 0) {
+          Dj.erase(a);
+          changed = true;
+        }
+      }
+      return changed;
+    }
 
-    // Initialize domains
-    std::vector < Domain > domains;
-    for (size_t j = 0; j < n; j++)
-      domains.push_back(Domain(DiscreteKey(j,cardinality)));
-
-    // Create array of flags indicating a domain changed or not
-    std::vector<bool> changed(n);
-
-    // iterate nrIterations over entire grid
-    for (size_t it = 0; it < nrIterations; it++) {
-      bool anyChange = false;
-      // iterate over all cells
-      for (size_t v = 0; v < n; v++) {
-        // keep track of which domains changed
-        changed[v] = false;
-        // loop over all factors/constraints for variable v
-        const FactorIndices& factors = index[v];
-        for(size_t f: factors) {
-          // if not already a singleton
-          if (!domains[v].isSingleton()) {
-            // get the constraint and call its ensureArcConsistency method
-            Constraint::shared_ptr constraint = boost::dynamic_pointer_cast<Constraint>((*this)[f]);
-            if (!constraint) throw runtime_error("CSP:runArcConsistency: non-constraint factor");
-            changed[v] = constraint->ensureArcConsistency(v,domains) || changed[v];
+    // Revise all variables of a table in turn until none changes
+    bool reviseTable(const DiscreteFactor& factor, Domains& domains,
+        KeySet* changed) {
+      bool anyChange = false, again = true;
+      while (again) {
+        again = false;
+        for (Key j : factor.keys())
+          if (reviseTable(factor, j, domains)) {
+            changed->insert(j);
+            anyChange = again = true;
           }
-        } // f
-        if (changed[v]) anyChange = true;
-      } // v
-      if (!anyChange) break;
+      }
+      return anyChange;
+    }
+  }
+
+  Domains CSP::domains() const {
+    // Find the cardinalities from the factors
+    std::map<Key, size_t> cardinalities;
+    for (const DiscreteFactor::shared_ptr& f : factors_) {
+      if (!f) continue;
+      if (Constraint::shared_ptr constraint =
+          boost::dynamic_pointer_cast<Constraint>(f)) {
+        for (const DiscreteKey& dkey : constraint->discreteKeys())
+          cardinalities[dkey.first] = dkey.second;
+      } else {
+        const DecisionTreeFactor table = f->toDecisionTreeFactor();
+        for (Key k : table.keys())
+          cardinalities[k] = table.cardinality(k);
+      }
+    }
+
+    Domains domains;
+    for (const std::pair<const Key, size_t>& key_cardinality : cardinalities)
+      domains.emplace(key_cardinality.first, Domain(key_cardinality));
+    return domains;
+  }
+
+  bool CSP::runArcConsistency(Domains& domains,
+      size_t nrIterations, bool print) const {
+    VariableIndex index(*this);
+    const size_t n = domains.size();
+    for (const VariableIndex::value_type& key_factors : index)
+      if (!domains.count(key_factors.first)) throw invalid_argument(
+          "CSP::runArcConsistency: no domain for key");
+
+    // Factors to revise in this round and the next, without duplicates
+    std::vector<size_t> current, next;
+    std::vector<bool> queued(size(), false);
+    for (size_t f = 0; f < size(); f++)
+      if ((*this)[f]) {
+        current.push_back(f);
+        queued[f] = true;
+      }
+
+    bool anyChange = false;
+    KeySet changed, revised;
+    for (size_t it = 0; it < nrIterations && !current.empty(); it++) {
+      changed.clear();
+      for (size_t f : current) {
+        queued[f] = false;
+        // revise all variables of the factor at once
+        const DiscreteFactor::shared_ptr& factor = (*this)[f];
+        Constraint::shared_ptr constraint =
+            boost::dynamic_pointer_cast<Constraint>(factor);
+        revised.clear();
+        if (!(constraint ? constraint->filter(domains, &revised)
+                         : reviseTable(*factor, domains, &revised)))
+          continue;
+        anyChange = true;
+        // schedule the other factors of revised variables for the next round
+        for (Key k : revised) {
+          if (domains.at(k).nrValues() == 0) throw runtime_error("Unsatisfiable");
+          changed.insert(k);
+          for (size_t g : index[k])
+            if (g != f && !queued[g]) {
+              queued[g] = true;
+              next.push_back(g);
+            }
+        }
+      } // f
+      current.swap(next);
+      next.clear();
+
       // TODO: Sudoku specific hack
       if (print) {
-        if (cardinality == 9 && n == 81) {
-          for (size_t i = 0, v = 0; i < (size_t)std::sqrt((double)n); i++) {
-            for (size_t j = 0; j < (size_t)std::sqrt((double)n); j++, v++) {
-              if (changed[v]) cout << "*";
-              domains[v].print();
-              cout << "\t";
-            } // i
-            cout << endl;
-          } // j
-        } else {
-          for (size_t v = 0; v < n; v++) {
-            if (changed[v]) cout << "*";
-            domains[v].print();
-            cout << "\t";
-          } // v
-        }
+        const size_t row = (n == 81 && domains.begin()->second.cardinality() == 9)
+            ? (size_t)std::sqrt((double)n) : n;
+        size_t i = 0;
+        for (const Domains::value_type& key_domain : domains) {
+          if (changed.count(key_domain.first)) cout << "*";
+          key_domain.second.print();
+          cout << "\t";
+          if (++i % row == 0 && row != n) cout << endl;
+        } // v
         cout << endl;
       } // print
     } // it
+    return anyChange;
+  }
 
-#ifndef INPROGRESS
-    // Now create new problem with all singleton variables removed
-    // We do this by adding simplifying all factors using parial application
-    // TODO: create a new ordering as we go, to ensure a connected graph
-    // KeyOrdering ordering;
-    // vector<Index> dkeys;
-    for(const DiscreteFactor::shared_ptr& f: factors_) {
-      Constraint::shared_ptr constraint = boost::dynamic_pointer_cast<Constraint>(f);
-      if (!constraint) throw runtime_error("CSP:runArcConsistency: non-constraint factor");
-      Constraint::shared_ptr reduced = constraint->partiallyApply(domains);
-      if (print) reduced->print();
+  void CSP::runArcConsistency(size_t cardinality, size_t nrIterations, bool print) const {
+    // Initialize domains
+    Domains domains;
+    for (Key j : keys())
+      domains.emplace(j, Domain(DiscreteKey(j, cardinality)));
+
+    runArcConsistency(domains, nrIterations, print);
+
+    if (print) {
+      // Now create new problem with all singleton variables removed
+      // We do this by adding simplifying all factors using parial application
+      // TODO: create a new ordering as we go, to ensure a connected graph
+      for(const DiscreteFactor::shared_ptr& f: factors_) {
+        Constraint::shared_ptr constraint = boost::dynamic_pointer_cast<Constraint>(f);
+        if (!constraint) throw runtime_error("CSP:runArcConsistency: non-constraint factor");
+        Constraint::shared_ptr reduced = constraint->partiallyApply(domains);
+        reduced->print();
+      }
     }
-#endif
   }
-} // gtsam
 
+  DiscreteFactorGraph CSP::pruned() const {
+    Domains domains = this->domains();
+    DiscreteFactorGraph graph(*this);
+    if (!runArcConsistency(domains)) return graph;
+    for (const Domains::value_type& key_domain : domains)
+      if (key_domain.second.nrValues() < key_domain.second.cardinality())
+        graph.push_back(boost::make_shared<Domain>(key_domain.second));
+    return graph;
+  }
+} // gtsam
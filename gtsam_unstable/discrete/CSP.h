@@ -11,6 +11,8 @@
 #include <gtsam_unstable/discrete/SingleValue.h>
 #include <gtsam/discrete/DiscreteFactorGraph.h>
 
+#include <limits>
+
 namespace gtsam {
 
   /**
@@ -60,9 +62,13 @@ namespace gtsam {
 //    }
 
     /// Find the best total assignment - can be expensive
+    /// Runs arc-consistency first, see pruned(), and hence throws
+    /// std::runtime_error("Unsatisfiable") if the CSP has no solution
     sharedValues optimalAssignment() const;
 
     /// Find the best total assignment - can be expensive
+    /// Runs arc-consistency first, see pruned(), and hence throws
+    /// std::runtime_error("Unsatisfiable") if the CSP has no solution
     sharedValues optimalAssignment(const Ordering& ordering) const;
 
 //    /*
@@ -84,6 +90,34 @@ namespace gtsam {
      */
     void runArcConsistency(size_t cardinality, size_t nrIterations = 10,
         bool print = false) const;
+
+    /// All-allowed domains for all variables
+    Domains domains() const;
+
+    /*
+     * Apply arc-consistency to the given domains.
+     * Works in rounds: the first round revises all factors, and every next
+     * round only the other factors of variables whose domain shrank in the
+     * one before, as in AC-3. Each revision filters all variables of a
+     * factor, with one matching for an AllDiff. Factors that are not
+     * constraints, e.g., tables in the Scheduler, are revised by looking for
+     * support in their table.
+     * Throws std::runtime_error if a domain becomes empty.
+     * @param nrIterations maximum number of rounds, stops earlier at a fixpoint
+     * @return true if any domain shrank
+     */
+    bool runArcConsistency(Domains& domains,
+        size_t nrIterations = std::numeric_limits<size_t>::max(),
+        bool print = false) const;
+
+    /*
+     * Run arc-consistency and return a copy of the graph, with a Domain
+     * factor added for every variable whose domain shrank. This does not change
+     * the solutions, but the zeros introduced early keep the decision trees
+     * created during elimination small.
+     * Throws std::runtime_error("Unsatisfiable") if a domain becomes empty.
+     */
+    DiscreteFactorGraph pruned() const;
   }; // CSP
 
 } // gtsam
@@ -19,12 +19,18 @@
 
 #include <gtsam_unstable/dllexport.h>
 #include <gtsam/discrete/DiscreteFactor.h>
+#include <gtsam/discrete/DiscreteKey.h>
 #include <boost/assign.hpp>
 
+#include <map>
+
 namespace gtsam {
 
   class Domain;
 
+  /// The domains of the variables of a CSP, by key
+  typedef std::map<Key, Domain> Domains;
+
   /**
    * Base class for discrete probabilistic factors
    * The most general one is the derived DecisionTreeFactor
@@ -78,14 +84,38 @@ namespace gtsam {
      * @param j domain to be checked
      * @param domains all other domains
      */
-    virtual bool ensureArcConsistency(size_t j, std::vector<Domain>& domains) const = 0;
+    virtual bool ensureArcConsistency(size_t j, Domains& domains) const = 0;
+
+    /**
+     * Ensure arc-consistency of all variables of the constraint, by revising
+     * them in turn until none changes. Constraints that can revise all their
+     * variables at once, like AllDiff, override this.
+     * @param domains all domains
+     * @param changed keys whose domains shrank are added to this
+     * @return true if any domain shrank
+     */
+    virtual bool filter(Domains& domains, KeySet* changed) const {
+      bool anyChange = false, again = true;
+      while (again) {
+        again = false;
+        for (Key j : keys_)
+          if (ensureArcConsistency(j, domains)) {
+            changed->insert(j);
+            anyChange = again = true;
+          }
+      }
+      return anyChange;
+    }
+
+    /// Keys with their cardinalities
+    virtual DiscreteKeys discreteKeys() const = 0;
 
     /// Partially apply known values
     virtual shared_ptr partiallyApply(const Values&) const = 0;
 
 
     /// Partially apply known values, domain version
-    virtual shared_ptr partiallyApply(const std::vector<Domain>&) const = 0;
+    virtual shared_ptr partiallyApply(const Domains&) const = 0;
     /// @}
   };
 // DiscreteFactor
@@ -14,6 +14,8 @@ namespace gtsam {
 
   using namespace std;
 
+  const size_t Domain::npos;
+
   /* ************************************************************************* */
   void Domain::print(const string& s,
       const KeyFormatter& formatter) const {
@@ -21,7 +23,25 @@ namespace gtsam {
 //    formatter(keys_[0]) << ") with values";
 //    for (size_t v: values_) cout << " " << v;
 //    cout << endl;
-    for (size_t v: values_) cout << v;
+    for (size_t v = firstValue(); v != npos; v = nextValue(v)) cout << v;
+  }
+
+  /* ************************************************************************* */
+  bool Domain::intersect(const Domain& other) {
+    const size_t before = nrValues();
+    if (other.cardinality_ == cardinality_)
+      values_ &= other.values_;
+    else
+      for (size_t v = firstValue(); v != npos; v = nextValue(v))
+        if (!other.contains(v)) values_.reset(v);
+    return nrValues() != before;
+  }
+
+  /* ************************************************************************* */
+  DiscreteKeys Domain::discreteKeys() const {
+    DiscreteKeys keys;
+    keys += DiscreteKey(keys_[0], cardinality_);
+    return keys;
   }
 
   /* ************************************************************************* */
@@ -47,27 +67,27 @@ namespace gtsam {
   }
 
   /* ************************************************************************* */
-  bool Domain::ensureArcConsistency(size_t j, vector<Domain>& domains) const {
+  bool Domain::ensureArcConsistency(size_t j, Domains& domains) const {
     if (j != keys_[0]) throw invalid_argument("Domain check on wrong domain");
-    Domain& D = domains[j];
-    for(size_t value: values_)
-      if (!D.contains(value)) throw runtime_error("Unsatisfiable");
-    D = *this;
-    return true;
+    Domain& D = domains.at(j);
+    bool changed = D.intersect(*this);
+    if (D.nrValues() == 0) throw runtime_error("Unsatisfiable");
+    return changed;
   }
 
   /* ************************************************************************* */
-  bool Domain::checkAllDiff(const KeyVector keys, vector<Domain>& domains) {
+  bool Domain::checkAllDiff(const KeyVector keys, Domains& domains) {
     Key j = keys_[0];
     // for all values in this domain
-    for(size_t value: values_) {
+    for (size_t value = firstValue(); value != npos;
+        value = nextValue(value)) {
       // for all connected domains
       for(Key k: keys)
         // if any domain contains the value we cannot make this domain singleton
-        if (k!=j && domains[k].contains(value))
+        if (k!=j && domains.at(k).contains(value))
           goto found;
-      values_.clear();
-      values_.insert(value);
+      values_.reset();
+      values_.set(value);
       return true; // we changed it
       found:;
     }
@@ -85,9 +105,9 @@ namespace gtsam {
 
   /* ************************************************************************* */
   Constraint::shared_ptr Domain::partiallyApply(
-      const vector<Domain>& domains) const {
-    const Domain& Dk = domains[keys_[0]];
-    if (Dk.isSingleton() && !contains(*Dk.begin())) throw runtime_error(
+      const Domains& domains) const {
+    const Domain& Dk = domains.at(keys_[0]);
+    if (Dk.isSingleton() && !contains(Dk.firstValue())) throw runtime_error(
         "Domain::partiallyApply: unsatisfiable");
     return boost::make_shared < Domain > (Dk);
   }
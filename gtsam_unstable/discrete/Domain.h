@@ -9,6 +9,9 @@
 
 #include <gtsam_unstable/discrete/Constraint.h>
 #include <gtsam/discrete/DiscreteKey.h>
+#include <boost/dynamic_bitset.hpp>
+
+#include <stdexcept>
 
 namespace gtsam {
 
@@ -18,7 +21,7 @@ namespace gtsam {
   class GTSAM_UNSTABLE_EXPORT Domain: public Constraint {
 
     size_t cardinality_; /// Cardinality
-    std::set<size_t> values_; /// allowed values
+    boost::dynamic_bitset<> values_; /// allowed values, one bit per value
 
   public:
 
@@ -26,35 +29,37 @@ namespace gtsam {
 
     // Constructor on Discrete Key initializes an "all-allowed" domain
     Domain(const DiscreteKey& dkey) :
-      Constraint(dkey.first), cardinality_(dkey.second) {
-      for (size_t v = 0; v < cardinality_; v++)
-        values_.insert(v);
+      Constraint(dkey.first), cardinality_(dkey.second),
+          values_(dkey.second) {
+      values_.set();
     }
 
     // Constructor on Discrete Key with single allowed value
     // Consider SingleValue constraint
     Domain(const DiscreteKey& dkey, size_t v) :
-      Constraint(dkey.first), cardinality_(dkey.second) {
-      values_.insert(v);
-    }
-
-    /// Constructor
-    Domain(const Domain& other) :
-      Constraint(other.keys_[0]), values_(other.values_) {
+      Constraint(dkey.first), cardinality_(dkey.second),
+          values_(dkey.second) {
+      insert(v);
     }
 
     /// insert a value, non const :-(
+    /// Throws std::invalid_argument if value is not less than the cardinality
     void insert(size_t value) {
-      values_.insert(value);
+      if (value >= cardinality_)
+        throw std::invalid_argument("Domain: value out of range");
+      values_.set(value);
     }
 
     /// erase a value, non const :-(
     void erase(size_t value) {
-       values_.erase(value);
+      if (value < cardinality_) values_.reset(value);
     }
 
+    /// Restrict to the values also in other, returns true if any were erased
+    bool intersect(const Domain& other);
+
     size_t nrValues() const {
-      return values_.size();
+      return values_.count();
     }
 
     bool isSingleton() const {
@@ -62,7 +67,25 @@ namespace gtsam {
     }
 
     size_t firstValue() const {
-      return *values_.begin();
+      return values_.find_first();
+    }
+
+    /// Next allowed value after value, or npos if there is none
+    size_t nextValue(size_t value) const {
+      return values_.find_next(value);
+    }
+
+    /// Returned by firstValue and nextValue when there are no more values
+    static const size_t npos = boost::dynamic_bitset<>::npos;
+
+    /// Number of possible values of the variable
+    size_t cardinality() const {
+      return cardinality_;
+    }
+
+    /// The allowed values, as a bitset
+    const boost::dynamic_bitset<>& values() const {
+      return values_;
     }
 
     // print
@@ -80,12 +103,15 @@ namespace gtsam {
     }
 
     bool contains(size_t value) const {
-      return values_.count(value)>0;
+      return value < cardinality_ && values_.test(value);
     }
 
     /// Calculate value
     double operator()(const Values& values) const override;
 
+    /// Key and cardinality
+    DiscreteKeys discreteKeys() const override;
+
     /// Convert into a decisiontree
     DecisionTreeFactor toDecisionTreeFactor() const override;
 
@@ -97,21 +123,21 @@ namespace gtsam {
      * @param j domain to be checked
      * @param domains all other domains
      */
-    bool ensureArcConsistency(size_t j, std::vector<Domain>& domains) const override;
+    bool ensureArcConsistency(size_t j, Domains& domains) const override;
 
     /**
      *  Check for a value in domain that does not occur in any other connected domain.
      *  If found, we make this a singleton... Called in AllDiff::ensureArcConsistency
      *  @param keys connected domains through alldiff
      */
-    bool checkAllDiff(const KeyVector keys, std::vector<Domain>& domains);
+    bool checkAllDiff(const KeyVector keys, Domains& domains);
 
     /// Partially apply known values
     Constraint::shared_ptr partiallyApply(const Values& values) const override;
 
     /// Partially apply known values, domain version
     Constraint::shared_ptr partiallyApply(
-        const std::vector<Domain>& domains) const override;
+        const Domains& domains) const override;
   };
 
 } // namespace gtsam
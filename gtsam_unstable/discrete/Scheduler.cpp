@@ -261,7 +261,8 @@ namespace gtsam {
     Ordering defaultKeyOrdering;
     for (size_t i = 0; i<maxKey; ++i)
       defaultKeyOrdering += Key(i);
-    DiscreteBayesNet::shared_ptr chordal = this->eliminateSequential(defaultKeyOrdering);
+    DiscreteBayesNet::shared_ptr chordal =
+        pruned().eliminateSequential(defaultKeyOrdering);
     gttoc(my_eliminate);
     return chordal;
   }
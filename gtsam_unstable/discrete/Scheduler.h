@@ -152,10 +152,13 @@ namespace gtsam {
     void accumulateStats(sharedValues assignment,
         std::vector<size_t>& stats) const;
 
-    /** Eliminate, return a Bayes net */
+    /** Run arc-consistency, then eliminate, return a Bayes net */
     DiscreteBayesNet::shared_ptr eliminate() const;
 
-    /** Find the best total assignment - can be expensive */
+    /**
+     * Find the best total assignment - can be expensive
+     * Throws std::runtime_error("Unsatisfiable") if no schedule is possible
+     */
     sharedValues optimalAssignment() const;
 
     /** find the assignment of students to slots with most possible committees */
@@ -46,14 +46,15 @@ namespace gtsam {
 
   /* ************************************************************************* */
   bool SingleValue::ensureArcConsistency(size_t j,
-      vector<Domain>& domains) const {
+      Domains& domains) const {
     if (j != keys_[0]) throw invalid_argument(
         "SingleValue check on wrong domain");
-    Domain& D = domains[j];
+    Domain& D = domains.at(j);
     if (D.isSingleton()) {
       if (D.firstValue() != value_) throw runtime_error("Unsatisfiable");
       return false;
     }
+    if (!D.contains(value_)) throw runtime_error("Unsatisfiable");
     D = Domain(discreteKey(),value_);
     return true;
   }
@@ -68,8 +69,8 @@ namespace gtsam {
 
   /* ************************************************************************* */
   Constraint::shared_ptr SingleValue::partiallyApply(
-      const vector<Domain>& domains) const {
-    const Domain& Dk = domains[keys_[0]];
+      const Domains& domains) const {
+    const Domain& Dk = domains.at(keys_[0]);
     if (Dk.isSingleton() && !Dk.contains(value_)) throw runtime_error(
         "SingleValue::partiallyApply: unsatisfiable");
     return boost::make_shared < SingleValue > (discreteKey(), value_);
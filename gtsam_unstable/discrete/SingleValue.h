@@ -69,14 +69,21 @@ namespace gtsam {
      * @param j domain to be checked
      * @param domains all other domains
      */
-    bool ensureArcConsistency(size_t j, std::vector<Domain>& domains) const override;
+    bool ensureArcConsistency(size_t j, Domains& domains) const override;
+
+    /// Key and cardinality
+    DiscreteKeys discreteKeys() const override {
+      DiscreteKeys keys;
+      keys.push_back(discreteKey());
+      return keys;
+    }
 
     /// Partially apply known values
     Constraint::shared_ptr partiallyApply(const Values& values) const override;
 
     /// Partially apply known values, domain version
     Constraint::shared_ptr partiallyApply(
-        const std::vector<Domain>& domains) const override;
+        const Domains& domains) const override;
   };
 
 } // namespace gtsam
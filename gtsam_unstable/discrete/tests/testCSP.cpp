@@ -7,6 +7,7 @@
 
 #include <gtsam_unstable/discrete/CSP.h>
 #include <gtsam_unstable/discrete/Domain.h>
+#include <gtsam/inference/Symbol.h>
 #include <boost/assign/std/map.hpp>
 using boost::assign::insert;
 #include <CppUnitLite/TestHarness.h>
@@ -192,16 +193,34 @@ TEST_UNSAFE( CSP, AllDiff)
   EXPECT_DOUBLES_EQUAL(1, csp(*mpe), 1e-9);
 
   // Arc-consistency
-  vector<Domain> domains;
-  domains += Domain(ID), Domain(AZ), Domain(UT);
+  Domains domains;
+  domains.emplace(ID.first, Domain(ID));
+  domains.emplace(AZ.first, Domain(AZ));
+  domains.emplace(UT.first, Domain(UT));
   SingleValue singleValue(AZ,2);
   EXPECT(singleValue.ensureArcConsistency(1,domains));
   EXPECT(alldiff.ensureArcConsistency(0,domains));
   EXPECT(!alldiff.ensureArcConsistency(1,domains));
   EXPECT(alldiff.ensureArcConsistency(2,domains));
-  LONGS_EQUAL(2,domains[0].nrValues());
-  LONGS_EQUAL(1,domains[1].nrValues());
-  LONGS_EQUAL(2,domains[2].nrValues());
+  LONGS_EQUAL(2,domains.at(0).nrValues());
+  LONGS_EQUAL(1,domains.at(1).nrValues());
+  LONGS_EQUAL(2,domains.at(2).nrValues());
+
+  // All variables at once, from one matching
+  Domains fresh;
+  fresh.emplace(ID.first, Domain(ID));
+  fresh.emplace(AZ.first, Domain(AZ));
+  fresh.emplace(UT.first, Domain(UT));
+  KeySet changed;
+  EXPECT(singleValue.filter(fresh, &changed));
+  EXPECT(alldiff.filter(fresh, &changed));
+  LONGS_EQUAL(3,changed.size());
+  EXPECT(!fresh.at(0).contains(2) && !fresh.at(2).contains(2));
+  LONGS_EQUAL(2,fresh.at(0).nrValues());
+  LONGS_EQUAL(2,fresh.at(2).nrValues());
+  changed.clear();
+  EXPECT(!alldiff.filter(fresh, &changed));
+  EXPECT(changed.empty());
 
   // Parial application, version 1
   DiscreteFactor::Values known;
@@ -223,6 +242,85 @@ TEST_UNSAFE( CSP, AllDiff)
   csp.runArcConsistency(nrColors);
 }
 
+/* ************************************************************************* */
+TEST_UNSAFE( CSP, ArcConsistency)
+{
+  // A Hall set: ID and UT share two colors, so AZ cannot take either
+  size_t nrColors = 3;
+  DiscreteKey ID(0, nrColors), AZ(1, nrColors), UT(2, nrColors),
+      NV(3, nrColors), CA(4, nrColors);
+  CSP csp;
+  vector<DiscreteKey> dkeys;
+  dkeys += ID, AZ, UT;
+  csp.addAllDiff(dkeys);
+  csp.add(ID, "1 1 0");
+  csp.add(UT, "1 1 0");
+  csp.addAllDiff(AZ, NV);
+  csp.addAllDiff(NV, CA);
+
+  Domains domains = csp.domains();
+  LONGS_EQUAL(5, domains.size());
+  EXPECT(csp.runArcConsistency(domains));
+  LONGS_EQUAL(2, domains.at(0).nrValues());
+  LONGS_EQUAL(1, domains.at(1).nrValues());
+  LONGS_EQUAL(2, domains.at(1).firstValue());
+  LONGS_EQUAL(2, domains.at(2).nrValues());
+  LONGS_EQUAL(2, domains.at(3).nrValues());
+  EXPECT(!domains.at(3).contains(2));
+  LONGS_EQUAL(3, domains.at(4).nrValues());
+
+  // At a fixpoint, nothing changes anymore
+  EXPECT(!csp.runArcConsistency(domains));
+
+  // Pruning does not change the solution
+  DiscreteFactorGraph pruned = csp.pruned();
+  LONGS_EQUAL(csp.size() + 4, pruned.size());
+  CSP::sharedValues mpe = csp.optimalAssignment();
+  EXPECT_DOUBLES_EQUAL(1, csp(*mpe), 1e-9);
+  EXPECT(assert_equal(*pruned.optimize(), *mpe));
+
+  // Three variables with two colors
+  CSP unsatisfiable;
+  dkeys.clear();
+  dkeys += DiscreteKey(0, 2), DiscreteKey(1, 2), DiscreteKey(2, 2);
+  unsatisfiable.addAllDiff(dkeys);
+  domains = unsatisfiable.domains();
+  CHECK_EXCEPTION(unsatisfiable.runArcConsistency(domains), std::runtime_error);
+  CHECK_EXCEPTION(unsatisfiable.optimalAssignment(), std::runtime_error);
+}
+
+/* ************************************************************************* */
+TEST_UNSAFE( CSP, SymbolKeys)
+{
+  // Domains are kept by key, so large keys cost no more than small ones
+  DiscreteKey A(Symbol('a', 1), 3), B(Symbol('b', 7), 3), C(Symbol('c', 2), 3);
+  CSP csp;
+  csp.addAllDiff(A, B);
+  csp.addAllDiff(B, C);
+  csp.addSingleValue(A, 1);
+  csp.addSingleValue(C, 0);
+
+  Domains domains = csp.domains();
+  LONGS_EQUAL(3, domains.size());
+  EXPECT(csp.runArcConsistency(domains));
+  LONGS_EQUAL(1, domains.at(B.first).nrValues());
+  LONGS_EQUAL(2, domains.at(B.first).firstValue());
+
+  CSP::sharedValues mpe = csp.optimalAssignment();
+  LONGS_EQUAL(2, mpe->at(B.first));
+  EXPECT_DOUBLES_EQUAL(1, csp(*mpe), 1e-9);
+}
+
+/* ************************************************************************* */
+TEST_UNSAFE( CSP, DomainOutOfRange)
+{
+  DiscreteKey A(0, 3);
+  CHECK_EXCEPTION(Domain(A, 3), std::invalid_argument);
+  Domain domain(A, 2);
+  CHECK_EXCEPTION(domain.insert(5), std::invalid_argument);
+  LONGS_EQUAL(1, domain.nrValues());
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -154,7 +154,7 @@ TEST_UNSAFE( Sudoku, easy)
       5,0,0, 0,3,0, 7,0,0);
 
   // Do BP
-  sudoku.runArcConsistency(4,10,PRINT);
+  sudoku.runArcConsistency(9,10,PRINT);
 
   // sudoku.printSolution(); // don't do it
 }
@@ -18,6 +18,7 @@
  */
 
 #include <gtsam_unstable/linear/InfeasibleInitialValues.h>
+#include <gtsam/linear/linearExceptions.h>
 
 /******************************************************************************/
 // Convenient macros to reduce syntactic noise. undef later.
@@ -28,6 +29,21 @@
 
 namespace gtsam {
 
+namespace internal {
+/// Insert zeros into @p x for the variables of @p factor it does not have
+inline void insertZeros(const GaussianFactor& factor, VectorValues* x) {
+  for (auto it = factor.begin(); it != factor.end(); ++it)
+    if (!x->exists(*it)) x->insert(*it, Vector::Zero(factor.getDim(it)));
+}
+
+/// Insert zeros into @p x for the variables of @p graph it does not have
+template <class FACTOR>
+void insertZeros(const FactorGraph<FACTOR>& graph, VectorValues* x) {
+  for (const auto& factor : graph)
+    if (factor) insertZeros(*factor, x);
+}
+}  // namespace internal
+
 /* We have to make sure the new solution with alpha satisfies all INACTIVE inequality constraints
  * If some inactive inequality constraints complain about the full step (alpha = 1),
  * we have to adjust alpha to stay within the inequality constraints' feasible regions.
@@ -189,35 +205,78 @@ This::buildWorkingGraph(const InequalityFactorGraph& workingSet,
   return workingGraph;
 }
 
+//******************************************************************************
+Template WorkingSetFactorization::shared_ptr This::factorize(
+    const InequalityFactorGraph& workingSet, const VectorValues& xk) const {
+  const GaussianFactorGraph cost = POLICY::buildCostFunction(problem_, xk);
+  VectorValues::Dims dims;
+  for (const GaussianFactor::shared_ptr& factor : cost)
+    for (auto it = factor->begin(); it != factor->end(); ++it)
+      dims[*it] = factor->getDim(it);
+  for (const LinearEquality::shared_ptr& factor : problem_.equalities)
+    for (auto it = factor->begin(); it != factor->end(); ++it)
+      dims[*it] = factor->getDim(it);
+  for (const LinearInequality::shared_ptr& factor : workingSet)
+    for (auto it = factor->begin(); it != factor->end(); ++it)
+      dims[*it] = factor->getDim(it);
+
+  WorkingSetFactorization::shared_ptr factorization;
+  try {
+    factorization = boost::make_shared<WorkingSetFactorization>(cost, dims);
+  } catch (const IndeterminantLinearSystemException&) {
+    return factorization;
+  }
+  for (const LinearEquality::shared_ptr& factor : problem_.equalities)
+    factorization->add(*factor, factor->dualKey());
+  for (const LinearInequality::shared_ptr& factor : workingSet)
+    if (factor->active()) factorization->add(*factor, factor->dualKey());
+  return factorization;
+}
+
 //******************************************************************************
 Template typename This::State This::iterate(
     const typename This::State& state) const {
   // Algorithm 16.3 from Nocedal06book.
   // Solve with the current working set eqn 16.39, but instead of solving for p
-  // solve for x
-  GaussianFactorGraph workingGraph =
-      buildWorkingGraph(state.workingSet, state.values);
-  VectorValues newValues = workingGraph.optimize();
+  // solve for x. Unless some constraints in the working set are linearly
+  // dependent, the factorization gives both x, through p, and the duals.
+  // Iterates of unbounded LPs, e.g., in LPInitSolver, are not finite, and only
+  // the working graph keeps the infinite variables apart from the others.
+  const WorkingSetFactorization::shared_ptr& factorization = state.factorization;
+  const bool factored = factorization && factorization->complete() &&
+                        state.values.vector().allFinite();
+  VectorValues newValues, duals;
+  if (factored)
+    newValues = factorization->solve(
+        POLICY::buildCostFunction(problem_, state.values), state.values,
+        &duals);
+  else
+    newValues = buildWorkingGraph(state.workingSet, state.values).optimize();
   // If we CAN'T move further
   // if p_k = 0 is the original condition, modified by Duy to say that the state
   // update is zero.
   if (newValues.equals(state.values, 1e-7)) {
     // Compute lambda from the dual graph
-    GaussianFactorGraph::shared_ptr dualGraph = buildDualGraph(state.workingSet,
-        newValues);
-    VectorValues duals = dualGraph->optimize();
+    if (!factored)
+      duals = buildDualGraph(state.workingSet, newValues)->optimize();
     int leavingFactor = identifyLeavingConstraint(state.workingSet, duals);
+    State newState;
     // If all inequality constraints are satisfied: We have the solution!!
     if (leavingFactor < 0) {
-      return State(newValues, duals, state.workingSet, true,
+      newState = State(newValues, duals, state.workingSet, true,
           state.iterations + 1);
     } else {
       // Inactivate the leaving constraint
       InequalityFactorGraph newWorkingSet = state.workingSet;
-      newWorkingSet.at(leavingFactor)->inactivate();
-      return State(newValues, duals, newWorkingSet, false,
+      const LinearInequality::shared_ptr& factor =
+          newWorkingSet.at(leavingFactor);
+      factor->inactivate();
+      if (factorization) factorization->remove(factor->dualKey());
+      newState = State(newValues, duals, newWorkingSet, false,
           state.iterations + 1);
     }
+    newState.factorization = factorization;
+    return newState;
   } else {
     // If we CAN make some progress, i.e. p_k != 0
     // Adapt stepsize if some inactive constraints complain about this move
@@ -228,12 +287,17 @@ Template typename This::State This::iterate(
         computeStepSize(state.workingSet, state.values, p, POLICY::maxAlpha);
     // also add to the working set the one that complains the most
     InequalityFactorGraph newWorkingSet = state.workingSet;
-    if (factorIx >= 0)
-      newWorkingSet.at(factorIx)->activate();
+    if (factorIx >= 0) {
+      const LinearInequality::shared_ptr& factor = newWorkingSet.at(factorIx);
+      factor->activate();
+      if (factorization) factorization->add(*factor, factor->dualKey());
+    }
     // step!
     newValues = state.values + alpha * p;
-    return State(newValues, state.duals, newWorkingSet, false,
+    State newState(newValues, state.duals, newWorkingSet, false,
         state.iterations + 1);
+    newState.factorization = factorization;
+    return newState;
   }
 }
 
@@ -270,6 +334,89 @@ Template std::pair<VectorValues, VectorValues> This::optimize(
   InequalityFactorGraph workingSet = identifyActiveConstraints(
       problem_.inequalities, initialValues, duals, useWarmStart);
   State state(initialValues, duals, workingSet, false, 0);
+  state.factorization = factorize(workingSet, initialValues);
+
+  /// main loop of the solver
+  while (!state.converged) state = iterate(state);
+
+  return std::make_pair(state.values, state.duals);
+}
+
+//******************************************************************************
+Template boost::optional<InequalityFactorGraph> This::identifyWorkingSet(
+    const VectorValues& x, const KeySet& activeKeys) const {
+  for (const LinearEquality::shared_ptr& factor : problem_.equalities)
+    if (factor->unweighted_error(x).lpNorm<Eigen::Infinity>() > 1e-7)
+      return boost::none;
+  InequalityFactorGraph workingSet;
+  for (const LinearInequality::shared_ptr& factor : problem_.inequalities) {
+    LinearInequality::shared_ptr workingFactor(new LinearInequality(*factor));
+    double error = workingFactor->error(x);
+    if (error > 1e-7) return boost::none;
+    if (activeKeys.count(workingFactor->dualKey()) || std::abs(error) < 1e-7)
+      workingFactor->activate();
+    else
+      workingFactor->inactivate();
+    workingSet.push_back(workingFactor);
+  }
+  return workingSet;
+}
+
+//******************************************************************************
+Template std::pair<VectorValues, VectorValues> This::optimize(
+    const VectorValues& initialValues, const KeySet& initialWorkingSet) const {
+  // Minimize subject to the given working set, and start there if feasible
+  InequalityFactorGraph candidates;
+  for (const LinearInequality::shared_ptr& factor : problem_.inequalities) {
+    LinearInequality::shared_ptr workingFactor(new LinearInequality(*factor));
+    if (initialWorkingSet.count(workingFactor->dualKey()))
+      workingFactor->activate();
+    else
+      workingFactor->inactivate();
+    candidates.push_back(workingFactor);
+  }
+  // The cost, e.g. the proximal one of LPs, may be built around the initial
+  // values, so variables missing from them are taken to be zero
+  VectorValues x0 = initialValues;
+  internal::insertZeros(problem_.cost, &x0);
+  internal::insertZeros(problem_.equalities, &x0);
+  internal::insertZeros(problem_.inequalities, &x0);
+  State state;
+  state.factorization = factorize(candidates, x0);
+  bool started = false;
+  try {
+    VectorValues values;
+    if (state.factorization && state.factorization->complete())
+      values = state.factorization->solve(
+          POLICY::buildCostFunction(problem_, x0), x0);
+    else
+      values = buildWorkingGraph(candidates, x0).optimize();
+    if (boost::optional<InequalityFactorGraph> workingSet =
+            identifyWorkingSet(values, initialWorkingSet)) {
+      state.values = values;
+      state.workingSet = *workingSet;
+      started = true;
+    }
+  } catch (const IndeterminantLinearSystemException&) {
+    // The working set does not determine a minimum
+  }
+
+  if (started) {
+    // Constraints found active at the minimum join the factored candidates
+    if (state.factorization)
+      for (const LinearInequality::shared_ptr& factor : state.workingSet)
+        if (factor->active() && !initialWorkingSet.count(factor->dualKey()))
+          state.factorization->add(*factor, factor->dualKey());
+  } else {
+    // Otherwise start from the initial values, or from scratch
+    boost::optional<InequalityFactorGraph> workingSet;
+    if (initialValues.size() > 0)
+      workingSet = identifyWorkingSet(x0, KeySet());
+    if (!workingSet) return optimize();
+    state.values = x0;
+    state.workingSet = *workingSet;
+    state.factorization = factorize(state.workingSet, state.values);
+  }
 
   /// main loop of the solver
   while (!state.converged) state = iterate(state);
@@ -20,6 +20,8 @@
 
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam_unstable/linear/InequalityFactorGraph.h>
+#include <gtsam_unstable/linear/WorkingSetFactorization.h>
+#include <boost/optional.hpp>
 #include <boost/range/adaptor/map.hpp>
 
 namespace gtsam {
@@ -45,6 +47,8 @@ public:
     bool converged;     //!< True if the algorithm has converged to a solution
     size_t iterations;  /*!< Number of iterations. Incremented at the end of
                         each iteration. */
+    /// Factorization of the working set, kept up to date by iterate() if given
+    WorkingSetFactorization::shared_ptr factorization;
 
     /// Default constructor
     State()
@@ -98,6 +102,25 @@ public:
    */
   std::pair<VectorValues, VectorValues> optimize() const;
 
+  /**
+   * Warm start from the solution of a similar problem, e.g., the previous one
+   * in a sequence of problems that differ by small changes of the cost or of
+   * the right-hand sides, as in model predictive control.
+   *
+   * The constraints with dual keys in @p initialWorkingSet, e.g., those of
+   * the duals returned for the previous problem, are tried as working set
+   * first: if the minimum subject to them is feasible, the solver starts there.
+   * Otherwise it starts from @p initialValues, if feasible, with those of the
+   * constraints that are active there, and only as a last resort from the
+   * initial solver. Pass empty values to skip the second attempt: variables
+   * missing from @p initialValues are taken to be zero, also where the cost is
+   * built around them, as the proximal cost of LP is.
+   * @return a pair of <primal, dual> solutions
+   */
+  std::pair<VectorValues, VectorValues> optimize(
+      const VectorValues& initialValues,
+      const KeySet& initialWorkingSet) const;
+
 protected:
   /**
    * Compute minimum step size alpha to move from the current point @p xk to the
@@ -168,6 +191,14 @@ public: /// Just for testing...
       const InequalityFactorGraph& workingSet,
       const VectorValues& xk = VectorValues()) const;
 
+  /**
+   * Factor the working graph for the cost at xk, as long as its quadratic part
+   * is positive definite. Returns null otherwise, in which case iterate()
+   * eliminates the working graph from scratch.
+   */
+  WorkingSetFactorization::shared_ptr factorize(
+      const InequalityFactorGraph& workingSet, const VectorValues& xk) const;
+
   /// Iterate 1 step, return a new state with a new workingSet and values
   State iterate(const State& state) const;
 
@@ -178,6 +209,13 @@ public: /// Just for testing...
       const VectorValues& duals = VectorValues(),
       bool useWarmStart = false) const;
 
+  /**
+   * Working set at a point x, with the inequality constraints in @p activeKeys
+   * or active at x activated, or none if x is not feasible.
+   */
+  boost::optional<InequalityFactorGraph> identifyWorkingSet(
+      const VectorValues& x, const KeySet& activeKeys) const;
+
   /// Identifies active constraints that shouldn't be active anymore.
   int identifyLeavingConstraint(const InequalityFactorGraph& workingSet,
       const VectorValues& lambdas) const;
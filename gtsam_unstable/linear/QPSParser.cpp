@@ -15,507 +15,464 @@
  * @date     3/5/16
  */
 
-#define BOOST_SPIRIT_USE_PHOENIX_V3 1
-
-#include <gtsam/base/Matrix.h>
-#include <gtsam/inference/Key.h>
+#include <gtsam/base/MappedFile.h>
+#include <gtsam/base/SymmetricBlockMatrix.h>
 #include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/HessianFactor.h>
 #include <gtsam_unstable/linear/QP.h>
 #include <gtsam_unstable/linear/QPSParser.h>
 #include <gtsam_unstable/linear/QPSParserException.h>
 
-#include <boost/fusion/include/vector.hpp>
-#include <boost/fusion/sequence.hpp>
-#include <boost/lambda/lambda.hpp>
-#include <boost/phoenix/bind.hpp>
-#include <boost/spirit/include/classic.hpp>
-#include <boost/spirit/include/qi.hpp>
+#include <boost/filesystem.hpp>
 
 #include <algorithm>
-#include <iostream>
-#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
-using boost::fusion::at_c;
 using namespace std;
 
-namespace bf = boost::fusion;
-namespace qi = boost::spirit::qi;
+namespace gtsam {
 
-using Chars = std::vector<char>;
+namespace {
 
-// Get a string from a fusion vector of Chars
-template <size_t I, class FusionVector>
-static string fromChars(const FusionVector &vars) {
-  const Chars &chars = at_c<I>(vars);
-  return string(chars.begin(), chars.end());
-}
+const double kInfinity = numeric_limits<double>::infinity();
 
-namespace gtsam {
+// Indices of the rows that are not constraints: the objective, i.e., the first
+// row of type N, and the other rows of type N, which are ignored
+const size_t kObjective = numeric_limits<size_t>::max();
+const size_t kFreeRow = kObjective - 1;
+
+// Most fields on a line, in the RHS and RANGES sections
+const size_t kMaxFields = 5;
+
+bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// A field of a line, pointing into the file
+struct Field {
+  const char *begin, *end;
+  size_t size() const { return end - begin; }
+  string str() const { return string(begin, end); }
+  bool operator==(const char *s) const {
+    return strlen(s) == size() && memcmp(s, begin, size()) == 0;
+  }
+  bool operator==(const string &s) const {
+    return s.size() == size() && memcmp(s.data(), begin, size()) == 0;
+  }
+};
+
+// A constraint row, with its terms in the order of the columns
+struct Row {
+  char type;  // E, G or L
+  double rhs = 0.0, range = 0.0;
+  bool hasRange = false;
+  vector<pair<Key, Matrix11>> terms;
+};
+
+// Bounds of a variable, which is non-negative unless given otherwise
+struct Bounds {
+  double lower = 0.0, upper = kInfinity;
+};
 
 /**
- * As the parser reads a file, it call functions in this visitor. This visitor
- * in turn stores what the parser has read in a way that can be later used to
- * build the full QP problem in the file.
+ * Reads a QPS file in a single pass over its lines, without copying them.
+ * Rows and columns are numbered as they are declared, and the entries of the
+ * COLUMNS section go straight into their rows, so the factors are built from
+ * storage that already has the right size.
  */
-class QPSVisitor {
+class QPSReader {
+ public:
+  explicit QPSReader(const string &fileName) : fileName_(fileName) {}
+
+  QP read();
+
  private:
-  typedef std::unordered_map<Key, Matrix11> coefficient_v;
-  typedef std::unordered_map<std::string, coefficient_v> constraint_v;
-
-  std::unordered_map<std::string, constraint_v *>
-      row_to_constraint_v;  // Maps QPS ROWS to Variable-Matrix pairs
-  constraint_v E;           // Equalities
-  constraint_v IG;          // Inequalities >=
-  constraint_v IL;          // Inequalities <=
-  unsigned int numVariables;
-  std::unordered_map<std::string, double>
-      b;  // maps from constraint name to b value for Ax = b equality
-          // constraints
-  std::unordered_map<std::string, double>
-      ranges;  // Inequalities can be specified as ranges on a variable
-  std::unordered_map<Key, Vector1> g;  // linear term of quadratic cost
-  std::unordered_map<std::string, Key>
-      varname_to_key;  // Variable QPS string name to key
-  std::unordered_map<Key, std::unordered_map<Key, Matrix11>>
-      H;                 // H from hessian
-  double f;              // Constant term of quadratic cost
-  std::string obj_name;  // the objective function has a name in the QPS
-  std::string name_;     // the quadratic program has a name in the QPS
-  std::unordered_map<Key, double>
-      up;  // Upper Bound constraints on variable where X < MAX
-  std::unordered_map<Key, double>
-      lo;  // Lower Bound constraints on variable where MIN < X
-  std::unordered_map<Key, double>
-      fx;          // Equalities specified as FX in BOUNDS part of QPS
-  KeyVector free;  // Variables can be specified as free (to which no
-                   // constraints apply)
-  const bool debug = false;
+  enum class Section { NONE, ROWS, COLUMNS, RHS, RANGES, BOUNDS, QUADOBJ };
+
+  void readHeader(const Field &keyword);
+  void readRow(const Field *fields, size_t nrFields);
+  void readColumn(const Field *fields, size_t nrFields);
+  void readRhsOrRange(const Field *fields, size_t nrFields);
+  void readBound(const Field *fields, size_t nrFields);
+  void readQuadTerm(const Field *fields, size_t nrFields);
+  QP makeQP() const;
+
+  size_t row(const Field &name) const;
+  size_t column(const Field &name) const;
+  double number(const Field &field) const;
+  [[noreturn]] void fail(const string &reason) const;
+
+  const string fileName_;
+  size_t lineNumber_ = 0;
+  const char *line_ = nullptr, *eol_ = nullptr;
+  Section section_ = Section::NONE;
+  bool ended_ = false;
+
+  unordered_map<string, size_t> rowIndices_;
+  vector<Row> rows_;
+  bool hasObjective_ = false;
+
+  unordered_map<string, size_t> columnIndices_;
+  string currentColumn_;  // name of the last column read
+  vector<Bounds> bounds_;
+  vector<double> g_;  // linear term of the cost
+  double f_ = 0.0;    // constant term of the cost
+  vector<tuple<size_t, size_t, double>> quadTerms_;
+};
 
- public:
-  QPSVisitor() : numVariables(1) {}
+/* ************************************************************************* */
+void QPSReader::fail(const string &reason) const {
+  throw QPSParserException(fileName_ + ":" + to_string(lineNumber_) + ": " +
+                           reason + " in \"" + string(line_, eol_) + "\"");
+}
 
-  void setName(boost::fusion::vector<Chars, Chars, Chars> const &name) {
-    name_ = fromChars<1>(name);
-    if (debug) {
-      cout << "Parsing file: " << name_ << endl;
-    }
-  }
+/* ************************************************************************* */
+size_t QPSReader::row(const Field &name) const {
+  auto it = rowIndices_.find(name.str());
+  if (it == rowIndices_.end()) fail("unknown row " + name.str());
+  return it->second;
+}
 
-  void addColumn(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars,
-                                       double, Chars> const &vars) {
-    string var_ = fromChars<1>(vars);
-    string row_ = fromChars<3>(vars);
-    Matrix11 coefficient = at_c<5>(vars) * I_1x1;
-    if (debug) {
-      cout << "Added Column for Var: " << var_ << " Row: " << row_
-           << " Coefficient: " << coefficient << endl;
-    }
-    if (!varname_to_key.count(var_))
-      varname_to_key[var_] = Symbol('X', numVariables++);
-    if (row_ == obj_name) {
-      g[varname_to_key[var_]] = coefficient;
-      return;
-    }
-    (*row_to_constraint_v[row_])[row_][varname_to_key[var_]] = coefficient;
-  }
+/* ************************************************************************* */
+size_t QPSReader::column(const Field &name) const {
+  auto it = columnIndices_.find(name.str());
+  if (it == columnIndices_.end()) fail("unknown column " + name.str());
+  return it->second;
+}
 
-  void addColumnDouble(
-      boost::fusion::vector<Chars, Chars, Chars, Chars, double, Chars, Chars,
-                            Chars, double> const &vars) {
-    string var_ = fromChars<0>(vars);
-    string row1_ = fromChars<2>(vars);
-    string row2_ = fromChars<6>(vars);
-    Matrix11 coefficient1 = at_c<4>(vars) * I_1x1;
-    Matrix11 coefficient2 = at_c<8>(vars) * I_1x1;
-    if (!varname_to_key.count(var_))
-      varname_to_key.insert({var_, Symbol('X', numVariables++)});
-    if (row1_ == obj_name)
-      g[varname_to_key[var_]] = coefficient1;
-    else
-      (*row_to_constraint_v[row1_])[row1_][varname_to_key[var_]] = coefficient1;
-    if (row2_ == obj_name)
-      g[varname_to_key[var_]] = coefficient2;
-    else
-      (*row_to_constraint_v[row2_])[row2_][varname_to_key[var_]] = coefficient2;
+/* ************************************************************************* */
+double QPSReader::number(const Field &field) const {
+  // strtod needs a null-terminated copy of the field
+  char buffer[64];
+  const size_t length = field.size();
+  if (length >= sizeof(buffer)) fail("number too long");
+  memcpy(buffer, field.begin, length);
+  buffer[length] = '\0';
+  char *end;
+  const double x = strtod(buffer, &end);
+  if (end != buffer + length) fail("malformed number " + field.str());
+  return x;
+}
+
+/* ************************************************************************* */
+void QPSReader::readHeader(const Field &keyword) {
+  if (keyword == "NAME")
+    section_ = Section::NONE;
+  else if (keyword == "ROWS")
+    section_ = Section::ROWS;
+  else if (keyword == "COLUMNS")
+    section_ = Section::COLUMNS;
+  else if (keyword == "RHS")
+    section_ = Section::RHS;
+  else if (keyword == "RANGES")
+    section_ = Section::RANGES;
+  else if (keyword == "BOUNDS")
+    section_ = Section::BOUNDS;
+  else if (keyword == "QUADOBJ")
+    section_ = Section::QUADOBJ;
+  else if (keyword == "ENDATA")
+    ended_ = true;
+  else
+    fail("unsupported section " + keyword.str());
+}
+
+/* ************************************************************************* */
+void QPSReader::readRow(const Field *fields, size_t nrFields) {
+  if (nrFields != 2 || fields[0].size() != 1) fail("malformed row");
+  const char type = *fields[0].begin;
+  size_t index;
+  if (type == 'N') {
+    index = hasObjective_ ? kFreeRow : kObjective;
+    hasObjective_ = true;
+  } else if (type == 'E' || type == 'G' || type == 'L') {
+    index = rows_.size();
+    rows_.emplace_back();
+    rows_.back().type = type;
+  } else {
+    fail("invalid row type");
   }
+  if (!rowIndices_.emplace(fields[1].str(), index).second)
+    fail("duplicate row " + fields[1].str());
+}
 
-  void addRangeSingle(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars,
-                                            double, Chars> const &vars) {
-    string var_ = fromChars<1>(vars);
-    string row_ = fromChars<3>(vars);
-    double range = at_c<5>(vars);
-    ranges[row_] = range;
-    if (debug) {
-      cout << "SINGLE RANGE ADDED" << endl;
-      cout << "VAR:" << var_ << " ROW: " << row_ << " RANGE: " << range << endl;
-    }
+/* ************************************************************************* */
+void QPSReader::readColumn(const Field *fields, size_t nrFields) {
+  if (nrFields != 3 && nrFields != 5) fail("malformed column entry");
+  if (!(fields[0] == currentColumn_)) {
+    currentColumn_ = fields[0].str();
+    if (!columnIndices_.emplace(currentColumn_, bounds_.size()).second)
+      fail("entries of column " + currentColumn_ + " are not contiguous");
+    bounds_.emplace_back();
+    g_.push_back(0.0);
   }
-  void addRangeDouble(
-      boost::fusion::vector<Chars, Chars, Chars, Chars, Chars, double, Chars,
-                            Chars, Chars, double> const &vars) {
-    string var_ = fromChars<1>(vars);
-    string row1_ = fromChars<3>(vars);
-    string row2_ = fromChars<7>(vars);
-    double range1 = at_c<5>(vars);
-    double range2 = at_c<9>(vars);
-    ranges[row1_] = range1;
-    ranges[row2_] = range2;
-    if (debug) {
-      cout << "DOUBLE RANGE ADDED" << endl;
-      cout << "VAR: " << var_ << " ROW1: " << row1_ << " RANGE1: " << range1
-           << " ROW2: " << row2_ << " RANGE2: " << range2 << endl;
+  const size_t j = bounds_.size() - 1;
+  const Key key = Symbol('X', j + 1);
+  for (size_t k = 1; k < nrFields; k += 2) {
+    const size_t i = row(fields[k]);
+    const double value = number(fields[k + 1]);
+    if (i == kObjective) {
+      g_[j] = value;
+    } else if (i != kFreeRow) {
+      vector<pair<Key, Matrix11>> &terms = rows_[i].terms;
+      if (!terms.empty() && terms.back().first == key)
+        terms.back().second(0, 0) = value;
+      else
+        terms.emplace_back(key, value * I_1x1);
     }
   }
+}
 
-  void addRHS(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars, double,
-                                    Chars> const &vars) {
-    string var_ = fromChars<1>(vars);
-    string row_ = fromChars<3>(vars);
-    double coefficient = at_c<5>(vars);
-    if (row_ == obj_name)
-      f = -coefficient;
-    else
-      b[row_] = coefficient;
-
-    if (debug) {
-      cout << "Added RHS for Var: " << var_ << " Row: " << row_
-           << " Coefficient: " << coefficient << endl;
+/* ************************************************************************* */
+void QPSReader::readRhsOrRange(const Field *fields, size_t nrFields) {
+  // The name of the vector is optional
+  if (nrFields < 2 || nrFields > 5) fail("malformed entry");
+  for (size_t k = nrFields % 2; k < nrFields; k += 2) {
+    const size_t i = row(fields[k]);
+    const double value = number(fields[k + 1]);
+    if (section_ == Section::RHS) {
+      if (i == kObjective)
+        f_ = -value;
+      else if (i != kFreeRow)
+        rows_[i].rhs = value;
+    } else if (i < rows_.size()) {
+      rows_[i].range = value;
+      rows_[i].hasRange = true;
     }
   }
+}
 
-  void addRHSDouble(
-      boost::fusion::vector<Chars, Chars, Chars, Chars, Chars, double, Chars,
-                            Chars, Chars, double> const &vars) {
-    string var_ = fromChars<1>(vars);
-    string row1_ = fromChars<3>(vars);
-    string row2_ = fromChars<7>(vars);
-    double coefficient1 = at_c<5>(vars);
-    double coefficient2 = at_c<9>(vars);
-    if (row1_ == obj_name)
-      f = -coefficient1;
-    else
-      b[row1_] = coefficient1;
+/* ************************************************************************* */
+void QPSReader::readBound(const Field *fields, size_t nrFields) {
+  // Type, optional name of the bound vector, column, and value if any
+  if (nrFields < 2) fail("malformed bound");
+  const Field &type = fields[0];
+  const bool hasValue = !(type == "FR" || type == "MI" || type == "PL");
+  const size_t n = hasValue ? 4 : 3;
+  if (nrFields != n && nrFields != n - 1) fail("malformed bound");
+  Bounds &bounds = bounds_[column(fields[nrFields - (hasValue ? 2 : 1)])];
+  const double value = hasValue ? number(fields[nrFields - 1]) : 0.0;
+  // By convention, a negative upper bound on a variable without a lower bound
+  // leaves it unbounded below rather than infeasible
+  if (type == "UP") {
+    bounds.upper = value;
+    if (value < 0 && bounds.lower == 0.0) bounds.lower = -kInfinity;
+  }
+  else if (type == "LO")
+    bounds.lower = value;
+  else if (type == "FX")
+    bounds.lower = bounds.upper = value;
+  else if (type == "FR")
+    bounds.lower = -kInfinity, bounds.upper = kInfinity;
+  else if (type == "MI")
+    bounds.lower = -kInfinity;
+  else if (type == "PL")
+    bounds.upper = kInfinity;
+  else
+    fail("unsupported bound type " + type.str());
+}
 
-    if (row2_ == obj_name)
-      f = -coefficient2;
-    else
-      b[row2_] = coefficient2;
+/* ************************************************************************* */
+void QPSReader::readQuadTerm(const Field *fields, size_t nrFields) {
+  if (nrFields != 3) fail("malformed quadratic term");
+  quadTerms_.emplace_back(column(fields[0]), column(fields[1]),
+                          number(fields[2]));
+}
 
-    if (debug) {
-      cout << "Added RHS for Var: " << var_ << " Row: " << row1_
-           << " Coefficient: " << coefficient1 << endl;
-      cout << "                      "
-           << "Row: " << row2_ << " Coefficient: " << coefficient2 << endl;
-    }
+/* ************************************************************************* */
+QP QPSReader::read() {
+  std::unique_ptr<MappedFile> file;
+  try {
+    file.reset(new MappedFile(fileName_));
+  } catch (const std::runtime_error &) {
+    throw QPSParserException("can not open " + fileName_);
   }
 
-  void addRow(
-      boost::fusion::vector<Chars, char, Chars, Chars, Chars> const &vars) {
-    string name_ = fromChars<3>(vars);
-    char type = at_c<1>(vars);
-    switch (type) {
-      case 'N':
-        obj_name = name_;
+  Field fields[kMaxFields + 1];
+  const char *p = file->data(), *end = file->end();
+  while (p < end && !ended_) {
+    line_ = p;
+    eol_ = static_cast<const char *>(memchr(p, '\n', end - p));
+    if (!eol_) eol_ = end;
+    p = eol_ + 1;
+    ++lineNumber_;
+
+    // Split the line into fields, of which one too many means it is malformed
+    size_t nrFields = 0;
+    for (const char *q = line_; q < eol_ && nrFields <= kMaxFields;) {
+      while (q < eol_ && isBlank(*q)) ++q;
+      if (q == eol_) break;
+      fields[nrFields].begin = q;
+      while (q < eol_ && !isBlank(*q)) ++q;
+      fields[nrFields++].end = q;
+    }
+    if (nrFields == 0 || *line_ == '*') continue;  // blank line or comment
+    if (nrFields > kMaxFields) fail("too many fields");
+
+    // Section headers start in the first column, and entries do not
+    if (!isBlank(*line_)) {
+      readHeader(fields[0]);
+      continue;
+    }
+    switch (section_) {
+      case Section::ROWS:
+        readRow(fields, nrFields);
         break;
-      case 'L':
-        row_to_constraint_v[name_] = &IL;
+      case Section::COLUMNS:
+        readColumn(fields, nrFields);
         break;
-      case 'G':
-        row_to_constraint_v[name_] = &IG;
+      case Section::RHS:
+      case Section::RANGES:
+        readRhsOrRange(fields, nrFields);
         break;
-      case 'E':
-        row_to_constraint_v[name_] = &E;
+      case Section::BOUNDS:
+        readBound(fields, nrFields);
         break;
-      default:
-        cout << "invalid type: " << type << endl;
+      case Section::QUADOBJ:
+        readQuadTerm(fields, nrFields);
         break;
-    }
-    if (debug) {
-      cout << "Added Row Type: " << type << " Name: " << name_ << endl;
+      case Section::NONE:
+        fail("entry outside of a section");
     }
   }
+  if (!ended_) throw QPSParserException(fileName_ + ": missing ENDATA");
+  return makeQP();
+}
 
-  void addBound(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars, Chars,
-                                      Chars, double> const &vars) {
-    string type_ = fromChars<1>(vars);
-    string var_ = fromChars<5>(vars);
-    double number = at_c<7>(vars);
-    if (type_.compare(string("UP")) == 0)
-      up[varname_to_key[var_]] = number;
-    else if (type_.compare(string("LO")) == 0)
-      lo[varname_to_key[var_]] = number;
-    else if (type_.compare(string("FX")) == 0)
-      fx[varname_to_key[var_]] = number;
-    else
-      cout << "Invalid Bound Type: " << type_ << endl;
-
-    if (debug) {
-      cout << "Added Bound Type: " << type_ << " Var: " << var_
-           << " Amount: " << number << endl;
+/* ************************************************************************* */
+QP QPSReader::makeQP() const {
+  const size_t n = bounds_.size();
+  KeyVector keys(n);
+  for (size_t j = 0; j < n; ++j) keys[j] = Symbol('X', j + 1);
+
+  // The cost 0.5*x'Gx + g'x - rhs, as one Hessian factor per group of
+  // variables coupled in QUADOBJ, i.e., per connected component of G, so that
+  // separable problems do not get one dense n*n factor. Smaller pieces, e.g.,
+  // one factor per pair, would not be positive semi-definite on their own.
+  vector<size_t> root(n);
+  for (size_t j = 0; j < n; ++j) root[j] = j;
+  auto findRoot = [&root](size_t j) {
+    while (root[j] != j) j = root[j] = root[root[j]];
+    return j;
+  };
+  for (const auto &term : quadTerms_)
+    root[findRoot(get<0>(term))] = findRoot(get<1>(term));
+
+  // The components in the order of their first variables, and the position
+  // of every variable in its component
+  vector<KeyVector> components;
+  vector<size_t> component(n), position(n), index(n, n);
+  for (size_t j = 0; j < n; ++j) {
+    size_t &c = index[findRoot(j)];
+    if (c == n) {
+      c = components.size();
+      components.emplace_back();
     }
+    component[j] = c;
+    position[j] = components[c].size();
+    components[c].push_back(keys[j]);
   }
 
-  void addFreeBound(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars,
-                                          Chars, Chars> const &vars) {
-    string type_ = fromChars<1>(vars);
-    string var_ = fromChars<5>(vars);
-    free.push_back(varname_to_key[var_]);
-    if (debug) {
-      cout << "Added Free Bound Type: " << type_ << " Var: " << var_
-           << " Amount: " << endl;
-    }
+  // The information matrices are by far the largest part of the QP, so they
+  // are filled in place rather than copied
+  QP qp;
+  vector<boost::shared_ptr<HessianFactor>> costs;
+  for (const KeyVector &componentKeys : components) {
+    auto cost = boost::make_shared<HessianFactor>();
+    cost->keys() = componentKeys;
+    cost->info() =
+        SymmetricBlockMatrix(vector<size_t>(componentKeys.size(), 1), true);
+    cost->info().setZero();
+    costs.push_back(cost);
+    qp.cost.push_back(cost);
   }
-
-  void addQuadTerm(boost::fusion::vector<Chars, Chars, Chars, Chars, Chars,
-                                         double, Chars> const &vars) {
-    string var1_ = fromChars<1>(vars);
-    string var2_ = fromChars<3>(vars);
-    Matrix11 coefficient = at_c<5>(vars) * I_1x1;
-
-    H[varname_to_key[var1_]][varname_to_key[var2_]] = coefficient;
-    H[varname_to_key[var2_]][varname_to_key[var1_]] = coefficient;
-    if (debug) {
-      cout << "Added QuadTerm for Var: " << var1_ << " Row: " << var2_
-           << " Coefficient: " << coefficient << endl;
-    }
+  for (const auto &term : quadTerms_) {
+    const size_t i = min(get<0>(term), get<1>(term));
+    const size_t j = max(get<0>(term), get<1>(term));
+    SymmetricBlockMatrix &information = costs[component[i]]->info();
+    if (i == j)
+      information.setDiagonalBlock(position[i], get<2>(term) * I_1x1);
+    else
+      information.setOffDiagonalBlock(position[i], position[j],
+                                      get<2>(term) * I_1x1);
+  }
+  for (size_t j = 0; j < n; ++j) {
+    SymmetricBlockMatrix &information = costs[component[j]]->info();
+    information.setOffDiagonalBlock(position[j], information.nBlocks() - 1,
+                                    -g_[j] * I_1x1);
+  }
+  if (!costs.empty()) {
+    SymmetricBlockMatrix &information = costs.front()->info();
+    information.setDiagonalBlock(information.nBlocks() - 1, 2 * f_ * I_1x1);
   }
 
-  QP makeQP() {
-    // Create the keys from the variable names
-    KeyVector keys;
-    for (auto kv : varname_to_key) {
-      keys.push_back(kv.second);
-    }
-
-    // Fill the G matrices and g vectors from
-    vector<Matrix> Gs;
-    vector<Vector> gs;
-    sort(keys.begin(), keys.end());
-    for (size_t i = 0; i < keys.size(); ++i) {
-      for (size_t j = i; j < keys.size(); ++j) {
-        if (H.count(keys[i]) > 0 && H[keys[i]].count(keys[j]) > 0) {
-          Gs.emplace_back(H[keys[i]][keys[j]]);
-        } else {
-          Gs.emplace_back(Z_1x1);
-        }
-      }
+  // Every row is a constraint l <= a'x <= u, an equality if l == u. The
+  // inequality from the right-hand side comes before the one from the range,
+  // and the rows come by type, equalities first.
+  size_t dualKey = n + 1;
+  auto addInequality = [&](const Row &row, bool upper, double b) {
+    if (upper) {
+      qp.inequalities.emplace_shared<LinearInequality>(row.terms, b,
+                                                       dualKey++);
+    } else {
+      vector<pair<Key, Matrix11>> negated(row.terms);
+      for (auto &term : negated) term.second = -term.second;
+      qp.inequalities.emplace_shared<LinearInequality>(negated, -b,
+                                                       dualKey++);
     }
-    for (Key key1 : keys) {
-      if (g.count(key1) > 0) {
-        gs.emplace_back(-g[key1]);
+  };
+  for (const char type : {'E', 'G', 'L'}) {
+    for (const Row &row : rows_) {
+      if (row.type != type) continue;
+      const double range = row.hasRange ? row.range : 0.0;
+      if (type == 'E' && range == 0.0) {
+        qp.equalities.emplace_shared<LinearEquality>(
+            row.terms, row.rhs * I_1x1, dualKey++);
+      } else if (type == 'E') {
+        addInequality(row, false, min(row.rhs, row.rhs + range));
+        addInequality(row, true, max(row.rhs, row.rhs + range));
+      } else if (type == 'G') {
+        addInequality(row, false, row.rhs);
+        if (row.hasRange) addInequality(row, true, row.rhs + fabs(range));
       } else {
-        gs.emplace_back(Z_1x1);
-      }
-    }
-
-    // Construct the quadratic program
-    QP madeQP;
-    auto obj = HessianFactor(keys, Gs, gs, 2 * f);
-    madeQP.cost.push_back(obj);
-
-    // Add equality and inequality constraints into the QP
-    size_t dual_key_num = keys.size() + 1;
-    for (auto kv : E) {
-      map<Key, Matrix11> keyMatrixMapPos;
-      map<Key, Matrix11> keyMatrixMapNeg;
-      if (ranges.count(kv.first) == 1) {
-        for (auto km : kv.second) {
-          keyMatrixMapPos.insert(km);
-          km.second = -km.second;
-          keyMatrixMapNeg.insert(km);
-        }
-        if (ranges[kv.first] > 0) {
-          madeQP.inequalities.push_back(
-              LinearInequality(keyMatrixMapNeg, -b[kv.first], dual_key_num++));
-          madeQP.inequalities.push_back(LinearInequality(
-              keyMatrixMapPos, b[kv.first] + ranges[kv.first], dual_key_num++));
-        } else if (ranges[kv.first] < 0) {
-          madeQP.inequalities.push_back(
-              LinearInequality(keyMatrixMapPos, b[kv.first], dual_key_num++));
-          madeQP.inequalities.push_back(LinearInequality(
-              keyMatrixMapNeg, ranges[kv.first] - b[kv.first], dual_key_num++));
-        } else {
-          cerr << "ERROR: CANNOT ADD A RANGE OF ZERO" << endl;
-          throw;
-        }
-        continue;
-      }
-      map<Key, Matrix11> keyMatrixMap;
-      for (auto km : kv.second) {
-        keyMatrixMap.insert(km);
-      }
-      madeQP.equalities.push_back(
-          LinearEquality(keyMatrixMap, b[kv.first] * I_1x1, dual_key_num++));
-    }
-
-    for (auto kv : IG) {
-      map<Key, Matrix11> keyMatrixMapNeg;
-      map<Key, Matrix11> keyMatrixMapPos;
-      for (auto km : kv.second) {
-        keyMatrixMapPos.insert(km);
-        km.second = -km.second;
-        keyMatrixMapNeg.insert(km);
-      }
-      madeQP.inequalities.push_back(
-          LinearInequality(keyMatrixMapNeg, -b[kv.first], dual_key_num++));
-      if (ranges.count(kv.first) == 1) {
-        madeQP.inequalities.push_back(LinearInequality(
-            keyMatrixMapPos, b[kv.first] + ranges[kv.first], dual_key_num++));
-      }
-    }
-
-    for (auto kv : IL) {
-      map<Key, Matrix11> keyMatrixMapPos;
-      map<Key, Matrix11> keyMatrixMapNeg;
-      for (auto km : kv.second) {
-        keyMatrixMapPos.insert(km);
-        km.second = -km.second;
-        keyMatrixMapNeg.insert(km);
-      }
-      madeQP.inequalities.push_back(
-          LinearInequality(keyMatrixMapPos, b[kv.first], dual_key_num++));
-      if (ranges.count(kv.first) == 1) {
-        madeQP.inequalities.push_back(LinearInequality(
-            keyMatrixMapNeg, ranges[kv.first] - b[kv.first], dual_key_num++));
+        addInequality(row, true, row.rhs);
+        if (row.hasRange) addInequality(row, false, row.rhs - fabs(range));
       }
     }
-
-    for (Key k : keys) {
-      if (find(free.begin(), free.end(), k) != free.end()) continue;
-      if (fx.count(k) == 1)
-        madeQP.equalities.push_back(
-            LinearEquality(k, I_1x1, fx[k] * I_1x1, dual_key_num++));
-      if (up.count(k) == 1)
-        madeQP.inequalities.push_back(
-            LinearInequality(k, I_1x1, up[k], dual_key_num++));
-      if (lo.count(k) == 1)
-        madeQP.inequalities.push_back(
-            LinearInequality(k, -I_1x1, -lo[k], dual_key_num++));
-      else
-        madeQP.inequalities.push_back(
-            LinearInequality(k, -I_1x1, 0, dual_key_num++));
-    }
-    return madeQP;
   }
-};
 
-typedef qi::grammar<boost::spirit::basic_istream_iterator<char>> base_grammar;
-
-struct QPSParser::MPSGrammar : base_grammar {
-  typedef std::vector<char> Chars;
-  QPSVisitor *rqp_;
-  boost::function<void(bf::vector<Chars, Chars, Chars> const &)> setName;
-  boost::function<void(bf::vector<Chars, char, Chars, Chars, Chars> const &)>
-      addRow;
-  boost::function<void(
-      bf::vector<Chars, Chars, Chars, Chars, Chars, double, Chars> const &)>
-      rhsSingle;
-  boost::function<void(bf::vector<Chars, Chars, Chars, Chars, Chars, double,
-                                  Chars, Chars, Chars, double>)>
-      rhsDouble;
-  boost::function<void(
-      bf::vector<Chars, Chars, Chars, Chars, Chars, double, Chars> const &)>
-      rangeSingle;
-  boost::function<void(bf::vector<Chars, Chars, Chars, Chars, Chars, double,
-                                  Chars, Chars, Chars, double>)>
-      rangeDouble;
-  boost::function<void(
-      bf::vector<Chars, Chars, Chars, Chars, Chars, double, Chars>)>
-      colSingle;
-  boost::function<void(bf::vector<Chars, Chars, Chars, Chars, double, Chars,
-                                  Chars, Chars, double> const &)>
-      colDouble;
-  boost::function<void(
-      bf::vector<Chars, Chars, Chars, Chars, Chars, double, Chars> const &)>
-      addQuadTerm;
-  boost::function<void(bf::vector<Chars, Chars, Chars, Chars, Chars, Chars,
-                                  Chars, double> const &)>
-      addBound;
-  boost::function<void(
-      bf::vector<Chars, Chars, Chars, Chars, Chars, Chars, Chars> const &)>
-      addFreeBound;
-  MPSGrammar(QPSVisitor *rqp)
-      : base_grammar(start),
-        rqp_(rqp),
-        setName(boost::bind(&QPSVisitor::setName, rqp, ::_1)),
-        addRow(boost::bind(&QPSVisitor::addRow, rqp, ::_1)),
-        rhsSingle(boost::bind(&QPSVisitor::addRHS, rqp, ::_1)),
-        rhsDouble(boost::bind(&QPSVisitor::addRHSDouble, rqp, ::_1)),
-        rangeSingle(boost::bind(&QPSVisitor::addRangeSingle, rqp, ::_1)),
-        rangeDouble(boost::bind(&QPSVisitor::addRangeDouble, rqp, ::_1)),
-        colSingle(boost::bind(&QPSVisitor::addColumn, rqp, ::_1)),
-        colDouble(boost::bind(&QPSVisitor::addColumnDouble, rqp, ::_1)),
-        addQuadTerm(boost::bind(&QPSVisitor::addQuadTerm, rqp, ::_1)),
-        addBound(boost::bind(&QPSVisitor::addBound, rqp, ::_1)),
-        addFreeBound(boost::bind(&QPSVisitor::addFreeBound, rqp, ::_1)) {
-    using namespace boost::spirit;
-    using namespace boost::spirit::qi;
-    character = lexeme[alnum | '_' | '-' | '.'];
-    title = lexeme[character >> *(blank | character)];
-    word = lexeme[+character];
-    name = lexeme[lit("NAME") >> *blank >> title >> +space][setName];
-    row = lexeme[*blank >> character >> +blank >> word >> *blank][addRow];
-    rhs_single = lexeme[*blank >> word >> +blank >> word >> +blank >> double_ >>
-                        *blank][rhsSingle];
-    rhs_double =
-        lexeme[(*blank >> word >> +blank >> word >> +blank >> double_ >>
-                +blank >> word >> +blank >> double_)[rhsDouble] >>
-               *blank];
-    range_single = lexeme[*blank >> word >> +blank >> word >> +blank >>
-                          double_ >> *blank][rangeSingle];
-    range_double =
-        lexeme[(*blank >> word >> +blank >> word >> +blank >> double_ >>
-                +blank >> word >> +blank >> double_)[rangeDouble] >>
-               *blank];
-    col_single = lexeme[*blank >> word >> +blank >> word >> +blank >> double_ >>
-                        *blank][colSingle];
-    col_double =
-        lexeme[*blank >> (word >> +blank >> word >> +blank >> double_ >>
-                          +blank >> word >> +blank >> double_)[colDouble] >>
-               *blank];
-    quad_l = lexeme[*blank >> word >> +blank >> word >> +blank >> double_ >>
-                    *blank][addQuadTerm];
-    bound = lexeme[(*blank >> word >> +blank >> word >> +blank >> word >>
-                    +blank >> double_)[addBound] >>
-                   *blank];
-    bound_fr = lexeme[*blank >> word >> +blank >> word >> +blank >> word >>
-                      *blank][addFreeBound];
-    rows = lexeme[lit("ROWS") >> *blank >> eol >> +(row >> eol)];
-    rhs = lexeme[lit("RHS") >> *blank >> eol >>
-                 +((rhs_double | rhs_single) >> eol)];
-    cols = lexeme[lit("COLUMNS") >> *blank >> eol >>
-                  +((col_double | col_single) >> eol)];
-    quad = lexeme[lit("QUADOBJ") >> *blank >> eol >> +(quad_l >> eol)];
-    bounds = lexeme[lit("BOUNDS") >> +space >> *((bound | bound_fr) >> eol)];
-    ranges = lexeme[lit("RANGES") >> +space >>
-                    *((range_double | range_single) >> eol)];
-    end = lexeme[lit("ENDATA") >> *space];
-    start =
-        lexeme[name >> rows >> cols >> rhs >> -ranges >> bounds >> quad >> end];
+  for (size_t j = 0; j < n; ++j) {
+    const Bounds &bounds = bounds_[j];
+    if (bounds.lower == bounds.upper) {
+      qp.equalities.emplace_shared<LinearEquality>(
+          keys[j], I_1x1, bounds.lower * I_1x1, dualKey++);
+      continue;
+    }
+    if (bounds.upper < kInfinity)
+      qp.inequalities.emplace_shared<LinearInequality>(keys[j], I_1x1,
+                                                       bounds.upper, dualKey++);
+    if (bounds.lower > -kInfinity)
+      qp.inequalities.emplace_shared<LinearInequality>(
+          keys[j], -I_1x1, -bounds.lower, dualKey++);
   }
+  return qp;
+}
 
-  qi::rule<boost::spirit::basic_istream_iterator<char>, char()> character;
-  qi::rule<boost::spirit::basic_istream_iterator<char>, Chars()> word, title;
-  qi::rule<boost::spirit::basic_istream_iterator<char>> row, end, col_single,
-      col_double, rhs_single, rhs_double, range_single, range_double, ranges,
-      bound, bound_fr, bounds, quad, quad_l, rows, cols, rhs, name, start;
-};
+}  // namespace
 
-QP QPSParser::Parse() {
-  QPSVisitor rawData;
-  std::fstream stream(fileName_.c_str());
-  stream.unsetf(std::ios::skipws);
-  boost::spirit::basic_istream_iterator<char> begin(stream);
-  boost::spirit::basic_istream_iterator<char> last;
+/* ************************************************************************* */
+QPSParser::QPSParser(const std::string& fileName)
+    : fileName_(boost::filesystem::is_regular_file(fileName)
+                    ? fileName
+                    : findExampleDataFile(fileName)) {}
 
-  if (!parse(begin, last, MPSGrammar(&rawData)) || begin != last) {
-    throw QPSParserException();
-  }
-
-  return rawData.makeQP();
-}
+/* ************************************************************************* */
+QP QPSParser::Parse() { return QPSReader(fileName_).read(); }
 
 }  // namespace gtsam
@@ -19,22 +19,27 @@
 #pragma once
 
 #include <gtsam_unstable/linear/QP.h>
-#include <fstream>
+
+#include <string>
 
 namespace gtsam {
 
+/**
+ * Reads quadratic programs in the QPS format, the MPS format extended with a
+ * QUADOBJ section, as used by the Maros-Meszaros test set. The file is mapped
+ * into memory and read line by line in a single pass, and the variables are
+ * named X1, X2, ... in the order of the COLUMNS section.
+ */
 class QPSParser {
 
 private:
   std::string fileName_;
-  struct MPSGrammar;
 public:
 
-  QPSParser(const std::string& fileName) :
-      fileName_(findExampleDataFile(fileName)) {
-  }
+  /// Path of the file, or name of one in the example data directory
+  QPSParser(const std::string& fileName);
 
+  /// Read the file. Throws QPSParserException if it is malformed.
   QP Parse();
 };
 }
-
@@ -18,6 +18,10 @@
 
 #pragma once
 
+#include <gtsam/base/ThreadsafeException.h>
+
+#include <string>
+
 namespace gtsam {
 
 class QPSParserException: public ThreadsafeException<QPSParserException> {
@@ -25,6 +29,11 @@ public:
   QPSParserException() {
   }
 
+  /// With the reason, e.g., the offending line
+  explicit QPSParserException(const std::string& reason)
+      : description_("There is a problem parsing the QPS file: " + reason +
+                     "\n") {}
+
   virtual ~QPSParserException() noexcept {
   }
 
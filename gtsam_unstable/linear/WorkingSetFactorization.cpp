@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file     WorkingSetFactorization.cpp
+ * @brief    Factorization of the equality-constrained problems of the active
+ *           set method, updated as constraints enter and leave the working set
+ * @date     October 2026
+ */
+
+#include <gtsam_unstable/linear/WorkingSetFactorization.h>
+#include <gtsam/linear/GaussianBayesNet.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace gtsam {
+
+namespace {
+// A row whose squared distance to the span of the factored rows is less than
+// this fraction of its squared norm is considered linearly dependent
+const double kDependent = 1e-10;
+
+// Likewise, R is considered singular if the ratio of its smallest and largest
+// diagonal entries is below this
+const double kSingular = 1e-6;
+
+// Rank-one update LL' + vv' of the lower-triangular block of L starting at
+// (offset, offset), with Givens rotations
+void CholeskyUpdate(Matrix& L, size_t offset, Vector v) {
+  const size_t p = v.size();
+  for (size_t j = 0; j < p; ++j) {
+    const size_t jj = offset + j;
+    const double r = std::hypot(L(jj, jj), v(j));
+    const double c = r / L(jj, jj), s = v(j) / L(jj, jj);
+    L(jj, jj) = r;
+    for (size_t i = j + 1; i < p; ++i) {
+      const size_t ii = offset + i;
+      L(ii, jj) = (L(ii, jj) + s * v(i)) / c;
+      v(i) = c * v(i) - s * L(ii, jj);
+    }
+  }
+}
+}  // namespace
+
+/* ************************************************************************* */
+WorkingSetFactorization::WorkingSetFactorization(
+    const GaussianFactorGraph& cost, const VectorValues::Dims& dims)
+    : dims_(dims) {
+  // Only the quadratic part matters, so eliminate the Hessians
+  GaussianFactorGraph hessians;
+  for (const GaussianFactor::shared_ptr& factor : cost)
+    if (factor) hessians.emplace_shared<HessianFactor>(*factor);
+  const KeySet costKeys = hessians.keys();
+  for (const auto& key_dim : dims_)
+    if (!costKeys.count(key_dim.first))
+      throw IndeterminantLinearSystemException(key_dim.first);
+  const GaussianBayesNet::shared_ptr bayesNet =
+      hessians.eliminateSequential(EliminateCholesky);
+
+  // Cholesky only fails on clearly indefinite matrices, so also reject the
+  // nearly singular ones
+  double minDiagonal = std::numeric_limits<double>::infinity(), maxDiagonal = 0;
+  size_t n = 0;
+  for (const GaussianConditional::shared_ptr& conditional : *bayesNet) {
+    const Vector diagonal = conditional->R().diagonal().cwiseAbs();
+    minDiagonal = std::min(minDiagonal, diagonal.minCoeff());
+    maxDiagonal = std::max(maxDiagonal, diagonal.maxCoeff());
+    if (!(minDiagonal > kSingular * maxDiagonal))
+      throw IndeterminantLinearSystemException(conditional->firstFrontalKey());
+    for (auto it = conditional->beginFrontals();
+         it != conditional->endFrontals(); ++it) {
+      ordering_.push_back(*it);
+      offsets_[*it] = n;
+      dims_[*it] = conditional->getDim(it);
+      n += conditional->getDim(it);
+    }
+  }
+
+  // Every row and column of W is back-substituted through all of R, so gather
+  // R once into one sparse matrix rather than going through the Bayes net.
+  // The conditionals from Cholesky have unit sigmas, and the parents of each
+  // come later in the elimination order, so R is upper-triangular.
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const GaussianConditional::shared_ptr& conditional : *bayesNet) {
+    const size_t row = offsets_.at(conditional->firstFrontalKey());
+    const auto R = conditional->R();
+    for (DenseIndex j = 0; j < R.cols(); ++j)
+      for (DenseIndex i = 0; i <= j; ++i)
+        if (R(i, j) != 0.0) entries.emplace_back(row + i, row + j, R(i, j));
+    for (auto it = conditional->beginParents();
+         it != conditional->endParents(); ++it) {
+      const size_t col = offsets_.at(*it);
+      const auto S = conditional->getA(it);
+      for (DenseIndex j = 0; j < S.cols(); ++j)
+        for (DenseIndex i = 0; i < S.rows(); ++i)
+          if (S(i, j) != 0.0) entries.emplace_back(row + i, col + j, S(i, j));
+    }
+  }
+  R_.resize(n, n);
+  R_.setFromTriplets(entries.begin(), entries.end());
+}
+
+/* ************************************************************************* */
+WorkingSetFactorization::Rows WorkingSetFactorization::transform(
+    const JacobianFactor& constraint) const {
+  Rows rows;
+  for (size_t r = 0; r < constraint.rows(); ++r) {
+    // Row of C, on all variables
+    Vector a = Vector::Zero(R_.cols());
+    for (auto it = constraint.begin(); it != constraint.end(); ++it)
+      a.segment(offsets_.at(*it), constraint.getDim(it)) =
+          constraint.getA(it).row(r).transpose();
+
+    // and of W = CR^{-1}, i.e., R^{-T} times its transpose
+    Vector w = a;
+    R_.transpose().triangularView<Eigen::Lower>().solveInPlace(w);
+    rows.a.push_back(std::move(a));
+    rows.w.push_back(std::move(w));
+    rows.c.push_back(constraint.getb()(r));
+  }
+  return rows;
+}
+
+/* ************************************************************************* */
+Vector WorkingSetFactorization::flatten(const VectorValues& x) const {
+  Vector v = Vector::Zero(R_.cols());
+  for (const auto& key_value : x) {
+    auto it = offsets_.find(key_value.first);
+    if (it != offsets_.end())
+      v.segment(it->second, key_value.second.size()) = key_value.second;
+  }
+  return v;
+}
+
+/* ************************************************************************* */
+bool WorkingSetFactorization::append(const Rows& rows, Key dualKey) {
+  for (size_t r = 0; r < rows.w.size(); ++r) {
+    const Vector& w = rows.w[r];
+    const size_t m = rows_.size();
+
+    // Border L with the row l', delta, where Ll = Ww and l'l + delta^2 = w'w.
+    // Rather than from the difference, which cancels when w is close to the
+    // span of W, delta is the norm of the component of w orthogonal to it,
+    // projected out twice to be accurate.
+    Vector l = Vector::Zero(m), orthogonal = w;
+    for (size_t pass = 0; pass < 2 && m > 0; ++pass) {
+      Vector li(m);
+      for (size_t i = 0; i < m; ++i) li(i) = rows_[i].dot(orthogonal);
+      L_.triangularView<Eigen::Lower>().solveInPlace(li);
+      Vector coefficients = li;
+      L_.triangularView<Eigen::Lower>().transpose().solveInPlace(coefficients);
+      for (size_t i = 0; i < m; ++i) orthogonal -= coefficients(i) * rows_[i];
+      l += li;
+    }
+    const double sigma = w.squaredNorm();
+    const double delta2 = orthogonal.squaredNorm();
+    if (!(delta2 > kDependent * sigma)) {
+      // Take back the rows of this constraint appended so far
+      for (size_t i = 0; i < r; ++i) deleteRow(rows_.size() - 1);
+      return false;
+    }
+    L_.conservativeResize(m + 1, m + 1);
+    L_.row(m).head(m) = l.transpose();
+    L_.col(m).head(m).setZero();
+    L_(m, m) = std::sqrt(delta2);
+    rows_.push_back(w);
+    constraints_.push_back(rows.a[r]);
+    rhs_.push_back(rows.c[r]);
+    rowKeys_.push_back(dualKey);
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+void WorkingSetFactorization::deleteRow(size_t k) {
+  const size_t m = rows_.size(), p = m - k - 1;
+
+  // The entries below the diagonal in column k go into the trailing block
+  if (p > 0) CholeskyUpdate(L_, k + 1, L_.col(k).tail(p));
+  Matrix L = Matrix::Zero(m - 1, m - 1);
+  L.topLeftCorner(k, k) = L_.topLeftCorner(k, k);
+  L.bottomLeftCorner(p, k) = L_.bottomLeftCorner(p, k);
+  L.bottomRightCorner(p, p) = L_.bottomRightCorner(p, p);
+  L_.swap(L);
+
+  rows_.erase(rows_.begin() + k);
+  constraints_.erase(constraints_.begin() + k);
+  rhs_.erase(rhs_.begin() + k);
+  rowKeys_.erase(rowKeys_.begin() + k);
+}
+
+/* ************************************************************************* */
+bool WorkingSetFactorization::add(const JacobianFactor& constraint,
+                                  Key dualKey) {
+  Rows rows = transform(constraint);
+  if (append(rows, dualKey)) return true;
+  dependent_.emplace(dualKey, std::move(rows));
+  return false;
+}
+
+/* ************************************************************************* */
+void WorkingSetFactorization::remove(Key dualKey) {
+  if (dependent_.erase(dualKey)) return;
+  for (size_t k = rows_.size(); k-- > 0;)
+    if (rowKeys_[k] == dualKey) deleteRow(k);
+
+  // Constraints set aside may no longer depend on the factored ones
+  for (auto it = dependent_.begin(); it != dependent_.end();) {
+    if (append(it->second, it->first))
+      it = dependent_.erase(it);
+    else
+      ++it;
+  }
+}
+
+/* ************************************************************************* */
+VectorValues WorkingSetFactorization::solve(const GaussianFactorGraph& cost,
+                                            const VectorValues& x,
+                                            VectorValues* duals) const {
+  // The step p from x, with R'd = -(Gx + g)
+  VectorValues gradient = cost.gradientAtZero();
+  cost.multiplyHessianAdd(1.0, x, gradient);
+  Vector d = -flatten(gradient);
+  R_.transpose().triangularView<Eigen::Lower>().solveInPlace(d);
+
+  // WW'mu = Wd - (c - Cx), and R'p = d - W'mu. As WW' squares the condition
+  // number of W, one step of iterative refinement corrects mu for the residual
+  // of Wp = c - Cx, which recovers the accuracy of a QR factorization of W'.
+  const Vector x0 = flatten(x);
+  const size_t m = rows_.size();
+  Vector mu = Vector::Zero(m), residual(m);
+  for (size_t step = 0; step < 2 && m > 0; ++step) {
+    for (size_t i = 0; i < m; ++i)
+      residual(i) = rows_[i].dot(d) - rhs_[i] + constraints_[i].dot(x0);
+    L_.triangularView<Eigen::Lower>().solveInPlace(residual);
+    L_.triangularView<Eigen::Lower>().transpose().solveInPlace(residual);
+    for (size_t i = 0; i < m; ++i) d -= residual(i) * rows_[i];
+    mu += residual;
+  }
+
+  if (duals) {
+    *duals = VectorValues();
+    for (size_t i = 0; i < m;) {
+      size_t j = i;
+      while (j < m && rowKeys_[j] == rowKeys_[i]) ++j;
+      duals->insert(rowKeys_[i], -mu.segment(i, j - i));
+      i = j;
+    }
+  }
+  R_.triangularView<Eigen::Upper>().solveInPlace(d);
+  const Vector result = x0 + d;
+  VectorValues values;
+  for (const Key key : ordering_)
+    values.insert(key, result.segment(offsets_.at(key), dims_.at(key)));
+  return values;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file     WorkingSetFactorization.h
+ * @brief    Factorization of the equality-constrained problems of the active
+ *           set method, updated as constraints enter and leave the working set
+ * @date     October 2026
+ */
+#pragma once
+
+#include <gtsam_unstable/dllexport.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <Eigen/Sparse>
+
+#include <map>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Every iteration of the active set method minimizes the cost subject to the
+ * constraints in the working set, which only changes by one constraint from
+ * one iteration to the next. Rather than eliminating the whole problem again,
+ * this class factors the quadratic part of the cost, x'Gx with G = R'R, once,
+ * and keeps a factorization of the constraints up to date.
+ *
+ * With the working set Cx = c, the rows of W = CR^{-1} are kept, and the
+ * Cholesky factor L of WW'. The minimum of 0.5x'Gx + g'x subject to Cx = c is
+ * then x = R^{-1}(d - W'mu), with R'd = -g and WW'mu = Wd - c, and -mu are the
+ * Lagrange multipliers in the sign convention of ActiveSetSolver. solve()
+ * computes the step to the minimum from a given point in the same way.
+ *
+ * A constraint entering the working set costs one sparse back-substitution
+ * with R' for its row of W, and borders L with a new row. One leaving removes
+ * its row and column from L, which is a rank-one update of the trailing block.
+ * Constraints that depend linearly on those already factored are set aside,
+ * and the factorization is incomplete until they leave the working set again.
+ */
+class GTSAM_UNSTABLE_EXPORT WorkingSetFactorization {
+ public:
+  typedef boost::shared_ptr<WorkingSetFactorization> shared_ptr;
+
+  /**
+   * Factor the quadratic part of the cost on the variables with the given
+   * dimensions, which must include all constrained variables. Throws
+   * IndeterminantLinearSystemException if it is not positive definite, in
+   * which case this factorization does not apply.
+   */
+  WorkingSetFactorization(const GaussianFactorGraph& cost,
+                          const VectorValues::Dims& dims);
+
+  /**
+   * Add a constraint Ax = b to the working set, identified by its dual key.
+   * @return false if it depends linearly on the working set, in which case the
+   * factorization is incomplete until it is removed
+   */
+  bool add(const JacobianFactor& constraint, Key dualKey);
+
+  /** Remove the constraint with the given dual key from the working set */
+  void remove(Key dualKey);
+
+  /** Whether all constraints in the working set are factored */
+  bool complete() const { return dependent_.empty(); }
+
+  /** Number of constraint rows factored */
+  size_t rows() const { return rows_.size(); }
+
+  /** Dimensions of all variables */
+  const VectorValues::Dims& dims() const { return dims_; }
+
+  /**
+   * Minimize the given cost, whose quadratic part must be the one factored,
+   * subject to the working set, which must be complete. This computes the
+   * step from x, which need not satisfy the working set, and is much more
+   * accurate than the minimum itself when x does: at a vertex, e.g., it is
+   * zero up to the rounding errors of the constraints at x.
+   * @param x values of all variables
+   * @param duals if given, filled with the Lagrange multipliers
+   */
+  VectorValues solve(const GaussianFactorGraph& cost, const VectorValues& x,
+                     VectorValues* duals = nullptr) const;
+
+ private:
+  /// Rows of C and W and right-hand sides of one constraint
+  struct Rows {
+    std::vector<Vector> a, w;
+    std::vector<double> c;
+  };
+
+  /// Rows of W for the rows of a constraint
+  Rows transform(const JacobianFactor& constraint) const;
+
+  /// Values as a vector in elimination order, zero where missing
+  Vector flatten(const VectorValues& x) const;
+
+  /// Factor the rows of a constraint, unless they are linearly dependent
+  bool append(const Rows& rows, Key dualKey);
+
+  /// Remove row k from W and row and column k from L
+  void deleteRow(size_t k);
+
+  VectorValues::Dims dims_;            ///< of all variables
+  KeyVector ordering_;                 ///< elimination order
+  std::map<Key, size_t> offsets_;      ///< of the variables in ordering_
+  Eigen::SparseMatrix<double> R_;      ///< R, in elimination order
+
+  std::vector<Vector> rows_;         ///< the rows of W
+  std::vector<Vector> constraints_;  ///< the rows of C
+  std::vector<double> rhs_;          ///< c
+  std::vector<Key> rowKeys_;    ///< dual key of every row
+  Matrix L_;                    ///< Cholesky factor of WW'
+  std::map<Key, Rows> dependent_;  ///< constraints set aside
+};
+
+}  // namespace gtsam
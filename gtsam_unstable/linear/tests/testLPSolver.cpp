@@ -231,6 +231,63 @@ TEST(LPSolver, testWithoutInitialValues) {
   CHECK(assert_equal(expectedResult, result));
 }
 
+/* ************************************************************************* */
+TEST(LPSolver, warmStart) {
+  LP lp = simpleLP1();
+  LPSolver lpSolver(lp);
+  VectorValues expectedResult;
+  expectedResult.insert(1, Vector2(8. / 3., 2. / 3.));
+
+  // The vertex of the solution, from anywhere
+  VectorValues init, result, duals;
+  init.insert(1, Vector::Zero(2));
+  boost::tie(result, duals) = lpSolver.optimize(init, KeySet(KeyVector{3, 4}));
+  CHECK(assert_equal(expectedResult, result, 1e-10));
+  CHECK(duals.exists(3) && duals.exists(4));
+
+  // Another vertex, from which the solver moves on
+  boost::tie(result, duals) = lpSolver.optimize(init, KeySet(KeyVector{1, 2}));
+  CHECK(assert_equal(expectedResult, result, 1e-10));
+
+  // An infeasible vertex, x1 = 0 and -x1 + x2 = 1 and x1 + 2x2 = 4
+  boost::tie(result, duals) = lpSolver.optimize(init, KeySet(KeyVector{1, 3, 5}));
+  CHECK(assert_equal(expectedResult, result, 1e-10));
+
+  // Without initial values, which are then taken to be zero
+  boost::tie(result, duals) =
+      lpSolver.optimize(VectorValues(), KeySet(KeyVector{3, 4}));
+  CHECK(assert_equal(expectedResult, result, 1e-10));
+}
+
+/* ************************************************************************* */
+TEST(LPSolver, warmStartPartialValues) {
+  // simpleLP1 with x1 and x2 as separate variables
+  LP lp;
+  lp.cost = LinearCost(10, Vector1(-1.), 11, Vector1(-1.), 0.);
+  lp.inequalities.push_back(
+      LinearInequality(10, Vector1(-1), 11, Vector1(0), 0, 1));
+  lp.inequalities.push_back(
+      LinearInequality(10, Vector1(0), 11, Vector1(-1), 0, 2));
+  lp.inequalities.push_back(
+      LinearInequality(10, Vector1(1), 11, Vector1(2), 4, 3));
+  lp.inequalities.push_back(
+      LinearInequality(10, Vector1(4), 11, Vector1(2), 12, 4));
+  lp.inequalities.push_back(
+      LinearInequality(10, Vector1(-1), 11, Vector1(1), 1, 5));
+  LPSolver lpSolver(lp);
+  VectorValues expectedResult;
+  expectedResult.insert(10, Vector1(8. / 3.));
+  expectedResult.insert(11, Vector1(2. / 3.));
+
+  // An infeasible vertex, so the solver starts from the initial values, in
+  // which the missing x2 is taken to be zero
+  VectorValues init, result, duals;
+  init.insert(10, Vector1(0.));
+  boost::tie(result, duals) =
+      lpSolver.optimize(init, KeySet(KeyVector{1, 3, 5}));
+  CHECK(assert_equal(expectedResult, result, 1e-10));
+}
+
 /**
  * TODO: More TEST cases:
  * - Infeasible
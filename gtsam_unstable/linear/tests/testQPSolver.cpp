@@ -21,8 +21,14 @@
 #include <gtsam/inference/Symbol.h>
 #include <gtsam_unstable/linear/QPSolver.h>
 #include <gtsam_unstable/linear/QPSParser.h>
+#include <gtsam_unstable/linear/QPSParserException.h>
 #include <CppUnitLite/TestHarness.h>
 
+#include <boost/filesystem.hpp>
+
+#include <cstdio>
+#include <fstream>
+
 using namespace std;
 using namespace gtsam;
 using namespace gtsam::symbol_shorthand;
@@ -209,7 +215,7 @@ TEST(QPSolver, optimizeForst10book_pg171Ex5) {
   VectorValues expectedSolution;
   expectedSolution.insert(X(1), (Vector(1) << 1.5).finished());
   expectedSolution.insert(X(2), (Vector(1) << 0.5).finished());
-  CHECK(assert_equal(expectedSolution, solution, 1e-100));
+  CHECK(assert_equal(expectedSolution, solution, 1e-12));
 }
 
 pair<QP, QP> testParser(QPSParser parser) {
@@ -256,6 +262,138 @@ TEST(QPSolver, ParserSemanticTest) {
   CHECK(assert_equal(actualSolution, expectedSolution, 1e-7));
 }
 
+// A QPS file to parse in the temporary directory, removed when it goes out
+// of scope even if parsing throws
+struct TemporaryQPS {
+  const string fileName;
+  explicit TemporaryQPS(const string& contents)
+      : fileName((boost::filesystem::temp_directory_path() /
+                  boost::filesystem::unique_path("%%%%-%%%%-%%%%.QPS"))
+                     .string()) {
+    ofstream(fileName.c_str()) << contents;
+  }
+  ~TemporaryQPS() { remove(fileName.c_str()); }
+};
+
+TEST(QPSolver, ParserRangesAndBounds) {
+  const TemporaryQPS file(
+      "NAME          RANGES\n"
+      "ROWS\n"
+      " N  COST\n"
+      " E  E1\n"
+      " G  G1\n"
+      " L  L1\n"
+      "COLUMNS\n"
+      "    X         COST      1.0        E1        1.0\n"
+      "    X         G1        1.0\n"
+      "    Y         L1        1.0        E1        2.0\n"
+      "    Z         G1        -1.0\n"
+      "RHS\n"
+      "    RHS       E1        4.0        G1        1.0\n"
+      "    RHS       L1        2.0\n"
+      "RANGES\n"
+      "    RNG       E1        -2.0       G1        3.0\n"
+      "    RNG       L1        -1.0\n"
+      "BOUNDS\n"
+      " MI BND       X\n"
+      " UP BND       X         5.0\n"
+      " FR BND       Y\n"
+      " FX BND       Z         0.5\n"
+      "ENDATA\n");
+  QP actual = QPSParser(file.fileName).Parse();
+
+  // The variables are numbered in the order of the columns
+  const Key x(Symbol('X', 1)), y(Symbol('X', 2)), z(Symbol('X', 3));
+  EqualityFactorGraph equalities;
+  equalities.push_back(LinearEquality(z, I_1x1, 0.5 * kOne, 0));
+  EXPECT(assert_equal(equalities, actual.equalities, 1e-9));
+
+  // 2 <= x + 2y <= 4, 1 <= x - z <= 4, 1 <= y <= 2, and x <= 5
+  InequalityFactorGraph inequalities;
+  inequalities.push_back(LinearInequality(x, -I_1x1, y, -2 * I_1x1, -2, 0));
+  inequalities.push_back(LinearInequality(x, I_1x1, y, 2 * I_1x1, 4, 1));
+  inequalities.push_back(LinearInequality(x, -I_1x1, z, I_1x1, -1, 2));
+  inequalities.push_back(LinearInequality(x, I_1x1, z, -I_1x1, 4, 3));
+  inequalities.push_back(LinearInequality(y, I_1x1, 2, 4));
+  inequalities.push_back(LinearInequality(y, -I_1x1, -1, 5));
+  inequalities.push_back(LinearInequality(x, I_1x1, 5, 6));
+  EXPECT(assert_equal(inequalities, actual.inequalities, 1e-9));
+}
+
+TEST(QPSolver, ParserMalformed) {
+  const string header =
+      "NAME          MALFORMED\n"
+      "ROWS\n"
+      " N  COST\n"
+      " L  R1\n"
+      "COLUMNS\n";
+  // Unknown row, column entries that are not contiguous, and a missing ENDATA
+  for (const char* columns :
+       {"    X         R2        1.0\nENDATA\n",
+        "    X         R1        1.0\n    Y         R1        1.0\n"
+        "    X         COST      1.0\nENDATA\n",
+        "    X         R1        1.0\n"}) {
+    const TemporaryQPS file(header + columns);
+    CHECK_EXCEPTION(QPSParser(file.fileName).Parse(), QPSParserException);
+  }
+}
+
+TEST(QPSolver, ParserNegativeUpperBound) {
+  const TemporaryQPS file(
+      "NAME          NEGATIVE\n"
+      "ROWS\n"
+      " N  COST\n"
+      "COLUMNS\n"
+      "    X         COST      1.0\n"
+      "    Y         COST      1.0\n"
+      "BOUNDS\n"
+      " UP BND       X         -1.0\n"
+      " LO BND       Y         -3.0\n"
+      " UP BND       Y         -2.0\n"
+      "ENDATA\n");
+  QP actual = QPSParser(file.fileName).Parse();
+
+  // x <= -1 without a lower bound, but -3 <= y <= -2 as given
+  const Key x(Symbol('X', 1)), y(Symbol('X', 2));
+  InequalityFactorGraph inequalities;
+  inequalities.push_back(LinearInequality(x, I_1x1, -1, 0));
+  inequalities.push_back(LinearInequality(y, I_1x1, -2, 1));
+  inequalities.push_back(LinearInequality(y, -I_1x1, 3, 2));
+  EXPECT(assert_equal(inequalities, actual.inequalities, 1e-9));
+}
+
+TEST(QPSolver, ParserSparseCost) {
+  // A and B are coupled, C has a diagonal term only, and D a linear term only
+  const TemporaryQPS file(
+      "NAME          SPARSE\n"
+      "ROWS\n"
+      " N  COST\n"
+      "COLUMNS\n"
+      "    A         COST      1.0\n"
+      "    B         COST      -1.0\n"
+      "    C         COST      2.0\n"
+      "    D         COST      0.5\n"
+      "RHS\n"
+      "    RHS       COST      -3.0\n"
+      "QUADOBJ\n"
+      "    A         A         4.0\n"
+      "    A         B         -1.0\n"
+      "    B         B         4.0\n"
+      "    C         C         2.0\n"
+      "ENDATA\n");
+  QP actual = QPSParser(file.fileName).Parse();
+
+  // One factor per group of coupled variables, with the constant in the first
+  const Key a(Symbol('X', 1)), b(Symbol('X', 2)), c(Symbol('X', 3)),
+      d(Symbol('X', 4));
+  GaussianFactorGraph expected;
+  expected.push_back(HessianFactor(a, b, 4.0 * I_1x1, -1.0 * I_1x1,
+                                   -1.0 * kOne, 4.0 * I_1x1, kOne, 6.0));
+  expected.push_back(HessianFactor(c, 2.0 * I_1x1, -2.0 * kOne, 0.0));
+  expected.push_back(HessianFactor(d, Z_1x1, -0.5 * kOne, 0.0));
+  EXPECT(assert_equal(expected, actual.cost, 1e-9));
+}
+
 TEST(QPSolver, QPExampleTest){
   QP problem = QPSParser("QPExample.QPS").Parse();
   VectorValues actualSolution;
@@ -382,6 +520,40 @@ TEST(QPSolver, optimizeMatlabExNoinitials) {
   CHECK(assert_equal(expectedSolution, solution, 1e-7));
 }
 
+/* ************************************************************************* */
+TEST(QPSolver, warmStart) {
+  QP qp = createTestMatlabQPEx();
+  VectorValues solution, duals;
+  boost::tie(solution, duals) = QPSolver(qp).optimize();
+
+  // x1 + x2 <= 2 and -x1 + 2*x2 <= 2 are active at the solution
+  KeySet workingSet;
+  for (const auto& key_value : duals) workingSet.insert(key_value.first);
+  CHECK(workingSet == KeySet(KeyVector{0, 1}));
+
+  // Pull x2 up a little, as in a sequence of problems
+  QP next = qp;
+  next.cost = GaussianFactorGraph();
+  next.cost.push_back(
+      HessianFactor(X(1), X(2), 1.0 * I_1x1, -I_1x1, 2.0 * I_1x1, 2.0 * I_1x1,
+          6.5 * I_1x1, 1000.0));
+  VectorValues expected, actual;
+  boost::tie(expected, boost::tuples::ignore) = QPSolver(next).optimize();
+  boost::tie(actual, boost::tuples::ignore) =
+      QPSolver(next).optimize(solution, workingSet);
+  CHECK(assert_equal(expected, actual, 1e-7));
+
+  // A working set whose minimum is infeasible starts from the given values
+  boost::tie(actual, boost::tuples::ignore) =
+      QPSolver(next).optimize(solution, KeySet(KeyVector{2}));
+  CHECK(assert_equal(expected, actual, 1e-7));
+
+  // A dependent working set, without initial values, starts from scratch
+  boost::tie(actual, boost::tuples::ignore) =
+      QPSolver(next).optimize(VectorValues(), KeySet(KeyVector{0, 1, 2}));
+  CHECK(assert_equal(expected, actual, 1e-7));
+}
+
 /* ************************************************************************* */
 // Create test graph as in Nocedal06book, Ex 16.4, pg. 475
 QP createTestNocedal06bookEx16_4() {
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testWorkingSetFactorization.cpp
+ * @brief Test the factorization of the working set of the active set method
+ * @date October 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam_unstable/linear/LinearEquality.h>
+#include <gtsam_unstable/linear/WorkingSetFactorization.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+using namespace gtsam::symbol_shorthand;
+
+namespace {
+
+// 0.5*x1'x1 + 0.5*(x2-x1)'(x2-x1)*4 + 0.5*(x3-(1,2))'(x3-(1,2)) + 0.5*x3(0)^2
+GaussianFactorGraph cost() {
+  GaussianFactorGraph graph;
+  graph.emplace_shared<JacobianFactor>(X(1), I_2x2, Vector2(1, -1));
+  graph.emplace_shared<JacobianFactor>(X(1), -2 * I_2x2, X(2), 2 * I_2x2,
+                                       Vector2(0.5, 0));
+  graph.emplace_shared<JacobianFactor>(X(3), I_2x2, Vector2(1, 2));
+  graph.emplace_shared<HessianFactor>(X(3), Vector2(1, 0).asDiagonal(),
+                                      Z_2x1, 0.0);
+  return graph;
+}
+
+const VectorValues::Dims dims = {{X(1), 2}, {X(2), 2}, {X(3), 2}};
+
+// Where to start from
+VectorValues zero() {
+  VectorValues x;
+  for (const auto& key_dim : dims)
+    x.insert(key_dim.first, Vector::Zero(key_dim.second));
+  return x;
+}
+
+// x1(0) + x2(1) = 1, x2 - x3 = (0, 0.5), and 2*x1(0) + 2*x2(1) = 2
+const LinearEquality c0(X(1), (Matrix(1, 2) << 1, 0).finished(), X(2),
+                        (Matrix(1, 2) << 0, 1).finished(), Vector1(1), 10);
+const LinearEquality c1(X(2), I_2x2, X(3), -I_2x2, Vector2(0, 0.5), 11);
+const LinearEquality c2(X(1), (Matrix(1, 2) << 2, 0).finished(), X(2),
+                        (Matrix(1, 2) << 0, 2).finished(), Vector1(2), 12);
+
+// Minimum subject to the given constraints, from elimination
+VectorValues expected(const vector<LinearEquality>& constraints) {
+  GaussianFactorGraph graph = cost();
+  for (const LinearEquality& constraint : constraints)
+    graph.push_back(constraint);
+  return graph.optimize();
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+TEST(WorkingSetFactorization, unconstrained) {
+  WorkingSetFactorization factorization(cost(), dims);
+  EXPECT(factorization.complete());
+  EXPECT_LONGS_EQUAL(0, factorization.rows());
+  EXPECT(assert_equal(cost().optimize(), factorization.solve(cost(), zero()),
+                      1e-9));
+}
+
+/* ************************************************************************* */
+TEST(WorkingSetFactorization, addRemove) {
+  WorkingSetFactorization factorization(cost(), dims);
+  EXPECT(factorization.add(c0, c0.dualKey()));
+  EXPECT(factorization.add(c1, c1.dualKey()));
+  EXPECT_LONGS_EQUAL(3, factorization.rows());
+
+  VectorValues duals;
+  VectorValues actual = factorization.solve(cost(), zero(), &duals);
+  EXPECT(assert_equal(expected({c0, c1}), actual, 1e-9));
+
+  // From elsewhere, also off the constraints
+  VectorValues x = zero();
+  x[X(1)] << 3, -1;
+  x[X(3)] << 0.5, 2;
+  EXPECT(assert_equal(actual, factorization.solve(cost(), x), 1e-9));
+
+  // The multipliers balance the gradient of the cost: C'lambda = Gx + g
+  VectorValues lambdas = duals;
+  GaussianFactorGraph graph = cost();
+  VectorValues gradient = graph.gradient(actual);
+  VectorValues Ctlambda;
+  for (const auto& key_dim : dims)
+    Ctlambda.insert(key_dim.first, Vector::Zero(key_dim.second));
+  for (const LinearEquality* c : {&c0, &c1})
+    for (auto it = c->begin(); it != c->end(); ++it)
+      Ctlambda[*it] += c->getA(it).transpose() * lambdas.at(c->dualKey());
+  EXPECT(assert_equal(gradient, Ctlambda, 1e-9));
+
+  // Removing the first constraint, in front of the other
+  factorization.remove(c0.dualKey());
+  EXPECT_LONGS_EQUAL(2, factorization.rows());
+  EXPECT(assert_equal(expected({c1}), factorization.solve(cost(), zero()),
+                      1e-9));
+
+  factorization.remove(c1.dualKey());
+  EXPECT_LONGS_EQUAL(0, factorization.rows());
+  EXPECT(assert_equal(cost().optimize(), factorization.solve(cost(), zero()),
+                      1e-9));
+}
+
+/* ************************************************************************* */
+TEST(WorkingSetFactorization, dependent) {
+  WorkingSetFactorization factorization(cost(), dims);
+  EXPECT(factorization.add(c0, c0.dualKey()));
+  EXPECT(!factorization.add(c2, c2.dualKey()));
+  EXPECT(!factorization.complete());
+  EXPECT_LONGS_EQUAL(1, factorization.rows());
+
+  // Once c0 leaves, c2 takes its place
+  factorization.remove(c0.dualKey());
+  EXPECT(factorization.complete());
+  EXPECT_LONGS_EQUAL(1, factorization.rows());
+  VectorValues duals;
+  EXPECT(assert_equal(expected({c2}),
+                      factorization.solve(cost(), zero(), &duals), 1e-9));
+  EXPECT(duals.exists(c2.dualKey()));
+  EXPECT(!duals.exists(c0.dualKey()));
+
+  // Dependent constraints that leave are forgotten
+  EXPECT(!factorization.add(c0, c0.dualKey()));
+  factorization.remove(c0.dualKey());
+  EXPECT(factorization.complete());
+  EXPECT_LONGS_EQUAL(1, factorization.rows());
+}
+
+/* ************************************************************************* */
+TEST(WorkingSetFactorization, singular) {
+  // Nothing in the cost on x3(1)
+  GaussianFactorGraph singular;
+  singular.push_back(cost().at(0));
+  singular.push_back(cost().at(1));
+  singular.push_back(cost().at(3));
+  CHECK_EXCEPTION(WorkingSetFactorization(singular, dims),
+                  IndeterminantLinearSystemException);
+
+  // Nor on x3 at all
+  singular.remove(2);
+  CHECK_EXCEPTION(WorkingSetFactorization(singular, dims),
+                  IndeterminantLinearSystemException);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -59,8 +59,19 @@ FixedLagSmoother::Result BatchFixedLagSmoother::update(
   // Add the new variables to theta
   theta_.insert(newTheta);
   // Add new variables to the end of the ordering
-  for (const auto& key_value : newTheta) {
-    ordering_.push_back(key_value.key);
+  if (incremental_) {
+    // in timestamp order, so that the ordering stays a good one
+    KeyVector newKeys = newTheta.keys();
+    stable_sort(newKeys.begin(), newKeys.end(), [&timestamps](Key a, Key b) {
+      const auto ta = timestamps.find(a), tb = timestamps.find(b);
+      return ta != timestamps.end() &&
+             (tb == timestamps.end() || ta->second < tb->second);
+    });
+    ordering_.insert(ordering_.end(), newKeys.begin(), newKeys.end());
+  } else {
+    for (const auto& key_value : newTheta) {
+      ordering_.push_back(key_value.key);
+    }
   }
   // Augment Delta
   delta_.insert(newTheta.zeroVectors());
@@ -73,6 +84,8 @@ FixedLagSmoother::Result BatchFixedLagSmoother::update(
   for(const size_t i : factorsToRemove){
     if(factors_[i])
       factors_[i].reset();
+    if(incremental_ && i < linearFactors_.size())
+      linearFactors_[i].reset();
   }
 
   // Update the Timestamps associated with the factor keys
@@ -126,6 +139,11 @@ void BatchFixedLagSmoother::insertFactors(
     for(Key key: *factor) {
       factorIndex_[key].insert(index);
     }
+    // The factor needs to be linearized
+    if (incremental_) {
+      linearFactors_.resize(factors_.size());
+      linearFactors_[index].reset();
+    }
   }
 }
 
@@ -140,6 +158,7 @@ void BatchFixedLagSmoother::removeFactors(
       }
       // Remove the factor from the factor graph
       factors_.remove(slot);
+      if (incremental_) linearFactors_.remove(slot);
       // Add the factor's old slot to the list of available slots
       availableSlots_.push(slot);
     } else {
@@ -177,10 +196,38 @@ void BatchFixedLagSmoother::eraseKeys(const KeyVector& keys) {
 
 /* ************************************************************************* */
 void BatchFixedLagSmoother::reorder(const KeyVector& marginalizeKeys) {
+  if (incremental_) {
+    // Keep the ordering, but move the marginalize keys to the front
+    const KeySet marginalize(marginalizeKeys.begin(), marginalizeKeys.end());
+    stable_partition(ordering_.begin(), ordering_.end(),
+        [&marginalize](Key key) { return marginalize.count(key) > 0; });
+    return;
+  }
   // COLAMD groups will be used to place marginalize keys in Group 0, and everything else in Group 1
   ordering_ = Ordering::ColamdConstrainedFirst(factors_, marginalizeKeys);
 }
 
+/* ************************************************************************* */
+GaussianFactorGraph BatchFixedLagSmoother::linearize() {
+  if (!incremental_) return *factors_.linearize(theta_);
+  gttic(relinearize);
+  for (size_t slot = 0; slot < factors_.size(); ++slot) {
+    if (factors_[slot] && !linearFactors_[slot])
+      linearFactors_[slot] = factors_[slot]->linearize(theta_);
+  }
+  gttoc(relinearize);
+  return linearFactors_;
+}
+
+/* ************************************************************************* */
+void BatchFixedLagSmoother::invalidateLinearization(Key key) {
+  const auto it = factorIndex_.find(key);
+  if (it == factorIndex_.end()) return;
+  for (size_t slot : it->second) {
+    linearFactors_[slot].reset();
+  }
+}
+
 /* ************************************************************************* */
 FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
 
@@ -190,7 +237,7 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
   result.linearVariables = linearKeys_.size();
 
   // Set optimization parameters
-  double lambda = parameters_.lambdaInitial;
+  double lambda = incremental_ ? lambda_ : parameters_.lambdaInitial;
   double lambdaFactor = parameters_.lambdaFactor;
   double lambdaUpperBound = parameters_.lambdaUpperBound;
   double lambdaLowerBound = 1.0e-10;
@@ -218,7 +265,7 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
     gttic(optimizer_iteration);
     {
       // Linearize graph around the linearization point
-      GaussianFactorGraph linearFactorGraph = *factors_.linearize(theta_);
+      GaussianFactorGraph linearFactorGraph = linearize();
 
       // Keep increasing lambda until we make make progress
       while (true) {
@@ -260,15 +307,32 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
           // Keep this change
           // Update the error value
           result.error = error;
-          // Update the linearization point
-          theta_ = evalpoint;
-          // Reset the deltas to zeros
-          delta_.setZero();
-          // Put the linearization points and deltas back for specific variables
-          if (enforceConsistency_ && (linearKeys_.size() > 0)) {
-            theta_.update(linearKeys_);
-            for(const auto& key_value: linearKeys_) {
-              delta_.at(key_value.key) = newDelta.at(key_value.key);
+          if (incremental_) {
+            // Only move the linearization point of variables that changed
+            // enough, and of which the linearization point is not fixed
+            for (const auto& key_delta : newDelta) {
+              const Key key = key_delta.first;
+              Vector& delta = delta_.at(key);
+              if ((enforceConsistency_ && linearKeys_.exists(key)) ||
+                  key_delta.second.lpNorm<Eigen::Infinity>() < relinearizeThreshold_) {
+                delta = key_delta.second;
+              } else {
+                theta_.update(key, evalpoint.at(key));
+                delta.setZero();
+                invalidateLinearization(key);
+              }
+            }
+          } else {
+            // Update the linearization point
+            theta_ = evalpoint;
+            // Reset the deltas to zeros
+            delta_.setZero();
+            // Put the linearization points and deltas back for specific variables
+            if (enforceConsistency_ && (linearKeys_.size() > 0)) {
+              theta_.update(linearKeys_);
+              for(const auto& key_value: linearKeys_) {
+                delta_.at(key_value.key) = newDelta.at(key_value.key);
+              }
             }
           }
           // Decrease lambda for next time
@@ -300,6 +364,10 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
       && !checkConvergence(relativeErrorTol, absoluteErrorTol, errorTol,
           previousError, result.error, NonlinearOptimizerParams::SILENT));
 
+  // Carry the damping into the next update, but not above its initial value:
+  // after giving up with maximum lambda, the first steps of the next update
+  // would be so small that they pass the convergence check
+  lambda_ = std::min(lambda, parameters_.lambdaInitial);
   return result;
 }
 
@@ -312,11 +380,15 @@ void BatchFixedLagSmoother::marginalize(const KeyVector& marginalizeKeys) {
   // adds the linearized factors back in.
 
   // Identify all of the factors involving any marginalized variable. These must be removed.
+  // The factor index is kept up to date, so no need to build a VariableIndex
+  // over the whole window. Slots emptied by factorsToRemove may still be listed.
   set<size_t> removedFactorSlots;
-  const VariableIndex variableIndex(factors_);
   for(Key key: marginalizeKeys) {
-    const auto& slots = variableIndex[key];
-    removedFactorSlots.insert(slots.begin(), slots.end());
+    const auto it = factorIndex_.find(key);
+    if (it == factorIndex_.end()) continue;
+    for(size_t slot: it->second) {
+      if (factors_.at(slot)) removedFactorSlots.insert(slot);
+    }
   }
 
   // Add the removed factors to a factor graph
@@ -327,6 +399,27 @@ void BatchFixedLagSmoother::marginalize(const KeyVector& marginalizeKeys) {
     }
   }
 
+  // In incremental mode, theta_ may lag the estimate by up to the
+  // relinearization threshold. Move the variables of the removed factors to
+  // the estimate first, so that the marginal factors do not keep that lag.
+  if (incremental_) {
+    Values moved;
+    VectorValues movedDelta;
+    for (const auto& factor : removedFactors) {
+      for (Key key : *factor) {
+        if (moved.exists(key) || (enforceConsistency_ && linearKeys_.exists(key)))
+          continue;
+        moved.insert(key, theta_.at(key));
+        movedDelta.insert(key, delta_.at(key));
+      }
+    }
+    theta_.update(moved.retract(movedDelta));
+    for (const auto& key_delta : movedDelta) {
+      delta_.at(key_delta.first).setZero();
+      invalidateLinearization(key_delta.first);
+    }
+  }
+
   // Calculate marginal factors on the remaining keys
   NonlinearFactorGraph marginalFactors = CalculateMarginalFactors(
       removedFactors, theta_, marginalizeKeys, parameters_.getEliminationFunction());
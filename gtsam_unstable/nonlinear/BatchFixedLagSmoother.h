@@ -33,9 +33,17 @@ public:
   /// Typedef for a shared pointer to an Incremental Fixed-Lag Smoother
   typedef boost::shared_ptr<BatchFixedLagSmoother> shared_ptr;
 
-  /** default constructor */
-  BatchFixedLagSmoother(double smootherLag = 0.0, const LevenbergMarquardtParams& parameters = LevenbergMarquardtParams(), bool enforceConsistency = true) :
-    FixedLagSmoother(smootherLag), parameters_(parameters), enforceConsistency_(enforceConsistency) { };
+  /**
+   * default constructor
+   * @param incremental keep the ordering, linearization and damping of the
+   *   window between updates rather than starting over, see incremental_
+   * @param relinearizeThreshold in incremental mode, variables whose update is
+   *   smaller than this (max-norm) keep their linearization point
+   */
+  BatchFixedLagSmoother(double smootherLag = 0.0, const LevenbergMarquardtParams& parameters = LevenbergMarquardtParams(), bool enforceConsistency = true,
+      bool incremental = false, double relinearizeThreshold = 0.1) :
+    FixedLagSmoother(smootherLag), parameters_(parameters), enforceConsistency_(enforceConsistency),
+    incremental_(incremental), relinearizeThreshold_(relinearizeThreshold), lambda_(parameters.lambdaInitial) { };
 
   /** destructor */
   virtual ~BatchFixedLagSmoother() { };
@@ -130,9 +138,29 @@ protected:
    * smoothing window. This idea is from ??? TODO: Look up paper reference **/
   bool enforceConsistency_;
 
+  /** Whether to update the window incrementally, i.e., to
+   *  - keep the ordering, only appending new variables in timestamp order and
+   *    moving the variables to be marginalized to the front, instead of running
+   *    constrained COLAMD on every update,
+   *  - keep the linearized factors between updates, and only relinearize those
+   *    involving variables that moved by more than relinearizeThreshold_,
+   *  - start L-M from the damping it ended with in the previous update.
+   * This suits windows that grow at one end and are marginalized at the other,
+   * for which the time order is a good elimination order. **/
+  bool incremental_;
+
+  /** Variables that moved less keep their linearization point, in incremental mode **/
+  double relinearizeThreshold_;
+
+  /** The L-M damping at the end of the last update, at most lambdaInitial, used as a warm start in incremental mode **/
+  double lambda_;
+
   /** The nonlinear factors **/
   NonlinearFactorGraph factors_;
 
+  /** The linearized factors, by slot, nullptr when they need to be relinearized, in incremental mode **/
+  GaussianFactorGraph linearFactors_;
+
   /** The current linearization point **/
   Values theta_;
 
@@ -160,7 +188,14 @@ protected:
   /** Erase any keys associated with timestamps before the provided time */
   void eraseKeys(const KeyVector& keys);
 
-  /** Use colamd to update into an efficient ordering */
+  /** Linearize the factors, reusing cached linearizations in incremental mode */
+  GaussianFactorGraph linearize();
+
+  /** Mark the linearizations of all factors involving key as stale */
+  void invalidateLinearization(Key key);
+
+  /** Use colamd to update into an efficient ordering, or in incremental mode
+   *  just move the keys to be marginalized to the front */
   void reorder(const KeyVector& marginalizeKeys = KeyVector());
 
   /** Optimize the current graph using a modified version of L-M */
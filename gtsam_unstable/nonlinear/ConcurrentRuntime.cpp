@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ConcurrentRuntime.cpp
+ * @brief   Runs the filter and the smoother of the Concurrent Filtering and
+ *          Smoothing architecture on threads of their own
+ * @date    October 2026
+ */
+
+#include <gtsam_unstable/nonlinear/ConcurrentRuntime.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+namespace gtsam {
+
+namespace {
+typedef ConcurrentRuntimeBase::Clock Clock;
+
+double Seconds(Clock::duration duration) {
+  return std::chrono::duration<double>(duration).count();
+}
+
+// Add the n-th sample x to a running mean and maximum
+void Accumulate(double x, size_t n, double& mean, double& max) {
+  mean += (x - mean) / n;
+  max = std::max(max, x);
+}
+}  // namespace
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::Statistics::print(const std::string& s) const {
+  std::cout << s << "filter updates: " << filterUpdates
+            << ", synchronizations: " << synchronizations
+            << ", smoother updates: " << smootherUpdates << std::endl;
+  std::cout << "  filter latency [s]:   mean " << meanFilterLatency << ", max "
+            << maxFilterLatency << std::endl;
+  std::cout << "  filter sync time [s]: mean " << meanSyncDuration << ", max "
+            << maxSyncDuration << std::endl;
+  std::cout << "  sync lag [s]:         mean " << meanSyncLag << ", max "
+            << maxSyncLag << std::endl;
+}
+
+/* ************************************************************************* */
+ConcurrentRuntimeBase::ConcurrentRuntimeBase(
+    const ConcurrentFilter::shared_ptr& filter,
+    const ConcurrentSmoother::shared_ptr& smoother)
+    : filter_(filter), smoother_(smoother) {}
+
+/* ************************************************************************* */
+ConcurrentRuntimeBase::~ConcurrentRuntimeBase() {}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::start() {
+  filterThread_ = std::thread(&ConcurrentRuntimeBase::filterLoop, this);
+  smootherThread_ = std::thread(&ConcurrentRuntimeBase::smootherLoop, this);
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::update(const NonlinearFactorGraph& newFactors,
+                                   const Values& newTheta,
+                                   const FastList<Key>& keysToMove) {
+  rethrow();
+  std::shared_ptr<Measurement> measurement = std::make_shared<Measurement>();
+  measurement->newFactors = newFactors;
+  measurement->newTheta = newTheta;
+  measurement->keysToMove = keysToMove;
+  measurement->queued = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (stopping_)
+      throw std::runtime_error("ConcurrentRuntime::update: already stopped");
+    queue_.push_back(measurement);
+    ++queued_;
+  }
+  queueCondition_.notify_one();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::flush() {
+  {
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    flushCondition_.wait(lock,
+                         [this] { return processed_ == queued_ || error_; });
+  }
+  rethrow();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::join() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    stopping_ = true;
+  }
+  queueCondition_.notify_all();
+  if (filterThread_.joinable()) filterThread_.join();
+
+  // Only now, so that the smoother takes up what the filter sent last
+  smootherStopping_ = true;
+  {
+    std::lock_guard<std::mutex> lock(smootherMutex_);
+  }
+  smootherCondition_.notify_all();
+  if (smootherThread_.joinable()) smootherThread_.join();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::stop() {
+  join();
+  rethrow();
+}
+
+/* ************************************************************************* */
+Values ConcurrentRuntimeBase::calculateEstimate() { return estimate_.front(); }
+
+/* ************************************************************************* */
+ConcurrentRuntimeBase::Statistics ConcurrentRuntimeBase::statistics() {
+  return published_.front();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::fail() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (!error_) error_ = std::current_exception();
+    stopping_ = true;
+  }
+  queueCondition_.notify_all();
+  flushCondition_.notify_all();
+  smootherStopping_ = true;
+  {
+    std::lock_guard<std::mutex> lock(smootherMutex_);
+  }
+  smootherCondition_.notify_all();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::rethrow() {
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    error = error_;
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::filterLoop() {
+  try {
+    while (true) {
+      // The filter only waits here, when there is nothing to filter
+      std::shared_ptr<const Measurement> measurement;
+      {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        queueCondition_.wait(lock,
+                             [this] { return !queue_.empty() || stopping_; });
+        if (queue_.empty() || error_) return;
+        measurement = queue_.front();
+        queue_.pop_front();
+      }
+
+      updateFilter(measurement->newFactors, measurement->newTheta,
+                   measurement->keysToMove);
+      Values estimate = filterEstimate();
+      estimate_.back().swap(estimate);
+      estimate_.publish();
+      Accumulate(Seconds(Clock::now() - measurement->queued),
+                 ++statistics_.filterUpdates, statistics_.meanFilterLatency,
+                 statistics_.maxFilterLatency);
+
+      synchronizeFilter();
+
+      statistics_.smootherUpdates = smootherUpdates_.load();
+      published_.back() = statistics_;
+      published_.publish();
+      {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        ++processed_;
+      }
+      flushCondition_.notify_all();
+    }
+  } catch (...) {
+    fail();
+  }
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::synchronizeFilter() {
+  // Without a summarization from the smoother, it is still busy updating
+  SmootherPackagePtr smootherPackage;
+  if (!toFilter_.take(smootherPackage)) return;
+
+  const Clock::time_point start = Clock::now();
+  filter_->presync();
+  filter_->synchronize(smootherPackage->summarizedFactors,
+                       smootherPackage->separatorValues);
+  FilterPackagePtr filterPackage = std::make_shared<FilterPackage>();
+  filter_->getSmootherFactors(filterPackage->smootherFactors,
+                              filterPackage->smootherValues);
+  filter_->getSummarizedFactors(filterPackage->summarizedFactors,
+                                filterPackage->rootValues);
+  filter_->postsync();
+  filterPackage->sent = Clock::now();
+
+  Accumulate(Seconds(filterPackage->sent - start),
+             ++statistics_.synchronizations, statistics_.meanSyncDuration,
+             statistics_.maxSyncDuration);
+  if (smootherPackage->hasFilterFactors)
+    Accumulate(Seconds(start - smootherPackage->filterSent), ++syncLagSamples_,
+               statistics_.meanSyncLag, statistics_.maxSyncLag);
+
+  // The slot is empty, as the smoother took the previous package before
+  // posting its summarization
+  const bool posted = toSmoother_.post(filterPackage);
+  assert(posted);
+  (void)posted;
+  wakeSmoother();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::wakeSmoother() {
+  // Either the smoother sees the posted package, or the filter sees the flag
+  // the smoother sets before looking for it: the fences order each store
+  // before the load on the other side. Taking the mutex waits until the
+  // smoother is inside wait(), so that the notification is not lost, and is
+  // only needed while it sleeps, when it does not hold the mutex for long.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!smootherWaiting_.load(std::memory_order_relaxed)) return;
+  {
+    std::lock_guard<std::mutex> lock(smootherMutex_);
+  }
+  smootherCondition_.notify_one();
+}
+
+/* ************************************************************************* */
+void ConcurrentRuntimeBase::smootherLoop() {
+  try {
+    SmootherPackagePtr smootherPackage = std::make_shared<SmootherPackage>();
+    while (true) {
+      updateSmoother();
+      ++smootherUpdates_;
+
+      // Leave the summarization for the filter to pick up
+      smoother_->presync();
+      smoother_->getSummarizedFactors(smootherPackage->summarizedFactors,
+                                      smootherPackage->separatorValues);
+      toFilter_.post(smootherPackage);
+
+      // and wait for its answer
+      FilterPackagePtr filterPackage;
+      if (!toSmoother_.take(filterPackage)) {
+        std::unique_lock<std::mutex> lock(smootherMutex_);
+        smootherWaiting_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!toSmoother_.take(filterPackage)) {
+          if (smootherStopping_) return;
+          smootherCondition_.wait(lock);
+        }
+        smootherWaiting_.store(false, std::memory_order_relaxed);
+      }
+      smoother_->synchronize(
+          filterPackage->smootherFactors, filterPackage->smootherValues,
+          filterPackage->summarizedFactors, filterPackage->rootValues);
+      smoother_->postsync();
+
+      smootherPackage = std::make_shared<SmootherPackage>();
+      smootherPackage->hasFilterFactors = true;
+      smootherPackage->filterSent = filterPackage->sent;
+    }
+  } catch (...) {
+    fail();
+  }
+}
+
+}  // namespace gtsam
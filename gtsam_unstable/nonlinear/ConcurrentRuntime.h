@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ConcurrentRuntime.h
+ * @brief   Runs the filter and the smoother of the Concurrent Filtering and
+ *          Smoothing architecture on threads of their own, synchronizing them
+ *          without ever making the filter wait for the smoother
+ * @date    October 2026
+ */
+
+// \callgraph
+#pragma once
+
+#include <gtsam_unstable/nonlinear/ConcurrentFilteringAndSmoothing.h>
+#include <gtsam/base/FastList.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace gtsam {
+
+namespace internal {
+
+/**
+ * Single-slot hand-off from one producer thread to one consumer thread. Each
+ * side swaps its own working buffer with the slot, so T should be cheap to
+ * swap, e.g., a pointer. Neither side ever waits: post() fails while the
+ * consumer has not taken the previous value, and take() fails while the slot
+ * is empty.
+ */
+template <class T>
+class Handoff {
+ public:
+  /// Producer: move value into the slot, returns false if it is still full
+  bool post(T& value) {
+    if (full_.load(std::memory_order_acquire)) return false;
+    std::swap(slot_, value);
+    full_.store(true, std::memory_order_release);
+    return true;
+  }
+
+  /// Consumer: move the posted value out of the slot, returns false if empty
+  bool take(T& value) {
+    if (!full_.load(std::memory_order_acquire)) return false;
+    std::swap(value, slot_);
+    full_.store(false, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  T slot_;
+  std::atomic<bool> full_{false};
+};
+
+/**
+ * Triple buffer through which one writer thread publishes a value that one
+ * reader thread can read at any time: the latest published value, never a
+ * partially written one. Neither side waits for the other.
+ */
+template <class T>
+class TripleBuffer {
+ public:
+  /// Writer: the buffer to fill before calling publish()
+  T& back() { return buffers_[back_]; }
+
+  /// Writer: make back() the latest value
+  void publish() {
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & kIndex;
+  }
+
+  /// Reader: the latest published value
+  const T& front() {
+    if (middle_.load(std::memory_order_relaxed) & kFresh)
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndex;
+    return buffers_[front_];
+  }
+
+ private:
+  enum { kIndex = 3, kFresh = 4 };
+  T buffers_[3];
+  std::atomic<unsigned> middle_{1};  ///< buffer in between, and whether fresh
+  unsigned back_ = 0, front_ = 2;
+};
+
+}  // namespace internal
+
+/**
+ * Runs a ConcurrentFilter and a ConcurrentSmoother on two threads owned by this
+ * object, replacing the update() and synchronize() calls an application would
+ * otherwise schedule itself. Measurements are queued with update() and
+ * processed by the filter thread in order; the latest filter estimate is
+ * available through calculateEstimate().
+ *
+ * The smoother thread alternates between updating the smoother and
+ * synchronizing. Synchronization is split into the halves of synchronize()
+ * that touch the filter and the smoother, and each thread executes its own
+ * half. The halves meet in two single-slot hand-offs: after an update the
+ * smoother posts its summarization, and the filter, between two updates, picks
+ * it up if it is there, synchronizes, and posts its smoother factors and
+ * summarization back. The filter never waits; while the smoother is busy it
+ * simply keeps filtering and synchronizes after a later update.
+ *
+ * This is a base class, use the ConcurrentRuntime template with the filter
+ * and smoother types. All public methods must be called from one thread.
+ */
+class GTSAM_UNSTABLE_EXPORT ConcurrentRuntimeBase {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  /** Timings collected by the filter thread, in seconds */
+  struct Statistics {
+    size_t filterUpdates = 0;     ///< number of filter updates
+    size_t synchronizations = 0;  ///< number of synchronizations
+    size_t smootherUpdates = 0;   ///< number of smoother updates
+
+    /// Time from update() until the resulting estimate is available
+    double meanFilterLatency = 0, maxFilterLatency = 0;
+
+    /// Time the filter spent in its half of a synchronization
+    double meanSyncDuration = 0, maxSyncDuration = 0;
+
+    /// Time from the filter sending factors to the smoother until it receives
+    /// the smoother summarization that includes them
+    double meanSyncLag = 0, maxSyncLag = 0;
+
+    void print(const std::string& s = "") const;
+  };
+
+  /** The derived class must have joined the threads already */
+  virtual ~ConcurrentRuntimeBase();
+
+  /**
+   * Queue new factors and variables for the filter, see
+   * ConcurrentBatchFilter::update. Returns immediately. Rethrows the first
+   * exception thrown on the filter or smoother thread, if any.
+   */
+  void update(const NonlinearFactorGraph& newFactors = NonlinearFactorGraph(),
+              const Values& newTheta = Values(),
+              const FastList<Key>& keysToMove = FastList<Key>());
+
+  /** Wait until the filter has processed all queued updates */
+  void flush();
+
+  /**
+   * Process all queued updates, let the smoother take up the last factors the
+   * filter sent it, and join the threads. Does nothing if already stopped.
+   */
+  void stop();
+
+  /** The filter estimate after the latest processed update */
+  Values calculateEstimate();
+
+  /** Statistics as of the latest processed update */
+  Statistics statistics();
+
+ protected:
+  ConcurrentRuntimeBase(const ConcurrentFilter::shared_ptr& filter,
+                        const ConcurrentSmoother::shared_ptr& smoother);
+
+  /** Start the threads, called by the constructor of the derived class */
+  void start();
+
+  /** As stop(), but without rethrowing, called by the derived destructor */
+  void join();
+
+  /// @name Filter and smoother specific calls, made on their threads
+  /// @{
+  virtual void updateFilter(const NonlinearFactorGraph& newFactors,
+                            const Values& newTheta,
+                            const FastList<Key>& keysToMove) = 0;
+  virtual Values filterEstimate() const = 0;
+  virtual void updateSmoother() = 0;
+  /// @}
+
+ private:
+  struct Measurement {
+    NonlinearFactorGraph newFactors;
+    Values newTheta;
+    FastList<Key> keysToMove;
+    Clock::time_point queued;
+  };
+
+  /// What the filter sends to the smoother when synchronizing
+  struct FilterPackage {
+    NonlinearFactorGraph smootherFactors, summarizedFactors;
+    Values smootherValues, rootValues;
+    Clock::time_point sent;
+  };
+
+  /// What the smoother sends to the filter when synchronizing
+  struct SmootherPackage {
+    NonlinearFactorGraph summarizedFactors;
+    Values separatorValues;
+    bool hasFilterFactors = false;  ///< whether it includes a FilterPackage
+    Clock::time_point filterSent;   ///< when that FilterPackage was sent
+  };
+
+  typedef std::shared_ptr<FilterPackage> FilterPackagePtr;
+  typedef std::shared_ptr<SmootherPackage> SmootherPackagePtr;
+
+  void filterLoop();
+  void smootherLoop();
+
+  /// The filter half of the synchronization, if the smoother is ready
+  void synchronizeFilter();
+
+  /// Wake up the smoother if it waits, or is about to, for the filter
+  void wakeSmoother();
+
+  /// Record the exception being handled and stop the threads
+  void fail();
+  void rethrow();
+
+  ConcurrentFilter::shared_ptr filter_;
+  ConcurrentSmoother::shared_ptr smoother_;
+  std::thread filterThread_, smootherThread_;
+
+  // Measurements queued for the filter
+  std::mutex queueMutex_;
+  std::condition_variable queueCondition_;   ///< new measurement or stopping
+  std::condition_variable flushCondition_;   ///< measurement processed
+  std::deque<std::shared_ptr<const Measurement> > queue_;
+  size_t queued_ = 0, processed_ = 0;
+  bool stopping_ = false;
+  std::exception_ptr error_;
+
+  // Synchronization. The idle smoother sleeps on the condition variable, and
+  // the filter only takes the mutex to wake it when the flag says it sleeps.
+  internal::Handoff<FilterPackagePtr> toSmoother_;
+  internal::Handoff<SmootherPackagePtr> toFilter_;
+  std::mutex smootherMutex_;
+  std::condition_variable smootherCondition_;
+  std::atomic<bool> smootherWaiting_{false};
+  std::atomic<bool> smootherStopping_{false};
+  std::atomic<size_t> smootherUpdates_{0};
+
+  // Published by the filter thread
+  Statistics statistics_;  ///< only touched by the filter thread
+  size_t syncLagSamples_ = 0;
+  internal::TripleBuffer<Values> estimate_;
+  internal::TripleBuffer<Statistics> published_;
+};
+
+/**
+ * ConcurrentRuntimeBase for filters and smoothers of the given types, e.g.,
+ * ConcurrentBatchFilter and ConcurrentBatchSmoother, or their incremental
+ * counterparts. Only use the filter and the smoother once stopped.
+ */
+template <class FILTER, class SMOOTHER>
+class ConcurrentRuntime : public ConcurrentRuntimeBase {
+ public:
+  typedef ConcurrentRuntimeBase Base;
+
+  /** Start the threads on the given filter and smoother */
+  ConcurrentRuntime(const boost::shared_ptr<FILTER>& filter,
+                    const boost::shared_ptr<SMOOTHER>& smoother)
+      : Base(filter, smoother), filter_(filter), smoother_(smoother) {
+    start();
+  }
+
+  /** Stop the threads, see stop() */
+  ~ConcurrentRuntime() override { join(); }
+
+  /// The filter, do not access it while running
+  const FILTER& filter() const { return *filter_; }
+
+  /// The smoother, do not access it while running
+  const SMOOTHER& smoother() const { return *smoother_; }
+
+ protected:
+  void updateFilter(const NonlinearFactorGraph& newFactors,
+                    const Values& newTheta,
+                    const FastList<Key>& keysToMove) override {
+    filter_->update(newFactors, newTheta, keysToMove);
+  }
+
+  Values filterEstimate() const override {
+    return filter_->calculateEstimate();
+  }
+
+  void updateSmoother() override { smoother_->update(); }
+
+ private:
+  boost::shared_ptr<FILTER> filter_;
+  boost::shared_ptr<SMOOTHER> smoother_;
+};
+
+}  // namespace gtsam
@@ -46,6 +46,20 @@ void recursiveMarkAffectedKeys(const Key& key,
   // If the key was not found in the separator/parents, then none of its children can have it either
 }
 
+/* ************************************************************************* */
+// Check that all frontal keys in the subtree are in keys, and collect them
+static bool subtreeInKeys(const ISAM2Clique::shared_ptr& clique,
+    const KeySet& keys, KeySet& subtreeKeys) {
+  for(Key frontal: clique->conditional()->frontals()) {
+    if (!keys.exists(frontal)) return false;
+    subtreeKeys.insert(frontal);
+  }
+  for(const ISAM2Clique::shared_ptr& child: clique->children) {
+    if (!subtreeInKeys(child, keys, subtreeKeys)) return false;
+  }
+  return true;
+}
+
 /* ************************************************************************* */
 void IncrementalFixedLagSmoother::print(const std::string& s,
     const KeyFormatter& keyFormatter) const {
@@ -99,8 +113,30 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
     std::cout << std::endl;
   }
 
-  // Force iSAM2 to put the marginalizable variables at the beginning
-  createOrderingConstraints(marginalizableKeys, constrainedKeys);
+  // Only if some of the marginalizable variables are not leaves, and have
+  // waited for that long enough, force iSAM2 to put the marginalizable
+  // variables at the beginning
+  bool forceLeaves = false;
+  if (marginalizableKeys.size() > 0) {
+    const KeySet leaves = marginalizableLeaves(marginalizableKeys);
+    const double deadline =
+        current_timestamp - smootherLag_ - marginalizationDelay_;
+    for(Key key: marginalizableKeys) {
+      if (!leaves.exists(key) && keyTimestampMap_.at(key) < deadline) {
+        forceLeaves = true;
+        break;
+      }
+    }
+  }
+  if (forceLeaves) {
+    createOrderingConstraints(marginalizableKeys, constrainedKeys);
+    // Keep the new variables at the root, as iSAM2 would without constraints
+    for(Key key: newFactors.keys()) {
+      const auto it = constrainedKeys->find(key);
+      if (it == constrainedKeys->end() || it->second != 0)
+        (*constrainedKeys)[key] = 2;
+    }
+  }
 
   if (debug) {
     std::cout << "Constrained Keys: ";
@@ -116,7 +152,7 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
 
   // Mark additional keys between the marginalized keys and the leaves
   std::set<Key> additionalKeys;
-  for(Key key: marginalizableKeys) {
+  for(Key key: forceLeaves ? marginalizableKeys : KeyVector()) {
     ISAM2Clique::shared_ptr clique = isam_[key];
     for(const ISAM2Clique::shared_ptr& child: clique->children) {
       recursiveMarkAffectedKeys(key, child, additionalKeys);
@@ -134,11 +170,16 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
     std::cout << "END" << std::endl;
   }
 
-  // Marginalize out any needed variables
+  // Marginalize out the needed variables that are leaves now, the others are
+  // tried again in the next update
   if (marginalizableKeys.size() > 0) {
-    FastList<Key> leafKeys(marginalizableKeys.begin(),
-        marginalizableKeys.end());
+    const KeySet leaves = marginalizableLeaves(marginalizableKeys);
+    if (debug && leaves.size() < marginalizableKeys.size())
+      std::cout << "Postponing marginalization of "
+          << marginalizableKeys.size() - leaves.size() << " keys" << std::endl;
+    FastList<Key> leafKeys(leaves.begin(), leaves.end());
     isam_.marginalizeLeaves(leafKeys);
+    marginalizableKeys.assign(leaves.begin(), leaves.end());
   }
 
   // Remove marginalized keys from the KeyTimestampMap
@@ -190,6 +231,64 @@ void IncrementalFixedLagSmoother::createOrderingConstraints(
   }
 }
 
+/* ************************************************************************* */
+KeySet IncrementalFixedLagSmoother::marginalizableLeaves(
+    const KeyVector& keys) const {
+  // Mirror what ISAM2::marginalizeLeaves does for each key, and drop the keys
+  // for which it would remove other keys, or which it would not remove at all.
+  // Dropping keys may block others in turn, so repeat until nothing changes.
+  KeySet candidates(keys.begin(), keys.end());
+  while (!candidates.empty()) {
+    KeySet removed;
+    for(Key key: candidates) {
+      if (removed.exists(key) || !isam_.nodes().exists(key)) continue;
+
+      // Find the root of the marginalized subtree
+      ISAM2Clique::shared_ptr clique = isam_[key];
+      while (clique->parent() && candidates.exists(
+          clique->parent()->conditional()->front())) {
+        clique = clique->parent();
+      }
+
+      // The candidates among the frontal keys need to come first
+      const auto& conditional = *clique->conditional();
+      size_t nrLeading = 0;
+      while (nrLeading < conditional.nrFrontals()
+          && candidates.exists(conditional.keys()[nrLeading])) {
+        ++nrLeading;
+      }
+      bool ok = true;
+      for(size_t i = nrLeading; i < conditional.nrFrontals(); ++i) {
+        if (candidates.exists(conditional.keys()[i])) ok = false;
+      }
+
+      KeySet subtreeKeys;
+      if (ok && nrLeading == conditional.nrFrontals()) {
+        // The whole clique and its subtree go, which needs a parent
+        ok = clique->parent()
+            && subtreeInKeys(clique, candidates, subtreeKeys);
+      } else if (ok) {
+        // Children depending on the candidates go entirely
+        for(const ISAM2Clique::shared_ptr& child: clique->children) {
+          for(Key parent: child->conditional()->parents()) {
+            if (candidates.exists(parent)) {
+              ok = ok && subtreeInKeys(child, candidates, subtreeKeys);
+              break;
+            }
+          }
+        }
+        subtreeKeys.insert(conditional.beginFrontals(),
+            conditional.beginFrontals() + nrLeading);
+      }
+      if (ok) removed.insert(subtreeKeys.begin(), subtreeKeys.end());
+    }
+
+    if (removed.size() == candidates.size()) break;
+    candidates = removed;
+  }
+  return candidates;
+}
+
 /* ************************************************************************* */
 void IncrementalFixedLagSmoother::PrintKeySet(const std::set<Key>& keys,
     const std::string& label) {
@@ -37,10 +37,17 @@ public:
   /// Typedef for a shared pointer to an Incremental Fixed-Lag Smoother
   typedef boost::shared_ptr<IncrementalFixedLagSmoother> shared_ptr;
 
-  /** default constructor */
+  /**
+   * default constructor
+   * @param marginalizationDelay how much longer than the lag variables may stay
+   *   in the smoother while waiting to become leaves of the Bayes tree, see
+   *   marginalizationDelay_
+   */
   IncrementalFixedLagSmoother(double smootherLag = 0.0,
-      const ISAM2Params& parameters = DefaultISAM2Params()) :
-      FixedLagSmoother(smootherLag), isam_(parameters) {
+      const ISAM2Params& parameters = DefaultISAM2Params(),
+      double marginalizationDelay = 0.0) :
+      FixedLagSmoother(smootherLag), isam_(parameters),
+      marginalizationDelay_(marginalizationDelay) {
   }
 
   /** destructor */
@@ -129,6 +136,15 @@ protected:
   /** Store results of latest isam2 update */
   ISAM2Result isamResult_;
 
+  /** Variables older than the lag are marginalized right away only if they
+   * are leaves of the Bayes tree, which is cheap. Otherwise they stay until
+   * they are older than the lag plus this delay, often becoming leaves in the
+   * meantime as older variables below them are marginalized. Only then are
+   * they, and all other variables older than the lag, made leaves at once by a
+   * constrained reordering, which re-eliminates the tree from the cliques
+   * involved up to the root. **/
+  double marginalizationDelay_;
+
   /** Erase any keys associated with timestamps before the provided time */
   void eraseKeysBefore(double timestamp);
 
@@ -136,6 +152,10 @@ protected:
   void createOrderingConstraints(const KeyVector& marginalizableKeys,
       boost::optional<FastMap<Key, int> >& constrainedKeys) const;
 
+  /** The largest subset of the given keys that ISAM2::marginalizeLeaves can
+   *  remove from the current Bayes tree as is, i.e., without reordering */
+  KeySet marginalizableLeaves(const KeyVector& keys) const;
+
 private:
   /** Private methods for printing debug information */
   static void PrintKeySet(const std::set<Key>& keys, const std::string& label =
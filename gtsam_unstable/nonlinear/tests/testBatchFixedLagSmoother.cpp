@@ -22,6 +22,7 @@
 #include <gtsam/inference/Key.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/geometry/Point2.h>
+#include <gtsam/geometry/Pose2.h>
 #include <gtsam/linear/GaussianBayesNet.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
@@ -237,6 +238,163 @@ TEST( BatchFixedLagSmoother, Example )
   }
 }
 
+/* ************************************************************************* */
+TEST( BatchFixedLagSmoother, Incremental )
+{
+  // Keeping the ordering, linearization and damping between updates should
+  // not change the solution, on a linear problem as well as a nonlinear one
+  SharedDiagonal odometerNoise = noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.1));
+  SharedDiagonal poseNoise = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  typedef BatchFixedLagSmoother::KeyTimestampMap Timestamps;
+
+  BatchFixedLagSmoother linear(5.0, LevenbergMarquardtParams(), true, true);
+  BatchFixedLagSmoother batch(5.0, LevenbergMarquardtParams());
+  BatchFixedLagSmoother incremental(5.0, LevenbergMarquardtParams(), true, true, 0.0);
+
+  Values fullinit;
+  NonlinearFactorGraph fullgraph;
+  for (size_t i = 0; i <= 20; ++i) {
+    NonlinearFactorGraph newFactors, newPoseFactors;
+    Values newValues, newPoses;
+    Timestamps newTimestamps;
+
+    // Keys are numbered backwards in time
+    const Key key(100 - i), pose(i);
+    newValues.insert(key, Point2(double(i) + 0.1, -0.1));
+    newPoses.insert(pose, Pose2(double(i) + 0.1, -0.1, 0.1 * i));
+    newTimestamps[key] = double(i);
+    if (i == 0) {
+      newFactors.addPrior(key, Point2(0.0, 0.0), odometerNoise);
+      newPoseFactors.addPrior(pose, Pose2(), poseNoise);
+    } else {
+      newFactors.push_back(BetweenFactor<Point2>(
+          key + 1, key, Point2(1.0, 0.0), odometerNoise));
+      newPoseFactors.push_back(BetweenFactor<Pose2>(
+          pose - 1, pose, Pose2(1.0, 0.0, 0.2), poseNoise));
+    }
+    if (i >= 3 && i % 4 == 0) {
+      newFactors.push_back(BetweenFactor<Point2>(
+          key + 3, key, Point2(3.0, 0.0), odometerNoise));
+      newPoseFactors.push_back(BetweenFactor<Pose2>(
+          pose - 3, pose, Pose2(1.0, 0.0, 0.2).compose(Pose2(1.0, 0.0, 0.2))
+                              .compose(Pose2(1.0, 0.0, 0.2)), poseNoise));
+    }
+
+    fullgraph.push_back(newFactors);
+    fullinit.insert(newValues);
+    linear.update(newFactors, newValues, newTimestamps);
+    CHECK(check_smoother(fullgraph, fullinit, linear, key));
+
+    Timestamps poseTimestamps;
+    poseTimestamps[pose] = double(i);
+    batch.update(newPoseFactors, newPoses, poseTimestamps);
+    incremental.update(newPoseFactors, newPoses, poseTimestamps);
+    EXPECT(assert_equal(batch.calculateEstimate(),
+                        incremental.calculateEstimate(), 1e-4));
+  }
+
+  // The ordering is kept in time order
+  const Ordering& ordering = linear.getOrdering();
+  for (size_t k = 1; k < ordering.size(); ++k)
+    EXPECT(ordering[k - 1] > ordering[k]);
+}
+
+/* ************************************************************************* */
+TEST( BatchFixedLagSmoother, IncrementalGiveUp )
+{
+  // A Pose2 chain with loop closures and a poor initial guess. Without an
+  // absolute error tolerance, Levenberg-Marquardt only stops once the error is
+  // down to round-off, where no step decreases it, and it gives up with
+  // maximum damping. The damping carried into the next update must not keep
+  // that update from converging, with or without the default relinearization
+  // threshold.
+  SharedDiagonal poseNoise = noiseModel::Diagonal::Sigmas(Vector3(3.0, 3.0, 3.0));
+  typedef BatchFixedLagSmoother::KeyTimestampMap Timestamps;
+
+  LevenbergMarquardtParams parameters;
+  parameters.absoluteErrorTol = 0.0;
+  BatchFixedLagSmoother batch(8.0, parameters);
+  BatchFixedLagSmoother incremental(8.0, parameters, true, true, 0.0);
+  BatchFixedLagSmoother thresholded(8.0, parameters, true, true);
+
+  const Pose2 odometry(1.0, 0.0, 0.3);
+  Pose2 truth;
+  for (size_t i = 0; i < 40; ++i) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    Timestamps newTimestamps;
+    if (i > 0) truth = truth.compose(odometry);
+    newValues.insert(i, truth.compose(Pose2(5.0, -3.0, 0.1)));
+    newTimestamps[i] = double(i);
+    if (i == 0) {
+      newFactors.addPrior(Key(0), Pose2(), poseNoise);
+    } else {
+      newFactors.push_back(BetweenFactor<Pose2>(i - 1, i, odometry, poseNoise));
+    }
+    if (i >= 5 && i % 3 == 0) {
+      const Pose2 loop = odometry.compose(odometry).compose(odometry)
+                             .compose(odometry).compose(odometry);
+      newFactors.push_back(BetweenFactor<Pose2>(i - 5, i, loop, poseNoise));
+    }
+
+    const FixedLagSmoother::Result expected =
+        batch.update(newFactors, newValues, newTimestamps);
+    const FixedLagSmoother::Result actual =
+        incremental.update(newFactors, newValues, newTimestamps);
+    thresholded.update(newFactors, newValues, newTimestamps);
+    EXPECT_DOUBLES_EQUAL(expected.getError(), actual.getError(), 1e-6);
+    EXPECT(assert_equal(batch.calculateEstimate(),
+                        incremental.calculateEstimate(), 1e-6));
+    EXPECT(assert_equal(batch.calculateEstimate(),
+                        thresholded.calculateEstimate(), 1e-6));
+  }
+}
+
+/* ************************************************************************* */
+TEST( BatchFixedLagSmoother, IncrementalMarginalize )
+{
+  // A Pose2 chain with odometry and loop closures that do not agree, so the
+  // marginal factors depend on where they are linearized. Variables that moved
+  // by less than the relinearization threshold are relinearized before they
+  // are marginalized, so the thresholded smoother still follows the batch one,
+  // up to the effect of the threshold on the variables in the window.
+  SharedDiagonal poseNoise = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  typedef BatchFixedLagSmoother::KeyTimestampMap Timestamps;
+
+  LevenbergMarquardtParams parameters;
+  parameters.relativeErrorTol = 1e-9;
+  parameters.absoluteErrorTol = 1e-9;
+  BatchFixedLagSmoother batch(6.0, parameters);
+  BatchFixedLagSmoother thresholded(6.0, parameters, true, true, 3e-5);
+
+  Pose2 guess;
+  for (size_t i = 0; i < 100; ++i) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    Timestamps newTimestamps;
+    const Pose2 odometry(1.0 + 0.05 * ((i % 3) - 1.0), 0.02 * (i % 2), 0.2);
+    if (i > 0) guess = guess.compose(odometry);
+    newValues.insert(i, guess);
+    newTimestamps[i] = double(i);
+    if (i == 0) {
+      newFactors.addPrior(Key(0), Pose2(), poseNoise);
+    } else {
+      newFactors.push_back(BetweenFactor<Pose2>(i - 1, i, odometry, poseNoise));
+    }
+    if (i >= 4 && i % 2 == 0) {
+      const Pose2 nominal(1.0, 0.0, 0.2);
+      const Pose2 loop = nominal.compose(nominal).compose(nominal)
+                             .compose(nominal).compose(Pose2(0.1, -0.1, 0.05));
+      newFactors.push_back(BetweenFactor<Pose2>(i - 4, i, loop, poseNoise));
+    }
+
+    batch.update(newFactors, newValues, newTimestamps);
+    thresholded.update(newFactors, newValues, newTimestamps);
+    EXPECT(assert_equal(batch.calculateEstimate(),
+                        thresholded.calculateEstimate(), 1e-5));
+  }
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
 /* ************************************************************************* */
@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testConcurrentRuntime.cpp
+ * @brief   Unit tests for running a concurrent filter and smoother on threads
+ * @date    October 2026
+ */
+
+#include <gtsam_unstable/nonlinear/ConcurrentRuntime.h>
+#include <gtsam_unstable/nonlinear/ConcurrentBatchFilter.h>
+#include <gtsam_unstable/nonlinear/ConcurrentBatchSmoother.h>
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalFilter.h>
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalSmoother.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+
+// The scenario of ConcurrentFilteringAndSmoothingExample: a robot driving at
+// 2 m/s, with odometry from two sources that disagree
+const double lag = 2.0, deltaT = 0.25;
+const SharedDiagonal priorNoise = noiseModel::Diagonal::Sigmas(Vector3(0.3, 0.3, 0.1));
+const SharedDiagonal odometryNoise1 = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+const SharedDiagonal odometryNoise2 = noiseModel::Diagonal::Sigmas(Vector3(0.05, 0.05, 0.05));
+
+Key KeyAt(size_t step) { return 250 * step; }
+
+/* ************************************************************************* */
+// Replay nrSteps steps through the runtime without pausing, and wait until the
+// filter has processed them. Returns the estimate of a filter of the same type
+// that processed them on this thread: the estimate of the latest pose does not
+// depend on when the filter synchronized, if at all.
+template <class FILTER>
+Values Replay(ConcurrentRuntimeBase& runtime, size_t nrSteps) {
+  FILTER filter;
+
+  NonlinearFactorGraph newFactors;
+  Values newValues;
+  newFactors.addPrior(KeyAt(0), Pose2(), priorNoise);
+  newValues.insert(KeyAt(0), Pose2());
+  runtime.update(newFactors, newValues);
+  filter.update(newFactors, newValues);
+
+  const size_t lagSteps = lag / deltaT;
+  Pose2 pose;
+  for (size_t step = 1; step <= nrSteps; ++step) {
+    pose = pose * Pose2(0.5, 0.0, 0.015);
+    newFactors = NonlinearFactorGraph();
+    newValues.clear();
+    newValues.insert(KeyAt(step), pose);
+    newFactors.emplace_shared<BetweenFactor<Pose2> >(
+        KeyAt(step - 1), KeyAt(step), Pose2(0.61, -0.08, 0.02), odometryNoise1);
+    newFactors.emplace_shared<BetweenFactor<Pose2> >(
+        KeyAt(step - 1), KeyAt(step), Pose2(0.47, 0.03, 0.01), odometryNoise2);
+    FastList<Key> oldKeys;
+    if (step > lagSteps) oldKeys.push_back(KeyAt(step - lagSteps - 1));
+    runtime.update(newFactors, newValues, oldKeys);
+    filter.update(newFactors, newValues, oldKeys);
+  }
+  runtime.flush();
+  return filter.calculateEstimate();
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+TEST(ConcurrentRuntime, Batch) {
+  const size_t nrSteps = 400;
+  ConcurrentRuntime<ConcurrentBatchFilter, ConcurrentBatchSmoother> runtime(
+      boost::make_shared<ConcurrentBatchFilter>(),
+      boost::make_shared<ConcurrentBatchSmoother>());
+  const Values expected = Replay<ConcurrentBatchFilter>(runtime, nrSteps);
+
+  const Key last = KeyAt(nrSteps);
+  EXPECT(assert_equal(expected.at<Pose2>(last),
+                      runtime.calculateEstimate().at<Pose2>(last), 1e-3));
+
+  ConcurrentRuntimeBase::Statistics statistics = runtime.statistics();
+  EXPECT_LONGS_EQUAL(nrSteps + 1, statistics.filterUpdates);
+  EXPECT(statistics.synchronizations >= 1);
+  EXPECT(statistics.synchronizations <= statistics.filterUpdates);
+  EXPECT(statistics.meanFilterLatency <= statistics.maxFilterLatency);
+  EXPECT(statistics.meanSyncDuration <= statistics.maxSyncDuration);
+  EXPECT(statistics.meanSyncLag <= statistics.maxSyncLag);
+
+  // Once stopped, the smoother holds the poses the filter moved to it, and
+  // only the prior informs the first one
+  runtime.stop();
+  CHECK_EXCEPTION(runtime.update(), std::runtime_error);
+  const Values smoothed = runtime.smoother().calculateEstimate();
+  EXPECT(assert_equal(Pose2(), smoothed.at<Pose2>(KeyAt(0)), 1e-3));
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentRuntime, Incremental) {
+  const size_t nrSteps = 400;
+  ConcurrentRuntime<ConcurrentIncrementalFilter, ConcurrentIncrementalSmoother>
+      runtime(boost::make_shared<ConcurrentIncrementalFilter>(),
+              boost::make_shared<ConcurrentIncrementalSmoother>());
+  const Values expected = Replay<ConcurrentIncrementalFilter>(runtime, nrSteps);
+
+  const Key last = KeyAt(nrSteps);
+  EXPECT(assert_equal(expected.at<Pose2>(last),
+                      runtime.calculateEstimate().at<Pose2>(last), 1e-3));
+  EXPECT_LONGS_EQUAL(nrSteps + 1, runtime.statistics().filterUpdates);
+  EXPECT(runtime.statistics().synchronizations >= 1);
+  runtime.stop();
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentRuntime, Exception) {
+  ConcurrentRuntime<ConcurrentBatchFilter, ConcurrentBatchSmoother> runtime(
+      boost::make_shared<ConcurrentBatchFilter>(),
+      boost::make_shared<ConcurrentBatchSmoother>());
+
+  // A factor on a variable without initial value fails on the filter thread
+  NonlinearFactorGraph newFactors;
+  newFactors.addPrior(KeyAt(0), Pose2(), priorNoise);
+  runtime.update(newFactors);
+  CHECK_EXCEPTION(runtime.flush(), ValuesKeyDoesNotExist);
+  CHECK_EXCEPTION(runtime.stop(), ValuesKeyDoesNotExist);
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
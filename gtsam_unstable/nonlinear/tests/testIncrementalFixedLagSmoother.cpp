@@ -233,6 +233,58 @@ TEST( IncrementalFixedLagSmoother, Example )
   }
 }
 
+/* ************************************************************************* */
+TEST( IncrementalFixedLagSmoother, MarginalizationDelay )
+{
+  // Variables that are not leaves yet may stay up to the delay longer than the
+  // lag. Marginalization is exact on a linear problem, so this should not
+  // change the solution, while it saves forcing those variables to the front
+  // and re-eliminating the cliques in between.
+  SharedDiagonal odometerNoise = noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.1));
+  typedef IncrementalFixedLagSmoother::KeyTimestampMap Timestamps;
+  const double lag = 5.0;
+
+  map<double, bool> postponed;
+  map<double, size_t> reeliminated;
+  for (double delay : {0.0, 3.0}) {
+    IncrementalFixedLagSmoother smoother(lag, ISAM2Params(), delay);
+    Values fullinit;
+    NonlinearFactorGraph fullgraph;
+    for (size_t i = 0; i <= 30; ++i) {
+      NonlinearFactorGraph newFactors;
+      Values newValues;
+      Timestamps newTimestamps;
+
+      const Key key = MakeKey(i);
+      if (i == 0)
+        newFactors.addPrior(key, Point2(0.0, 0.0), odometerNoise);
+      else
+        newFactors.push_back(BetweenFactor<Point2>(MakeKey(i - 1), key,
+            Point2(1.0, 0.0), odometerNoise));
+      if (i >= 3 && i % 4 == 0)
+        newFactors.push_back(BetweenFactor<Point2>(MakeKey(i - 3), key,
+            Point2(3.0, 0.0), odometerNoise));
+      newValues.insert(key, Point2(double(i) + 0.1, -0.1));
+      newTimestamps[key] = double(i);
+
+      fullgraph.push_back(newFactors);
+      fullinit.insert(newValues);
+      smoother.update(newFactors, newValues, newTimestamps);
+      reeliminated[delay] +=
+          smoother.getISAM2Result().variablesReeliminated;
+
+      CHECK(check_smoother(fullgraph, fullinit, smoother, key));
+      for (const auto& key_timestamp : smoother.timestamps()) {
+        EXPECT(key_timestamp.second >= double(i) - lag - delay);
+        if (key_timestamp.second < double(i) - lag) postponed[delay] = true;
+      }
+    }
+  }
+  EXPECT(!postponed[0.0]);
+  EXPECT(postponed[3.0]);
+  EXPECT(reeliminated[3.0] < reeliminated[0.0]);
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
 /* ************************************************************************* */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchActiveSetSolver.cpp
+ * @brief   Cold and warm started QP solves, on the QPS problems and on a
+ *          sequence of model predictive control problems
+ * @date    October 2026
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/inference/Symbol.h>
+#include <gtsam_unstable/linear/QPSParser.h>
+#include <gtsam_unstable/linear/QPSolver.h>
+
+#include <map>
+
+using namespace gtsam;
+using namespace gtsam::benchmark;
+
+namespace {
+
+typedef std::pair<VectorValues, VectorValues> Solution;
+
+// Keys of the duals, i.e., the active constraints
+KeySet workingSet(const VectorValues& duals) {
+  KeySet keys;
+  for (const auto& key_value : duals) keys.insert(key_value.first);
+  return keys;
+}
+
+// Pull every variable slightly towards 1, as from one problem to the next
+QP perturbed(const QP& qp) {
+  std::map<Key, size_t> dims;
+  for (const GaussianFactor::shared_ptr& factor : qp.cost)
+    for (auto it = factor->begin(); it != factor->end(); ++it)
+      dims[*it] = factor->getDim(it);
+  QP next = qp;
+  for (const auto& key_dim : dims) {
+    const size_t n = key_dim.second;
+    next.cost.push_back(HessianFactor(JacobianFactor(
+        key_dim.first, 0.1 * Matrix::Identity(n, n), 0.1 * Vector::Ones(n))));
+  }
+  return next;
+}
+
+// Cold start, and warm start from the solution before the perturbation
+void qps(State& state, const std::string& file) {
+  const QP qp = QPSParser(file).Parse();
+  const QP next = perturbed(qp);
+  const Solution previous = QPSolver(qp).optimize();
+  const KeySet active = workingSet(previous.second);
+  state.measure("cold", [&] { return QPSolver(next).optimize(); });
+  state.measure("warm", [&] {
+    return QPSolver(next).optimize(previous.first, active);
+  });
+  state.counter("active", active.size());
+}
+
+/*
+ * Model predictive control of a double integrator with a bounded input,
+ * min sum_k |x_k|^2 + 0.1 u_k^2 s.t. x_{k+1} = A x_k + B u_k, |u_k| <= 1,
+ * |v_k| <= 2, over a horizon of N steps from x_0. Only the right-hand side of
+ * the first dynamics constraint depends on x_0.
+ */
+class DoubleIntegrator {
+ public:
+  DoubleIntegrator(size_t horizon) : N_(horizon) {
+    A_ << 1, dt_, 0, 1;
+    B_ << 0.5 * dt_ * dt_, dt_;
+  }
+
+  QP problem(const Vector2& x0) const {
+    using symbol_shorthand::U;
+    using symbol_shorthand::X;
+    QP qp;
+    size_t dualKey = 0;
+    for (size_t k = 0; k < N_; ++k) {
+      qp.cost.push_back(HessianFactor(JacobianFactor(X(k + 1), I_2x2, Z_2x1)));
+      qp.cost.push_back(HessianFactor(
+          JacobianFactor(U(k), std::sqrt(0.1) * I_1x1, Z_1x1)));
+      if (k == 0)
+        qp.equalities.push_back(
+            LinearEquality(X(1), I_2x2, U(0), -B_, A_ * x0, dualKey++));
+      else
+        qp.equalities.push_back(LinearEquality(X(k + 1), I_2x2, X(k), -A_,
+                                               U(k), -B_, Z_2x1, dualKey++));
+      qp.inequalities.push_back(LinearInequality(U(k), I_1x1, 1, dualKey++));
+      qp.inequalities.push_back(LinearInequality(U(k), -I_1x1, 1, dualKey++));
+      const Matrix12 v(0, 1);
+      qp.inequalities.push_back(LinearInequality(X(k + 1), v, 2, dualKey++));
+      qp.inequalities.push_back(LinearInequality(X(k + 1), -v, 2, dualKey++));
+    }
+    return qp;
+  }
+
+  Vector2 step(const Vector2& x, const VectorValues& solution) const {
+    return A_ * x + B_ * solution.at(symbol_shorthand::U(0));
+  }
+
+ private:
+  const size_t N_;
+  const double dt_ = 0.1;
+  Matrix2 A_;
+  Vector2 B_;
+};
+
+// Closed loop from far away: the input saturates at first
+void mpc(State& state, size_t horizon, bool warm) {
+  const size_t nrSteps = 30;
+  const DoubleIntegrator model(horizon);
+  state.measureOnce(warm ? "warm" : "cold", [&] {
+    Vector2 x(5, 0);
+    Solution solution;
+    for (size_t t = 0; t < nrSteps; ++t) {
+      const QP qp = model.problem(x);
+      if (warm && t > 0)
+        solution = QPSolver(qp).optimize(solution.first,
+                                         workingSet(solution.second));
+      else
+        solution = QPSolver(qp).optimize();
+      x = model.step(x, solution.first);
+    }
+    return x;
+  });
+  state.counter("steps", nrSteps);
+}
+
+}  // namespace
+
+BENCHMARK(QPS, HS21) { qps(state, "HS21.QPS"); }
+BENCHMARK(QPS, HS35) { qps(state, "HS35.QPS"); }
+BENCHMARK(QPS, HS35MOD) { qps(state, "HS35MOD.QPS"); }
+BENCHMARK(QPS, HS51) { qps(state, "HS51.QPS"); }
+BENCHMARK(QPS, HS52) { qps(state, "HS52.QPS"); }
+BENCHMARK(QPS, HS268) { qps(state, "HS268.QPS"); }
+BENCHMARK(QPS, QPTEST) { qps(state, "QPTEST.QPS"); }
+
+BENCHMARK(MPC, Horizon10) {
+  mpc(state, 10, false);
+  mpc(state, 10, true);
+}
+
+BENCHMARK(MPC, Horizon15) {
+  mpc(state, 15, false);
+  mpc(state, 15, true);
+}
+
+int main(int argc, char* argv[]) { return runAll(argc, argv); }
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchQPSParser.cpp
+ * @brief   Throughput of reading QPS files
+ * @date    October 2026
+ *
+ * "examples" reads all QPS files in examples/Data, and the "Generated" cases
+ * read larger files with the structure of the Maros-Meszaros problems: a
+ * banded Hessian, a few nonzeros per column, ranges and all kinds of bounds.
+ * Every case reports its throughput in MB/s of text.
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam_unstable/linear/QPSParser.h>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+
+/* ************************************************************************* */
+double fileSizeMB(const string& filename) {
+  ifstream is(filename.c_str(), ios::binary | ios::ate);
+  return is.tellg() / 1e6;
+}
+
+// Attach the throughput of the most recent measurement
+void reportThroughput(benchmark::State& state, double megabytes) {
+  state.counter("MB/s", megabytes / (state.results().back().median * 1e-9));
+}
+
+/* ************************************************************************* */
+// Write a temporary QPS file with n variables and m constraints, and return
+// its name
+string writeQPS(size_t n, size_t m) {
+  const string filename =
+      (boost::filesystem::temp_directory_path() /
+       boost::filesystem::unique_path("benchQPSParser-%%%%-%%%%.QPS"))
+          .string();
+  FILE* file = fopen(filename.c_str(), "w");
+  if (!file) throw runtime_error("benchQPSParser: cannot write " + filename);
+  fprintf(file, "NAME          GEN%zu\nROWS\n N  COST\n", n);
+  const char types[] = {'E', 'L', 'G'};
+  for (size_t i = 0; i < m; ++i)
+    fprintf(file, " %c  R%07zu\n", types[i % 3], i);
+
+  // Column j has a linear cost and appears in rows j, j + 1 and j + 2 mod m
+  fprintf(file, "COLUMNS\n");
+  for (size_t j = 0; j < n; ++j) {
+    fprintf(file, "    C%07zu  COST      %12.6e   R%07zu  %12.6e\n", j,
+            0.5 + (j % 7), j % m, 1.0 + (j % 5));
+    fprintf(file, "    C%07zu  R%07zu  %12.6e   R%07zu  %12.6e\n", j,
+            (j + 1) % m, -0.25 * (j % 3 + 1), (j + 2) % m, 0.125);
+  }
+  fprintf(file, "RHS\n");
+  for (size_t i = 0; i < m; i += 2)
+    fprintf(file, "    RHS       R%07zu  %12.6e   R%07zu  %12.6e\n", i,
+            1.0 + (i % 11), i + 1 < m ? i + 1 : i, -2.0);
+  fprintf(file, "RANGES\n");
+  for (size_t i = 0; i < m; i += 10)
+    fprintf(file, "    RNG       R%07zu  %12.6e\n", i, 4.0);
+  fprintf(file, "BOUNDS\n");
+  for (size_t j = 0; j < n; ++j) {
+    if (j % 4 == 0) fprintf(file, " UP BND       C%07zu  %12.6e\n", j, 10.0);
+    if (j % 4 == 1) fprintf(file, " LO BND       C%07zu  %12.6e\n", j, -5.0);
+    if (j % 4 == 2) fprintf(file, " FR BND       C%07zu\n", j);
+  }
+  // Banded Hessian, lower triangle by columns
+  fprintf(file, "QUADOBJ\n");
+  for (size_t j = 0; j < n; ++j) {
+    fprintf(file, "    C%07zu  C%07zu  %12.6e\n", j, j, 4.0);
+    if (j + 1 < n)
+      fprintf(file, "    C%07zu  C%07zu  %12.6e\n", j, j + 1, -1.0);
+  }
+  fprintf(file, "ENDATA\n");
+  fclose(file);
+  return filename;
+}
+
+/* ************************************************************************* */
+void generated(benchmark::State& state, size_t n) {
+  const string filename = writeQPS(n, n / 2);
+  state.setMaxRepetitions(5);
+  state.measureOnce("parse", [&] { return QPSParser(filename).Parse(); });
+  reportThroughput(state, fileSizeMB(filename));
+  remove(filename.c_str());
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(QPSParser, examples) {
+  const vector<string> files = {"HS21.QPS",  "HS35.QPS",  "HS35MOD.QPS",
+                                "HS51.QPS",  "HS52.QPS",  "HS268.QPS",
+                                "QPTEST.QPS", "QPExample.QPS"};
+  double megabytes = 0;
+  for (const string& file : files)
+    megabytes += fileSizeMB(findExampleDataFile(file));
+  state.measure("parse", [&] {
+    size_t nrFactors = 0;
+    for (const string& file : files) {
+      const QP qp = QPSParser(file).Parse();
+      nrFactors += qp.equalities.size() + qp.inequalities.size();
+    }
+    return nrFactors;
+  });
+  reportThroughput(state, megabytes);
+}
+
+/* ************************************************************************* */
+BENCHMARK(QPSParser, Generated500) { generated(state, 500); }
+BENCHMARK(QPSParser, Generated2000) { generated(state, 2000); }
+
+int main(int argc, char* argv[]) { return benchmark::runAll(argc, argv); }
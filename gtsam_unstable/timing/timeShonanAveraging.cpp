@@ -36,9 +36,22 @@ using namespace gtsam;
 
 // save a single line of timing info to an output stream
 void saveData(size_t p, double time1, double costP, double cost3, double time2,
-              double min_eigenvalue, double suBound, std::ostream* os) {
+              double min_eigenvalue, double suBound, double timeCold,
+              double timeWarm, double timeLambdaQ, double timeA,
+              std::ostream* os) {
   *os << static_cast<int>(p) << "\t" << time1 << "\t" << costP << "\t" << cost3
-      << "\t" << time2 << "\t" << min_eigenvalue << "\t" << suBound << endl;
+      << "\t" << time2 << "\t" << min_eigenvalue << "\t" << suBound << "\t"
+      << timeCold << "\t" << timeWarm << "\t" << timeLambdaQ << "\t" << timeA
+      << endl;
+}
+
+// time a function call in seconds
+template <class F>
+double timeIt(F&& f) {
+  chrono::steady_clock::time_point t1 = chrono::steady_clock::now();
+  f();
+  chrono::steady_clock::time_point t2 = chrono::steady_clock::now();
+  return chrono::duration_cast<chrono::duration<double>>(t2 - t1).count();
 }
 
 void checkR(const Matrix& R) {
@@ -143,7 +156,13 @@ int main(int argc, char* argv[]) {
     Vector minEigenVector;
     double CostP = 0, Cost3 = 0, lambdaMin = 0, suBound = 0;
     cout << "(int)p" << "\t" << "time1" << "\t" << "costP" << "\t" << "cost3" << "\t"
-        << "time2" << "\t" << "MinEigenvalue" << "\t" << "SuBound" << endl;
+        << "time2" << "\t" << "MinEigenvalue" << "\t" << "SuBound" << "\t"
+        << "timeCold" << "\t" << "timeWarm" << "\t" << "timeLambdaQ" << "\t"
+        << "timeA" << endl;
+
+    // Eigenvectors carried over from level to level, as in ShonanAveraging::run
+    ShonanAveraging3::CertificateEigenvectors eigenvectors;
+    const ShonanAveraging3::Sparse Q = kShonan.Q();
 
     const Values randomRotations = kShonan.initializeRandomly();
 
@@ -169,12 +188,33 @@ int main(int argc, char* argv[]) {
         Cost3 = kShonan.cost(SO3Values);
         suBound = (Cost3 - CostP) / CostP;
 
+        // Certificate: cold Lanczos starts versus warm starts from the
+        // eigenvectors of the previous level
+        const double timeCold =
+            timeIt([&] { kShonan.computeMinEigenValue(result); });
+        const double timeWarm =
+            timeIt([&] { kShonan.computeMinEigenValue(result, eigenvectors); });
+
+        // A = Lambda - Q from scratch versus in the precomputed pattern
+        const Matrix S = ShonanAveraging3::StiefelElementMatrix(result);
+        ShonanAveraging3::Sparse A;
+        const double timeLambdaQ =
+            timeIt([&] { A = kShonan.computeLambda(S) - Q; });
+        const double timeA = timeIt([&] { A = kShonan.computeA(S); });
+
         saveData(p, timeUsed1.count(), CostP, Cost3, timeUsed2.count(),
-                 lambdaMin, suBound, &cout);
+                 lambdaMin, suBound, timeCold, timeWarm, timeLambdaQ, timeA,
+                 &cout);
         saveData(p, timeUsed1.count(), CostP, Cost3, timeUsed2.count(),
-                 lambdaMin, suBound, &csvFile);
+                 lambdaMin, suBound, timeCold, timeWarm, timeLambdaQ, timeA,
+                 &csvFile);
     }
     saveResult(name, kShonan.roundSolution(Qstar));
+
+    // The whole Riemannian staircase, which warm-starts every certificate
+    const double timeRun =
+        timeIt([&] { kShonan.run(randomRotations, pMin, 7); });
+    cout << "run: " << timeRun << endl;
     // saveG2oResult(name, kShonan.roundSolution(Qstar), kShonan.Poses());
     return 0;
 }
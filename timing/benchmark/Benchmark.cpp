@@ -0,0 +1,359 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Benchmark.cpp
+ * @brief   Benchmark harness: calibration, statistics, reporting
+ * @date    October 2026
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/config.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+namespace gtsam {
+namespace benchmark {
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+/// Wall-clock duration of loop(n), in seconds.
+double timeLoop(const function<void(size_t)>& loop, size_t n) {
+  const Clock::time_point start = Clock::now();
+  loop(n);
+  return chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Format a duration given in nanoseconds with a readable unit.
+string formatTime(double ns) {
+  ostringstream os;
+  os << fixed << setprecision(3);
+  if (ns < 1e3)
+    os << ns << " ns";
+  else if (ns < 1e6)
+    os << ns * 1e-3 << " us";
+  else if (ns < 1e9)
+    os << ns * 1e-6 << " ms";
+  else
+    os << ns * 1e-9 << " s";
+  return os.str();
+}
+
+void printHeader() {
+  cout << left << setw(56) << "Benchmark" << right << setw(12) << "Iterations"
+       << setw(14) << "Median" << setw(14) << "Mean" << setw(10) << "CV"
+       << endl;
+  cout << string(106, '-') << endl;
+}
+
+void printResult(const Result& r) {
+  const double cv = r.mean > 0 ? 100.0 * r.stddev / r.mean : 0.0;
+  ostringstream cvs;
+  cvs << fixed << setprecision(1) << cv << "%";
+  cout << left << setw(56) << r.name << right << setw(12) << r.iterations
+       << setw(14) << formatTime(r.median) << setw(14) << formatTime(r.mean)
+       << setw(10) << cvs.str();
+  for (const auto& c : r.counters) cout << "  " << c.first << "=" << c.second;
+  cout << endl;
+}
+
+string escape(const string& s) {
+  string out;
+  for (char c : s) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+/// JSON has no representation of nan or inf
+string number(double x) {
+  if (!std::isfinite(x)) return "null";
+  ostringstream os;
+  os << setprecision(10) << x;
+  return os.str();
+}
+
+void usage(const char* program) {
+  cout << "Usage: " << program << " [options]\n"
+       << "  --list                 list benchmark cases and exit\n"
+       << "  --filter <substring>   only run cases whose name contains it\n"
+       << "  --repetitions <n>      timed repetitions per case (default 10)\n"
+       << "  --warmup <n>           untimed repetitions per case (default 1)\n"
+       << "  --min-time <seconds>   minimum repetition length (default 0.05)\n"
+       << "  --json <file>          write results as JSON\n"
+       << "  --param <key>=<value>  parameter passed to cases, e.g. a dataset\n";
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+vector<const Benchmark*>& registry() {
+  static vector<const Benchmark*> benchmarks;
+  return benchmarks;
+}
+
+/* ************************************************************************* */
+void registerBenchmark(const string& group, const string& name,
+                       const FunctionBenchmark::Function& function) {
+  static vector<unique_ptr<FunctionBenchmark> > owned;
+  owned.emplace_back(new FunctionBenchmark(group, name, function));
+}
+
+/* ************************************************************************* */
+Benchmark::Benchmark(const string& group, const string& name)
+    : name_(group + "/" + name) {
+  registry().push_back(this);
+}
+
+/* ************************************************************************* */
+void State::counter(const string& key, double value) {
+  if (results_.empty())
+    throw logic_error("State::counter: called before any measurement");
+  results_.back().counters[key] = value;
+}
+
+/* ************************************************************************* */
+void State::series(const string& key, const vector<double>& values) {
+  if (results_.empty())
+    throw logic_error("State::series: called before any measurement");
+  results_.back().series[key] = values;
+}
+
+/* ************************************************************************* */
+string State::parameter(const string& key, const string& defaultValue) const {
+  auto it = options_.parameters.find(key);
+  return it == options_.parameters.end() ? defaultValue : it->second;
+}
+
+/* ************************************************************************* */
+void State::run(const string& label, const Loop& loop) {
+  // Grow the number of calls until one repetition takes at least minTime
+  size_t n = 1;
+  for (;;) {
+    const double elapsed = timeLoop(loop, n);
+    if (elapsed >= options_.minTime) break;
+    const double factor =
+        elapsed > 0 ? 1.2 * options_.minTime / elapsed : 100.0;
+    n = static_cast<size_t>(ceil(n * min(max(factor, 2.0), 100.0)));
+  }
+
+  for (size_t i = 0; i < options_.warmup; i++) loop(n);
+  record(label, n, loop);
+}
+
+/* ************************************************************************* */
+void State::runOnce(const string& label, const Loop& loop) {
+  record(label, 1, loop);
+}
+
+/* ************************************************************************* */
+void State::record(const string& label, size_t iterations, const Loop& loop) {
+  const size_t repetitions = max<size_t>(
+      1, min(options_.repetitions, maxRepetitions_));
+  vector<double> samples(repetitions);
+  for (double& sample : samples)
+    sample = 1e9 * timeLoop(loop, iterations) / iterations;
+
+  Result r;
+  r.name = label.empty() ? name_ : name_ + "/" + label;
+  r.iterations = iterations;
+  r.repetitions = repetitions;
+  r.mean = accumulate(samples.begin(), samples.end(), 0.0) / repetitions;
+  double sq = 0.0;
+  for (double sample : samples) sq += (sample - r.mean) * (sample - r.mean);
+  r.stddev = repetitions > 1 ? sqrt(sq / (repetitions - 1)) : 0.0;
+  r.min = *min_element(samples.begin(), samples.end());
+  r.max = *max_element(samples.begin(), samples.end());
+  sort(samples.begin(), samples.end());
+  r.median = repetitions % 2
+                 ? samples[repetitions / 2]
+                 : 0.5 * (samples[repetitions / 2 - 1] +
+                          samples[repetitions / 2]);
+  results_.push_back(r);
+}
+
+/* ************************************************************************* */
+void writeJson(const string& filename, const Options& options,
+               const vector<Result>& results) {
+  ofstream os(filename);
+  if (!os) throw runtime_error("writeJson: cannot open " + filename);
+
+  char date[32];
+  const time_t now = time(nullptr);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  os << "{\n  \"context\": {\n";
+  os << "    \"date\": \"" << date << "\",\n";
+  os << "    \"gtsam_version\": \"" << GTSAM_VERSION_STRING << "\",\n";
+#ifdef NDEBUG
+  os << "    \"assertions\": false,\n";
+#else
+  os << "    \"assertions\": true,\n";
+#endif
+  os << "    \"repetitions\": " << options.repetitions << ",\n";
+  os << "    \"warmup\": " << options.warmup << ",\n";
+  os << "    \"min_time\": " << number(options.minTime) << ",\n";
+  os << "    \"parameters\": {";
+  for (auto it = options.parameters.begin(); it != options.parameters.end();
+       ++it) {
+    os << (it == options.parameters.begin() ? "" : ", ") << "\""
+       << escape(it->first) << "\": \"" << escape(it->second) << "\"";
+  }
+  os << "}\n  },\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& r = results[i];
+    os << (i ? ",\n" : "\n") << "    {\"name\": \"" << escape(r.name)
+       << "\", \"iterations\": " << r.iterations
+       << ", \"repetitions\": " << r.repetitions
+       << ", \"median_ns\": " << number(r.median)
+       << ", \"mean_ns\": " << number(r.mean)
+       << ", \"stddev_ns\": " << number(r.stddev)
+       << ", \"min_ns\": " << number(r.min)
+       << ", \"max_ns\": " << number(r.max) << ", \"counters\": {";
+    for (auto it = r.counters.begin(); it != r.counters.end(); ++it)
+      os << (it == r.counters.begin() ? "" : ", ") << "\""
+         << escape(it->first) << "\": " << number(it->second);
+    os << "}";
+    if (!r.series.empty()) {
+      os << ", \"series\": {";
+      for (auto it = r.series.begin(); it != r.series.end(); ++it) {
+        os << (it == r.series.begin() ? "" : ", ") << "\""
+           << escape(it->first) << "\": [";
+        for (size_t k = 0; k < it->second.size(); k++)
+          os << (k ? ", " : "") << number(it->second[k]);
+        os << "]";
+      }
+      os << "}";
+    }
+    os << "}";
+  }
+  os << "\n  ]\n}\n";
+}
+
+/* ************************************************************************* */
+int runAll(int argc, char* argv[], const Options& defaults) {
+  Options options = defaults;
+  for (int i = 1; i < argc; i++) {
+    const string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--list") {
+      options.list = true;
+    } else if (arg == "--filter" && hasValue) {
+      options.filter = argv[++i];
+    } else if (arg == "--repetitions" && hasValue) {
+      options.repetitions = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--warmup" && hasValue) {
+      options.warmup = strtoul(argv[++i], nullptr, 10);
+    } else if (arg == "--min-time" && hasValue) {
+      options.minTime = atof(argv[++i]);
+    } else if (arg == "--json" && hasValue) {
+      options.jsonFile = argv[++i];
+    } else if (arg == "--param" && hasValue) {
+      const string kv = argv[++i];
+      const size_t eq = kv.find('=');
+      if (eq == string::npos) {
+        usage(argv[0]);
+        return 1;
+      }
+      options.parameters[kv.substr(0, eq)] = kv.substr(eq + 1);
+    } else {
+      usage(argv[0]);
+      return arg == "--help" ? 0 : 1;
+    }
+  }
+
+  vector<const Benchmark*> selected;
+  for (const Benchmark* benchmark : registry())
+    if (benchmark->name().find(options.filter) != string::npos)
+      selected.push_back(benchmark);
+
+  if (options.list) {
+    for (const Benchmark* benchmark : selected)
+      cout << benchmark->name() << endl;
+    return 0;
+  }
+
+  int status = 0;
+  vector<Result> results;
+  printHeader();
+  for (const Benchmark* benchmark : selected) {
+    State state(benchmark->name(), options);
+    try {
+      benchmark->run(state);
+    } catch (const exception& e) {
+      cerr << benchmark->name() << " failed: " << e.what() << endl;
+      status = 1;
+    }
+    for (const Result& r : state.results()) {
+      printResult(r);
+      results.push_back(r);
+    }
+  }
+
+  if (!options.jsonFile.empty()) writeJson(options.jsonFile, options, results);
+  return status;
+}
+
+/* ************************************************************************* */
+void resetPeakMemory() {
+#ifdef __linux__
+  // Writing 5 resets VmHWM on Linux >= 4.0, otherwise this has no effect
+  ofstream clearRefs("/proc/self/clear_refs");
+  if (clearRefs) clearRefs << "5";
+#endif
+}
+
+/* ************************************************************************* */
+double peakMemoryMB() {
+#ifdef __linux__
+  ifstream status("/proc/self/status");
+  string line;
+  while (getline(status, line))
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return atof(line.c_str() + 6) / 1024.0;  // reported in kB
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);  // bytes
+#else
+    return usage.ru_maxrss / 1024.0;  // kB
+#endif
+  }
+#endif
+  return numeric_limits<double>::quiet_NaN();
+}
+
+}  // namespace benchmark
+}  // namespace gtsam
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    Benchmark.h
+ * @brief   Minimal benchmark harness: named cases, warmup, repetition
+ *          statistics and JSON output.
+ * @date    October 2026
+ *
+ * Benchmarks are declared much like CppUnitLite tests:
+ *
+ *   BENCHMARK(Rot3, Expmap) {
+ *     const Vector3 v(0.1, 0.4, 0.2);
+ *     state.measure([&] { return Rot3::Expmap(v); });
+ *   }
+ *
+ * Everything outside of the lambda passed to State::measure is setup and is
+ * not timed. The runner first calibrates the number of calls per repetition
+ * so that one repetition takes at least --min-time seconds, runs --warmup
+ * untimed repetitions, and then records --repetitions timed repetitions from
+ * which per-call statistics are computed. Results are printed as a table and
+ * can be written as JSON with --json, to be compared with compare.py.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+namespace benchmark {
+
+/// Prevent the compiler from optimizing away a computed value.
+template <class T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "g"(&value) : "memory");
+#else
+  static const void* volatile sink;
+  sink = &value;
+#endif
+}
+
+/// Options controlling how every case is measured, set from the command line.
+struct Options {
+  std::string filter;        ///< only run cases whose name contains this
+  size_t repetitions = 10;   ///< number of timed repetitions
+  size_t warmup = 1;         ///< number of untimed repetitions
+  double minTime = 0.05;     ///< minimum duration of one repetition, seconds
+  std::string jsonFile;      ///< write results here if not empty
+  bool list = false;         ///< only list the registered cases
+  std::map<std::string, std::string> parameters;  ///< --param key=value
+};
+
+/// Per-call timing statistics of one measurement, in nanoseconds.
+struct Result {
+  std::string name;         ///< group/case[/label]
+  size_t iterations = 0;    ///< calls per repetition
+  size_t repetitions = 0;   ///< number of timed repetitions
+  double mean = 0, median = 0, min = 0, max = 0, stddev = 0;
+  std::map<std::string, double> counters;  ///< user-reported values
+  std::map<std::string, std::vector<double> > series;  ///< e.g. per iteration
+};
+
+/**
+ * Handed to each benchmark case. A case performs its setup and then calls
+ * measure() one or more times; each call produces one Result.
+ */
+class State {
+ public:
+  State(const std::string& name, const Options& options)
+      : name_(name), options_(options), maxRepetitions_(options.repetitions) {}
+
+  /// Time f(), which may return a value that is kept from being optimized out.
+  template <class F>
+  void measure(F&& f) {
+    measure(std::string(), std::forward<F>(f));
+  }
+
+  /// Time f() and report the result under the given label.
+  template <class F>
+  void measure(const std::string& label, F&& f) {
+    typedef typename std::is_void<decltype(f())>::type ReturnsVoid;
+    run(label, [&f](size_t n) { loop(f, n, ReturnsVoid()); });
+  }
+
+  /**
+   * Time a single call to f() per repetition, without calibration. Use for
+   * end-to-end cases (e.g., a complete optimization) that take long enough
+   * to be timed individually.
+   */
+  template <class F>
+  void measureOnce(const std::string& label, F&& f) {
+    typedef typename std::is_void<decltype(f())>::type ReturnsVoid;
+    runOnce(label, [&f](size_t n) { loop(f, n, ReturnsVoid()); });
+  }
+
+  /// Cap the number of timed repetitions for expensive cases.
+  void setMaxRepetitions(size_t n) { maxRepetitions_ = n; }
+
+  /// Attach a value, e.g. a final error, to the most recent measurement.
+  void counter(const std::string& key, double value);
+
+  /// Attach a sequence of values, e.g. the duration of every iteration of an
+  /// optimizer, to the most recent measurement.
+  void series(const std::string& key, const std::vector<double>& values);
+
+  /// Return a --param value, or the given default if it was not specified.
+  std::string parameter(const std::string& key,
+                        const std::string& defaultValue) const;
+
+  /// Results of all measurements done so far.
+  const std::vector<Result>& results() const { return results_; }
+
+ private:
+  typedef std::function<void(size_t)> Loop;
+
+  template <class F>
+  static void loop(F& f, size_t n, std::false_type) {
+    for (size_t i = 0; i < n; ++i) doNotOptimize(f());
+  }
+
+  template <class F>
+  static void loop(F& f, size_t n, std::true_type) {
+    for (size_t i = 0; i < n; ++i) f();
+  }
+
+  void run(const std::string& label, const Loop& loop);
+  void runOnce(const std::string& label, const Loop& loop);
+  void record(const std::string& label, size_t iterations, const Loop& loop);
+
+  std::string name_;
+  const Options& options_;
+  size_t maxRepetitions_;
+  std::vector<Result> results_;
+};
+
+/// Base class of registered benchmark cases, see BENCHMARK below.
+class Benchmark {
+ public:
+  Benchmark(const std::string& group, const std::string& name);
+  virtual ~Benchmark() {}
+  virtual void run(State& state) const = 0;
+
+  /// Full name, group/name
+  const std::string& name() const { return name_; }
+
+ private:
+  std::string name_;
+};
+
+/// A case whose body is a function object, for suites that generate their
+/// cases from a table rather than declaring each one with BENCHMARK.
+class FunctionBenchmark : public Benchmark {
+ public:
+  typedef std::function<void(State&)> Function;
+  FunctionBenchmark(const std::string& group, const std::string& name,
+                    const Function& function)
+      : Benchmark(group, name), function_(function) {}
+  void run(State& state) const override { function_(state); }
+
+ private:
+  Function function_;
+};
+
+/// Create and register a FunctionBenchmark that lives until program exit.
+void registerBenchmark(const std::string& group, const std::string& name,
+                       const FunctionBenchmark::Function& function);
+
+/// All cases registered in this executable, in registration order.
+std::vector<const Benchmark*>& registry();
+
+/**
+ * Parse the command line, run the selected cases and report. Returns 0 on
+ * success, so it can be returned from main. Command-line options override
+ * the given defaults.
+ */
+int runAll(int argc, char* argv[], const Options& defaults = Options());
+
+/// Reset the peak resident set size of this process, where supported.
+void resetPeakMemory();
+
+/// Peak resident set size of this process in MB, or NaN if unknown.
+double peakMemoryMB();
+
+/// Write results as JSON, readable by compare.py.
+void writeJson(const std::string& filename, const Options& options,
+               const std::vector<Result>& results);
+
+}  // namespace benchmark
+}  // namespace gtsam
+
+/// Declare and register a benchmark case. The body receives `state`.
+#define BENCHMARK(group, name)                                              \
+  class group##name##Benchmark : public gtsam::benchmark::Benchmark {       \
+   public:                                                                  \
+    group##name##Benchmark() : gtsam::benchmark::Benchmark(#group, #name) {} \
+    void run(gtsam::benchmark::State& state) const override;                \
+  } group##name##BenchmarkInstance;                                         \
+  void group##name##Benchmark::run(gtsam::benchmark::State& state) const
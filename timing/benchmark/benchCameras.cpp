@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchCameras.cpp
+ * @brief   Camera projection benchmarks, ported from timeCalibratedCamera.cpp, timePinholeCamera.cpp and timeStereoCamera.cpp
+ * The CameraSet cases project 1000 points into 10 cameras point by point and
+ * with CameraSet::projectBatch.
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/CalibratedCamera.h>
+#include <gtsam/geometry/CameraSet.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/StereoCamera.h>
+
+using namespace gtsam;
+
+namespace {
+const Pose3 pose1(Rot3(Vector3(1, -1, -1).asDiagonal()), Point3(0, 0, 0.5));
+const Point3 point1(-0.08, -0.08, 0.0);
+
+/// Time projecting M points into N cameras, one by one and batched
+template <class CALIBRATION>
+void projectSet(benchmark::State& state, const CALIBRATION& K) {
+  typedef PinholeCamera<CALIBRATION> Camera;
+  const size_t N = 10, M = 1000;
+  CameraSet<Camera> cameras;
+  for (size_t i = 0; i < N; i++)
+    cameras.emplace_back(
+        Pose3(Rot3::Ypr(0.1 * i, 0.05, -0.1), Point3(0.2 * i, 0, -10)), K);
+  Vector3Batch points(M, 3);
+  std::vector<Point3> pointVector;
+  for (size_t j = 0; j < M; j++) {
+    pointVector.emplace_back(std::sin(j), std::cos(3.0 * j), 0.1 * (j % 7));
+    points.row(j) = pointVector.back().transpose().array();
+  }
+
+  std::vector<Point2> z(N * M);
+  std::vector<Matrix26, Eigen::aligned_allocator<Matrix26> > Dpose(N * M);
+  std::vector<Matrix23, Eigen::aligned_allocator<Matrix23> > Dpoint(N * M);
+  state.measure("perPoint", [&] {
+    for (size_t i = 0; i < N; i++)
+      for (size_t j = 0; j < M; j++)
+        z[i * M + j] = cameras[i].project(pointVector[j], Dpose[i * M + j],
+                                          Dpoint[i * M + j]);
+    return z.back();
+  });
+  state.counter("projections", N * M);
+  const double perPointTime = state.results().back().median;
+
+  state.measure("batch", [&] {
+    cameras.projectBatch(points, z.data(), Dpose.data(), Dpoint.data());
+    return z.back();
+  });
+  state.counter("projections", N * M);
+  state.counter("speedup", perPointTime / state.results().back().median);
+}
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(CalibratedCamera, project) {
+  const CalibratedCamera camera(pose1);
+  Matrix Dpose, Dpoint;
+  state.measure([&] { return camera.project(point1, Dpose, Dpoint); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(PinholeCamera, project) {
+  const Cal3Bundler K(500, 1e-3, 2.0 * 1e-3);
+  const PinholeCamera<Cal3Bundler> camera(pose1, K);
+  const Point2 measurement(0, 0);
+  Matrix Dpose, Dpoint, Dcal;
+  state.measure([&] { return camera.project(point1); });
+  state.measure("error", [&] { return camera.project(point1) - measurement; });
+  state.measure("derivatives", [&] {
+    return camera.project(point1, Dpose, Dpoint, boost::none);
+  });
+  state.measure("allDerivatives", [&] {
+    return camera.project(point1, Dpose, Dpoint, Dcal);
+  });
+}
+
+/* ************************************************************************* */
+BENCHMARK(StereoCamera, project) {
+  const Cal3_S2Stereo::shared_ptr K(
+      new Cal3_S2Stereo(1500, 1500, 0, 320, 240, 0.5));
+  const StereoCamera camera(pose1, K);
+  Matrix Dpose, Dpoint;
+  state.measure([&] { return camera.project(point1, Dpose, Dpoint); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(CameraSet, projectCal3_S2) {
+  projectSet(state, Cal3_S2(500, 500, 0, 320, 240));
+}
+
+/* ************************************************************************* */
+BENCHMARK(CameraSet, projectCal3Bundler) {
+  projectSet(state, Cal3Bundler(500, 1e-3, 2e-3, 320, 240));
+}
+
+/* ************************************************************************* */
+BENCHMARK(CameraSet, projectCal3DS2) {
+  projectSet(state, Cal3DS2(500, 500, 0, 320, 240, 1e-3, 2e-3, 1e-4, -1e-4));
+}
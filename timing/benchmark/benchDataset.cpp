@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchDataset.cpp
+ * @brief   Throughput of reading and writing g2o/TORO and binary files
+ * @date    October 2026
+ *
+ * The "istream" cases parse line by line with operator>>, as the parseFactors
+ * and parseVariables functions still do and load2D/load3D used to, and the
+ * "mapped" cases go through the memory-mapped, chunked parser. Every case
+ * reports its throughput in MB/s of text.
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/slam/BinaryFile.h>
+#include <gtsam/slam/dataset.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+
+/* ************************************************************************* */
+double fileSizeMB(const string& filename) {
+  ifstream is(filename.c_str(), ios::binary | ios::ate);
+  return is.tellg() / 1e6;
+}
+
+// Attach the throughput of the most recent measurement
+void reportThroughput(benchmark::State& state, double megabytes) {
+  state.counter("MB/s", megabytes / (state.results().back().median * 1e-9));
+}
+
+/* ************************************************************************* */
+// writeG2o as it was before it was buffered: one stream insertion per token,
+// and a flush at the end of every line. Only writes what w20000 contains.
+void writeG2oStream(const NonlinearFactorGraph& graph, const Values& estimate,
+                    const string& filename) {
+  fstream stream(filename.c_str(), fstream::out);
+  for (const auto key_value : estimate) {
+    const Pose2& pose = key_value.value.cast<Pose2>();
+    stream << "VERTEX_SE2 " << key_value.key << " " << pose.x() << " "
+           << pose.y() << " " << pose.theta() << endl;
+  }
+  for (const auto& f : graph) {
+    auto factor = boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(f);
+    auto gaussian =
+        boost::dynamic_pointer_cast<noiseModel::Gaussian>(factor->noiseModel());
+    const Matrix3 Info = gaussian->R().transpose() * gaussian->R();
+    const Pose2& pose = factor->measured();
+    stream << "EDGE_SE2 " << factor->key1() << " " << factor->key2() << " "
+           << pose.x() << " " << pose.y() << " " << pose.theta();
+    for (size_t i = 0; i < 3; i++)
+      for (size_t j = i; j < 3; j++) stream << " " << Info(i, j);
+    stream << endl;
+  }
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Dataset, read2D) {
+  const string filename = findExampleDataFile("w20000.txt");
+  const double megabytes = fileSizeMB(filename);
+  state.setMaxRepetitions(5);
+
+  state.measureOnce("istream", [&] {
+    return make_pair(parseVariables<Pose2>(filename),
+                     parseFactors<Pose2>(filename));
+  });
+  reportThroughput(state, megabytes);
+
+  state.measureOnce("mapped", [&] { return load2D(filename); });
+  reportThroughput(state, megabytes);
+}
+
+/* ************************************************************************* */
+BENCHMARK(Dataset, read3D) {
+  const string filename = findExampleDataFile("sphere2500.txt");
+  const double megabytes = fileSizeMB(filename);
+  state.setMaxRepetitions(5);
+
+  state.measureOnce("istream", [&] {
+    return make_pair(parseVariables<Pose3>(filename),
+                     parseFactors<Pose3>(filename));
+  });
+  reportThroughput(state, megabytes);
+
+  state.measureOnce("mapped", [&] { return load3D(filename); });
+  reportThroughput(state, megabytes);
+
+  // The same graph in the binary format, for comparison
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = load3D(filename);
+  const string binaryFile = createRewrittenFileName(filename) + ".bin";
+  writeBinary(binaryFile, *graph, *initial);
+  state.measureOnce("binary", [&] { return readBinary(binaryFile); });
+  reportThroughput(state, megabytes);
+  remove(binaryFile.c_str());
+}
+
+/* ************************************************************************* */
+BENCHMARK(Dataset, write2D) {
+  const string filename = findExampleDataFile("w20000.txt");
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = readG2o(filename);
+  const string output = createRewrittenFileName(filename);
+  state.setMaxRepetitions(5);
+
+  state.measureOnce("stream", [&] { writeG2oStream(*graph, *initial, output); });
+  reportThroughput(state, fileSizeMB(output));
+
+  state.measureOnce("buffered", [&] { writeG2o(*graph, *initial, output); });
+  reportThroughput(state, fileSizeMB(output));
+  remove(output.c_str());
+}
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchDiscrete.cpp
+ * @brief   Discrete factor and inference benchmarks
+ * @date    October 2026
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/DiscreteMarginals.h>
+
+#include <random>
+#include <sstream>
+
+using namespace gtsam;
+
+namespace {
+// Random table with n entries in [lo, hi], as a string
+std::string randomTable(size_t n, int lo, int hi, std::mt19937* rng) {
+  std::uniform_int_distribution<int> uniform(lo, hi);
+  std::stringstream ss;
+  for (size_t i = 0; i < n; i++) ss << uniform(*rng) << " ";
+  return ss.str();
+}
+
+// Ternary-state ladder: a chain of pairs with rungs and diagonals, with table
+// entries in [lo, hi], e.g., [0, 1] for constraints
+DiscreteFactorGraph ladder(size_t length, int lo = 1, int hi = 9) {
+  std::mt19937 rng(42);
+  DiscreteFactorGraph graph;
+  auto key = [](size_t i, size_t j) { return DiscreteKey(2 * i + j, 3); };
+  for (size_t i = 0; i < length; i++) {
+    graph.add(key(i, 0) & key(i, 1), randomTable(9, lo, hi, &rng));
+    if (i == 0) continue;
+    for (size_t j = 0; j < 2; j++)
+      graph.add(key(i - 1, j) & key(i, j), randomTable(9, lo, hi, &rng));
+    graph.add(key(i - 1, 0) & key(i - 1, 1) & key(i, 0),
+              randomTable(27, lo, hi, &rng));
+  }
+  return graph;
+}
+
+// The chain from examples/UGM_chain.cpp
+DiscreteFactorGraph ugmChain(size_t nrNodes = 60) {
+  DiscreteFactorGraph graph;
+  auto node = [](size_t i) { return DiscreteKey(i, 7); };
+  graph.add(node(0), ".3 .6 .1 0 0 0 0");
+  for (size_t i = 1; i < nrNodes; i++) graph.add(node(i), "1 1 1 1 1 1 1");
+  const std::string edgePotential =
+      ".08 .9 .01 0 0 0 .01 .03 .95 .01 0 0 0 .01 "
+      ".06 .06 .75 .05 .05 .02 .01 0 0 0 .3 .6 .09 .01 "
+      "0 0 0 .02 .95 .02 .01 0 0 0 .01 .01 .97 .01 0 0 0 0 0 0 1";
+  for (size_t i = 0; i + 1 < nrNodes; i++)
+    graph.add(node(i) & node(i + 1), edgePotential);
+  return graph;
+}
+
+// Hidden Markov model with random transition and emission probabilities, as
+// the factor graph of the states given the measurements
+DiscreteFactorGraph hmm(size_t length, size_t nrStates) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0.01, 1.0);
+  DiscreteFactorGraph graph;
+  auto state = [=](size_t k) { return DiscreteKey(k, nrStates); };
+  for (size_t k = 0; k < length; k++) {
+    std::vector<double> emission(nrStates);
+    for (double& p : emission) p = uniform(rng);
+    graph.add(state(k), emission);
+    if (k == 0) continue;
+    std::vector<double> transition(nrStates * nrStates);
+    for (double& p : transition) p = uniform(rng) / nrStates;
+    graph.add(state(k - 1) & state(k), transition);
+  }
+  return graph;
+}
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Discrete, product) {
+  const DiscreteFactorGraph graph = ladder(4);
+  state.measure("random", [&] { return graph.product(); });
+  state.counter("factors", graph.size());
+
+  // Few distinct values, so that decision trees share many subtrees
+  const DiscreteFactorGraph binary = ladder(4, 1, 2);
+  state.measure("binary", [&] { return binary.product(); });
+  const DiscreteFactorGraph constraints = ladder(4, 0, 1);
+  state.measure("constraints", [&] { return constraints.product(); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Discrete, sumProduct) {
+  const DiscreteFactorGraph graph = ladder(4);
+  const DecisionTreeFactor joint = graph.product();
+  state.measure("sum", [&] { return joint.sum(4); });
+  state.measure("max", [&] { return joint.max(4); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Discrete, optimize) {
+  const DiscreteFactorGraph graph = ladder(500);
+  state.measure("multifrontal", [&] { return graph.optimize(); });
+  state.counter("factors", graph.size());
+  // Sum-product elimination into a Bayes net, as optimize used to do
+  state.measure("sequential",
+                [&] { return graph.eliminateSequential()->optimize(); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Discrete, eliminate) {
+  for (const auto& name_graph :
+       {std::make_pair("ugm", ugmChain()), std::make_pair("hmm", hmm(100, 20)),
+        std::make_pair("ladder", ladder(20)),
+        std::make_pair("constraints", ladder(20, 0, 1))}) {
+    const std::string name = name_graph.first;
+    const DiscreteFactorGraph& graph = name_graph.second;
+    const Ordering ordering = Ordering::Natural(graph);
+    state.measure(name + "/trees", [&] {
+      return graph.eliminateSequential(ordering, EliminateDiscreteTrees);
+    });
+    state.measure(name + "/dense", [&] {
+      return graph.eliminateSequential(ordering, EliminateDiscreteDense);
+    });
+    state.measure(name + "/auto", [&] {
+      return graph.eliminateSequential(ordering, EliminateDiscrete);
+    });
+  }
+}
+
+/* ************************************************************************* */
+BENCHMARK(Discrete, marginals) {
+  const DiscreteFactorGraph graph = ugmChain(500);
+  const KeySet keys = graph.keys();
+  // Shortcut computation per variable, as DiscreteMarginals used to do
+  state.measure("shortcuts", [&] {
+    const DiscreteBayesTree::shared_ptr bayesTree = graph.eliminateMultifrontal();
+    for (Key j : keys) bayesTree->marginalFactor(j, EliminateDiscrete);
+  });
+  state.measure("all", [&] {
+    return DiscreteMarginals(graph).allMarginalProbabilities();
+  });
+  state.counter("variables", keys.size());
+}
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchImu.cpp
+ * @brief   IMU preintegration, one sample at a time versus in batches
+ * @date    October 2026
+ *
+ * The integrate cases preintegrate one second of 1 kHz measurements; the
+ * batch cases report their relative deviation from the per-sample
+ * covariance. The sample cases draw the noise for Monte Carlo estimates.
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/navigation/ImuFactor.h>
+#include <gtsam/navigation/ScenarioRunner.h>
+
+#include <cmath>
+
+using namespace gtsam;
+
+namespace {
+
+const size_t kSamples = 1000;
+const double kDt = 0.001;
+
+boost::shared_ptr<PreintegrationParams> params() {
+  auto p = PreintegrationParams::MakeSharedU(9.81);
+  p->gyroscopeCovariance = 1e-6 * I_3x3;
+  p->accelerometerCovariance = 1e-4 * I_3x3;
+  p->integrationCovariance = 1e-8 * I_3x3;
+  return p;
+}
+
+// Measurements of a body that rotates and accelerates, in matrix columns
+struct Measurements {
+  Matrix accs, omegas, dts;
+  Measurements()
+      : accs(3, kSamples),
+        omegas(3, kSamples),
+        dts(Matrix::Constant(1, kSamples, kDt)) {
+    for (size_t j = 0; j < kSamples; j++) {
+      const double t = kDt * j;
+      accs.col(j) << std::sin(t), 0.3, 9.81 + 0.2 * std::cos(5 * t);
+      omegas.col(j) << 0.2 * std::cos(t), 0.4, -0.3 + 0.5 * std::sin(3 * t);
+    }
+  }
+};
+
+const imuBias::ConstantBias kBias(Vector3(0.01, 0.02, -0.01),
+                                  Vector3(0.001, -0.002, 0.003));
+
+double relativeDeviation(const PreintegratedImuMeasurements& expected,
+                         const PreintegratedImuMeasurements& actual) {
+  return (expected.preintMeasCov() - actual.preintMeasCov()).norm() /
+         expected.preintMeasCov().norm();
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Imu, integrate) {
+  const Measurements m;
+  const auto p = params();
+
+  PreintegratedImuMeasurements perSample(p, kBias);
+  state.measure("perSample", [&] {
+    perSample.resetIntegration();
+    for (size_t j = 0; j < kSamples; j++)
+      perSample.integrateMeasurement(m.accs.col(j), m.omegas.col(j), kDt);
+  });
+  const double perSampleTime = state.results().back().median;
+
+  PreintegratedImuMeasurements batch(p, kBias);
+  state.measure("batch", [&] {
+    batch.resetIntegration();
+    batch.integrateMeasurements(m.accs, m.omegas, m.dts);
+  });
+  state.counter("speedup", perSampleTime / state.results().back().median);
+  state.counter("deviation", relativeDeviation(perSample, batch));
+
+  PreintegratedImuMeasurements approximate(p, kBias);
+  state.measure("batch10", [&] {
+    approximate.resetIntegration();
+    approximate.integrateMeasurements(m.accs, m.omegas, m.dts, 10);
+  });
+  state.counter("speedup", perSampleTime / state.results().back().median);
+  state.counter("deviation", relativeDeviation(perSample, approximate));
+}
+
+/* ************************************************************************* */
+BENCHMARK(Imu, sample) {
+  const Sampler sampler(Vector6::Constant(0.1));
+  const size_t N = 10000;
+  state.measure("perSample", [&] {
+    Matrix samples(N, 6);
+    for (size_t j = 0; j < N; j++) samples.row(j) = sampler.sample();
+    return samples;
+  });
+  state.measure("batch", [&] { return sampler.sample(N); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Imu, estimateNoiseCovariance) {
+  const ConstantTwistScenario scenario(Vector3(0, 0, 0.1), Vector3(1, 0, 0));
+  const ScenarioRunner runner(scenario, params(), kDt);
+  state.measure([&] { return runner.estimateNoiseCovariance(100000); });
+}
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchLinear.cpp
+ * @brief   Linear solver benchmarks, ported from timeCholesky.cpp, timeGaussianFactor.cpp, timeFactorOverhead.cpp and timeGaussianFactorGraph.cpp
+ * @author  Alex Cunningham, Richard Roberts, Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/base/cholesky.h>
+#include <gtsam/linear/GaussianBayesNet.h>
+#include <gtsam/linear/GaussianConditional.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <tests/smallExample.h>
+
+#include <random>
+
+using namespace gtsam;
+
+/* ************************************************************************* */
+BENCHMARK(Cholesky, choleskyPartial) {
+  Matrix top = (Matrix(7, 7) <<
+      4.0375, 3.4584, 3.5735, 2.4815, 2.1471, 2.7400, 2.2063,
+      0.,     4.7267, 3.8423, 2.3624, 2.8091, 2.9579, 2.5914,
+      0.,     0.,     5.1600, 2.0797, 3.4690, 3.2419, 2.9992,
+      0.,     0.,     0.,     1.8786, 1.0535, 1.4250, 1.3347,
+      0.,     0.,     0.,     0.,     3.0788, 2.6283, 2.3791,
+      0.,     0.,     0.,     0.,     0.,     2.9227, 2.4056,
+      0.,     0.,     0.,     0.,     0.,     0.,     2.5776).finished();
+
+  Matrix ABC = Matrix::Zero(100, 100);
+  ABC.topLeftCorner<7, 7>() = top;
+  for (size_t nFrontal = 1; nFrontal <= 7; nFrontal++) {
+    state.measure("nFrontal=" + std::to_string(nFrontal), [&] {
+      Matrix RSL(ABC);
+      return choleskyPartial(RSL, nFrontal);
+    });
+  }
+}
+
+/* ************************************************************************* */
+BENCHMARK(JacobianFactor, eliminate) {
+  const Key x1 = 1, x2 = 2, l1 = 3;
+  const Matrix Ax2 = (Matrix(8, 2) <<
+      -5., 0.,  +0., -5.,  10., 0.,  +0., 10.,
+      -5., 0.,  +0., -5.,  10., 0.,  +0., 10.).finished();
+  const Matrix Ax1 = (Matrix(8, 2) <<
+      0., 0.,  0., 0.,  -10., 0.,  0., -10.,
+      0., 0.,  0., 0.,  -10., 0.,  0., -10.).finished();
+  Matrix Al1(8, 10);
+  for (int i = 0; i < 8; i++)
+    Al1.row(i) << (i % 4 == 0 ? 5. : 0.), (i % 4 == 1 ? 5. : 0.), 1., 2., 3.,
+        4., 5., 6., 7., 8.;
+  const Vector b = (Vector(8) << -1, 1.5, 2, -1, -1, 1.5, 2, -1).finished();
+
+  const JacobianFactor combined(x2, Ax2, l1, Al1, x1, Ax1, b,
+                                noiseModel::Isotropic::Sigma(8, 1));
+  Ordering ordering;
+  ordering.push_back(x2);
+  state.measure([&] { return JacobianFactor(combined).eliminate(ordering); });
+}
+
+/* ************************************************************************* */
+// Overhead of many small factors compared to one big factor with the same
+// rows, on a single variable.
+BENCHMARK(JacobianFactor, overhead) {
+  const Key key = 0;
+  const size_t vardim = 2, blockdim = 1, nBlocks = 4000;
+  std::mt19937 rng;
+  std::uniform_real_distribution<> uniform(0.0, 1.0);
+  auto randomMatrix = [&](size_t m, size_t n) {
+    Matrix A(m, n);
+    for (size_t i = 0; i < m; ++i)
+      for (size_t j = 0; j < n; ++j) A(i, j) = uniform(rng);
+    return A;
+  };
+  const SharedDiagonal noise = noiseModel::Isotropic::Sigma(blockdim, 1.0);
+
+  GaussianFactorGraph blockwise;
+  state.measure("blockwiseBuild", [&] {
+    blockwise = GaussianFactorGraph();
+    for (size_t i = 0; i < nBlocks; ++i)
+      blockwise.push_back(boost::make_shared<JacobianFactor>(
+          key, randomMatrix(blockdim, vardim), randomMatrix(blockdim, 1).col(0),
+          noise));
+  });
+  state.measure("blockwiseSolve",
+                [&] { return blockwise.eliminateSequential()->optimize(); });
+
+  GaussianFactorGraph combined;
+  state.measure("combinedBuild", [&] {
+    combined = GaussianFactorGraph();
+    combined.push_back(boost::make_shared<JacobianFactor>(
+        key, randomMatrix(blockdim * nBlocks, vardim),
+        randomMatrix(blockdim * nBlocks, 1).col(0),
+        noiseModel::Isotropic::Sigma(blockdim * nBlocks, 1.0)));
+  });
+  state.measure("combinedSolve",
+                [&] { return combined.eliminateSequential()->optimize(); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(GaussianFactorGraph, KalmanSmoother) {
+  // Twice the length should take twice the time
+  for (int T : {10000, 20000}) {
+    const GaussianFactorGraph smoother = example::createSmoother(T);
+    const Ordering ordering(smoother.keys());
+    state.setMaxRepetitions(3);
+    state.measure("T=" + std::to_string(T),
+                  [&] { return smoother.optimize(ordering); });
+  }
+}
+
+/* ************************************************************************* */
+BENCHMARK(GaussianFactorGraph, planar) {
+  const size_t N = 50;
+  const GaussianFactorGraph fg = example::planarGraph(N).first;
+  state.setMaxRepetitions(3);
+  state.measure("optimize", [&] { return fg.optimize(); });
+  state.measure("eliminateMultifrontal",
+                [&] { return fg.eliminateMultifrontal(); });
+}
@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchLinearize.cpp
+ * @brief   Factor linearization benchmarks, ported from timeCameraExpression.cpp, timeOneCameraExpression.cpp, timeAdaptAutoDiff.cpp and timeSFMExpressions.cpp
+ * The Batched case compares NonlinearFactorGraph::linearize with and without
+ * the BatchLinearization kernels on a pose graph.
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/3rdparty/ceres/example.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/nonlinear/AdaptAutoDiff.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/GeneralSFMFactor.h>
+#include <gtsam/slam/ProjectionFactor.h>
+#include <gtsam/slam/expressions.h>
+
+using namespace gtsam;
+
+namespace {
+
+const Point2 z(-17, 30);
+const SharedNoiseModel model = noiseModel::Unit::Create(2);
+const boost::shared_ptr<Cal3_S2> fixedK(new Cal3_S2());
+
+Point2 myProject(const Pose3& pose, const Point3& point,
+                 OptionalJacobian<2, 6> H1, OptionalJacobian<2, 3> H2) {
+  PinholeCamera<Cal3_S2> camera(pose, *fixedK);
+  return camera.project(point, H1, H2, boost::none);
+}
+
+/// Time linearizing a single factor
+void linearize(benchmark::State& state, const std::string& label,
+               const NonlinearFactor::shared_ptr& f, const Values& values) {
+  state.measure(label, [&] { return f->linearize(values); });
+}
+
+/// Time linearizing a graph with n copies of the same factor
+void linearizeGraph(benchmark::State& state, const std::string& label,
+                    const NonlinearFactor::shared_ptr& f, const Values& values,
+                    size_t n) {
+  NonlinearFactorGraph graph;
+  for (size_t i = 0; i < n; i++) graph.push_back(f);
+  state.measure(label, [&] { return graph.linearize(values); });
+  state.counter("factors", n);
+}
+
+Values projectionValues() {
+  Values values;
+  values.insert(1, Pose3());
+  values.insert(2, Point3(0, 0, 1));
+  values.insert(3, Cal3_S2());
+  return values;
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Linearize, UncalibratedProjection) {
+  Pose3_ x(1);
+  Point3_ p(2);
+  Cal3_S2_ K(3);
+  const Values values = projectionValues();
+
+  // Dedicated factor
+  linearize(state, "GeneralSFMFactor2",
+            boost::make_shared<GeneralSFMFactor2<Cal3_S2> >(z, model, 1, 2, 3),
+            values);
+
+  // ExpressionFactor: Bin(Leaf,Un(Bin(Leaf,Leaf)))
+  linearize(state, "expression",
+            boost::make_shared<ExpressionFactor<Point2> >(
+                model, z, uncalibrate(K, project(transformTo(x, p)))),
+            values);
+
+  // ExpressionFactor: Ternary(Leaf,Leaf,Leaf)
+  linearize(state, "ternaryExpression",
+            boost::make_shared<ExpressionFactor<Point2> >(model, z,
+                                                          project3(x, p, K)),
+            values);
+}
+
+/* ************************************************************************* */
+BENCHMARK(Linearize, CalibratedProjection) {
+  Pose3_ x(1);
+  Point3_ p(2);
+  const Values values = projectionValues();
+
+  // Dedicated factor
+  linearize(state, "GenericProjectionFactor",
+            boost::make_shared<GenericProjectionFactor<Pose3, Point3> >(
+                z, model, 1, 2, fixedK),
+            values);
+
+  // ExpressionFactor: Bin(Cnst,Un(Bin(Leaf,Leaf)))
+  linearize(state, "expression",
+            boost::make_shared<ExpressionFactor<Point2> >(
+                model, z,
+                uncalibrate(Cal3_S2_(*fixedK), project(transformTo(x, p)))),
+            values);
+
+  // ExpressionFactor, optimized: Binary(Leaf,Leaf)
+  linearize(state, "binaryExpression",
+            boost::make_shared<ExpressionFactor<Point2> >(
+                model, z, Point2_(myProject, x, p)),
+            values);
+}
+
+/* ************************************************************************* */
+BENCHMARK(Linearize, AdaptAutoDiff) {
+  // The DefaultChart of Camera below is laid out like Snavely's 9-dim vector
+  typedef PinholeCamera<Cal3Bundler> Camera;
+  const size_t n = 10000;
+
+  Values values;
+  values.insert(1, Camera());
+  values.insert(2, Point3(0, 0, 1));
+
+  // Dedicated factor
+  linearizeGraph(state, "GeneralSFMFactor",
+                 boost::make_shared<GeneralSFMFactor<Camera, Point3> >(
+                     z, model, 1, 2),
+                 values, n);
+
+  // ExpressionFactor
+  Point2_ expression2(Expression<Camera>(1), &Camera::project2,
+                      Point3_(2));
+  linearizeGraph(state, "expression",
+                 boost::make_shared<ExpressionFactor<Point2> >(model, z,
+                                                               expression2),
+                 values, n);
+
+  // AdaptAutoDiff
+  values.clear();
+  values.insert(1, Vector9(Vector9::Zero()));
+  values.insert(2, Vector3(0, 0, 1));
+  typedef AdaptAutoDiff<SnavelyProjection, 2, 9, 3> AdaptedSnavely;
+  Expression<Vector2> expression(AdaptedSnavely(), Expression<Vector9>(1),
+                                 Expression<Vector3>(2));
+  linearizeGraph(state, "AdaptAutoDiff",
+                 boost::make_shared<ExpressionFactor<Vector2> >(model, z,
+                                                                expression),
+                 values, n);
+}
+
+/* ************************************************************************* */
+BENCHMARK(Linearize, SFMExpressions) {
+  // number of cameras, and points
+  const size_t M = 10, N = 1000;
+
+  // Create leaves
+  Cal3_S2_ K('K', 0);
+  std::vector<Expression<Pose3> > x = createUnknowns<Pose3>(M, 'x');
+  std::vector<Expression<Point3> > p = createUnknowns<Point3>(N, 'p');
+
+  // Create values
+  Values values;
+  values.insert(Symbol('K', 0), Cal3_S2());
+  for (size_t i = 0; i < M; i++) values.insert(Symbol('x', i), Pose3());
+  for (size_t j = 0; j < N; j++) values.insert(Symbol('p', j), Point3(0, 0, 1));
+
+  NonlinearFactorGraph graph;
+  state.measure("build", [&] {
+    graph = NonlinearFactorGraph();
+    for (size_t i = 0; i < M; i++)
+      for (size_t j = 0; j < N; j++)
+        graph.addExpressionFactor(
+            model, z, uncalibrate(K, project(transformTo(x[i], p[j]))));
+  });
+  state.counter("factors", M * N);
+
+  state.measure("linearize", [&] { return graph.linearize(values); });
+  state.counter("factors", M * N);
+}
+
+// The kernel only matches BetweenFactor<Pose3> with the chart it assumes
+#if defined(GTSAM_POSE3_EXPMAP) && !defined(SLOW_BUT_CORRECT_BETWEENFACTOR)
+/* ************************************************************************* */
+BENCHMARK(Linearize, Batched) {
+  // A chain of poses with loop closures, all with the same isotropic noise
+  const size_t n = 5000;
+  const SharedNoiseModel poseModel = noiseModel::Isotropic::Sigma(6, 0.1);
+  Values values;
+  for (size_t i = 0; i < n; i++)
+    values.insert(i, Pose3::Expmap((Vector6() << 0.01 * i, 0.2, -0.3, i,
+                                    0.1 * i, 1.0).finished()));
+  NonlinearFactorGraph graph;
+  for (size_t i = 0; i + 1 < n; i++) {
+    const Pose3 odometry = values.at<Pose3>(i).between(values.at<Pose3>(i + 1));
+    graph.emplace_shared<BetweenFactor<Pose3> >(
+        i, i + 1, odometry * Pose3::Expmap(Vector6::Constant(0.01)),
+        poseModel);
+    if (i % 10 == 0 && i + 100 < n)
+      graph.emplace_shared<BetweenFactor<Pose3> >(i, i + 100, Pose3(),
+                                                  poseModel);
+  }
+
+  state.measure("perFactor", [&] { return graph.linearize(values); });
+  state.counter("factors", graph.size());
+  const double perFactorTime = state.results().back().median;
+
+  state.measure("batched", [&] { return graph.linearizeBatched(values); });
+  state.counter("factors", graph.size());
+  state.counter("speedup", perFactorTime / state.results().back().median);
+}
+#endif
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchMatrix.cpp
+ * @brief   Matrix utility benchmarks, ported from timeMatrix.cpp and timeMatrixOps.cpp
+ * @author  Alex Cunningham, Richard Roberts
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/base/Matrix.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace gtsam;
+
+/* ************************************************************************* */
+BENCHMARK(Matrix, collect) {
+  // p matrices of size m*n, filled with identities
+  const size_t p = 10, m = 10, n = 12;
+  std::vector<Matrix> storage(p, Matrix::Identity(m, n));
+  std::vector<const Matrix*> matrices;
+  for (const Matrix& M : storage) matrices.push_back(&M);
+
+  state.measure("noDims", [&] { return collect(matrices); });
+  state.measure("dims", [&] { return collect(matrices, m, n); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Matrix, vector_scale) {
+  const size_t m = 400, n = 480;
+  Matrix M(m, n);
+  for (size_t i = 0; i < m; ++i)
+    for (size_t j = 0; j < n; ++j) M(i, j) = 2 * i + j;
+  Vector Vm(m), Vn(n);
+  for (size_t i = 0; i < m; ++i) Vm(i) = i * 2;
+  for (size_t j = 0; j < n; ++j) Vn(j) = j * 2;
+
+  state.measure("column", [&] { return vector_scale(M, Vm); });
+  state.measure("row", [&] { return vector_scale(Vn, M); });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Matrix, column) {
+  const size_t m = 100, n = 100;
+  Matrix M(m, n);
+  for (size_t i = 0; i < m; ++i)
+    for (size_t j = 0; j < n; ++j) M(i, j) = 2 * i + j;
+
+  Vector result;
+  state.measure([&] {
+    for (size_t j = 0; j < n; ++j) result = column(M, j);
+    return result(0);
+  });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Matrix, householder_) {
+  const Matrix Abase = (Matrix(4, 7) <<
+      -5,  0, 5, 0,   0,   0,  -1,
+      00, -5, 0, 5,   0,   0, 1.5,
+      10,  0, 0, 0, -10,   0,   2,
+      00, 10, 0, 0,   0, -10,  -1).finished();
+
+  state.measure([&] {
+    Matrix A = Abase;
+    householder_(A, 3);
+    return A(0, 0);
+  });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Matrix, insertSub) {
+  Matrix big = Matrix::Zero(100, 100);
+  const Matrix small = Matrix::Identity(5, 5);
+
+  state.measure([&] {
+    for (size_t i = 0; i < 100; i += 5)
+      for (size_t j = 0; j < 100; j += 5) insertSub(big, small, i, j);
+    return big(0, 0);
+  });
+}
+
+/* ************************************************************************* */
+// Element-wise assignment to a matrix and to blocks of it, in row-major,
+// column-major and random order.
+BENCHMARK(Matrix, blockAssignment) {
+  const size_t m = 500, n = 300;
+  std::mt19937 rng;
+  std::uniform_real_distribution<> uniform(-1.0, 0.0);
+  Matrix mat(m, n);
+  SubMatrix full = mat.block(0, 0, m, n);
+  SubMatrix top = mat.block(0, 0, n, n);
+  SubMatrix block = mat.block(m / 4, n / 4, m - m / 2, n - n / 2);
+
+  auto rowMajor = [&](SubMatrix& M) {
+    for (Eigen::Index i = 0; i < M.rows(); ++i)
+      for (Eigen::Index j = 0; j < M.cols(); ++j) M(i, j) = uniform(rng);
+  };
+  auto columnMajor = [&](SubMatrix& M) {
+    for (Eigen::Index j = 0; j < M.cols(); ++j)
+      for (Eigen::Index i = 0; i < M.rows(); ++i) M(i, j) = uniform(rng);
+  };
+
+  // Fixed set of random indices, scaled to each block
+  std::uniform_int_distribution<size_t> uniform_i(0, m - 1), uniform_j(0, n - 1);
+  std::vector<std::pair<size_t, size_t> > ijs(100000);
+  for (auto& ij : ijs) ij = std::make_pair(uniform_i(rng), uniform_j(rng));
+  auto random = [&](SubMatrix& M) {
+    for (const auto& ij : ijs)
+      M(ij.first % M.rows(), ij.second % M.cols()) = uniform(rng);
+  };
+
+  const std::vector<std::pair<std::string, SubMatrix*> > blocks{
+      {"full", &full}, {"top", &top}, {"block", &block}};
+  for (const auto& b : blocks) {
+    SubMatrix& M = *b.second;
+    state.measure("rowMajor/" + b.first, [&] { rowMajor(M); });
+    state.measure("columnMajor/" + b.first, [&] { columnMajor(M); });
+    state.measure("random/" + b.first, [&] { random(M); });
+  }
+}
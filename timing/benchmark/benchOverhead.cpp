@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchOverhead.cpp
+ * @brief   Language and instrumentation overhead benchmarks, ported from timeVirtual.cpp, timeVirtual2.cpp and timeTest.cpp
+ * @author  Richard Roberts
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/base/timing.h>
+
+#include <boost/intrusive_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cassert>
+#include <vector>
+
+using namespace gtsam;
+
+namespace {
+
+struct Plain {
+  size_t data;
+  Plain(size_t _data) : data(_data) {}
+  void setData(size_t data) { this->data = data; }
+};
+
+struct Virtual {
+  size_t data;
+  Virtual(size_t _data) : data(_data) {}
+  virtual void setData(size_t data) { this->data = data; }
+  virtual ~Virtual() {}
+};
+
+struct VirtualCounted {
+  size_t data;
+  size_t refCount = 0;
+  VirtualCounted(size_t _data) : data(_data) {}
+  virtual void setData(size_t data) { this->data = data; }
+  virtual ~VirtualCounted() {}
+};
+
+void intrusive_ptr_add_ref(VirtualCounted* obj) { ++obj->refCount; }
+void intrusive_ptr_release(VirtualCounted* obj) {
+  assert(obj->refCount > 0);
+  --obj->refCount;
+  if (obj->refCount == 0) delete obj;
+}
+
+struct VirtualBase {
+  virtual void method() = 0;
+  virtual ~VirtualBase() {}
+};
+
+struct VirtualDerived : public VirtualBase {
+  double data = 0;
+  void method() override { data += 1.0; }
+};
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Virtual, allocation) {
+  size_t i = 0;
+  state.measure("heapPlain", [&] {
+    Plain* obj = new Plain(i++);
+    obj->setData(i);
+    delete obj;
+  });
+  state.measure("heapVirtual", [&] {
+    Virtual* obj = new Virtual(i++);
+    obj->setData(i);
+    delete obj;
+  });
+  state.measure("stackPlain", [&] {
+    Plain obj(i++);
+    obj.setData(i);
+    return obj.data;
+  });
+  state.measure("stackVirtual", [&] {
+    Virtual obj(i++);
+    obj.setData(i);
+    return obj.data;
+  });
+  state.measure("sharedPlain", [&] {
+    boost::shared_ptr<Plain> obj(new Plain(i++));
+    obj->setData(i);
+  });
+  state.measure("sharedVirtual", [&] {
+    boost::shared_ptr<Virtual> obj(new Virtual(i++));
+    obj->setData(i);
+  });
+  state.measure("intrusiveVirtual", [&] {
+    boost::intrusive_ptr<VirtualCounted> obj(new VirtualCounted(i++));
+    obj->setData(i);
+  });
+}
+
+/* ************************************************************************* */
+BENCHMARK(Virtual, dispatch) {
+  const size_t n = 10000;
+  std::vector<VirtualBase*> objects(n);
+  for (VirtualBase*& b : objects) b = new VirtualDerived();
+
+  state.measure("method", [&] {
+    for (VirtualBase* b : objects) b->method();
+  });
+  state.counter("objects", n);
+  state.measure("dynamic_cast", [&] {
+    for (VirtualBase* b : objects)
+      if (VirtualDerived* d = dynamic_cast<VirtualDerived*>(b)) d->method();
+  });
+  state.counter("objects", n);
+
+  for (VirtualBase* b : objects) delete b;
+}
+
+/* ************************************************************************* */
+BENCHMARK(Timing, ticTocOverhead) {
+  state.measure("gttic_", [] {
+    gttic_(overhead);
+    gttic_(sub_overhead);
+    gttoc_(sub_overhead);
+    gttoc_(overhead);
+    tictoc_finishedIteration_();
+  });
+  state.measure("gttic", [] {
+    gttic(overhead_a);
+    gttic(overhead_b);
+    gttoc(overhead_b);
+    gttoc(overhead_a);
+    tictoc_finishedIteration();
+  });
+  tictoc_reset_();
+}
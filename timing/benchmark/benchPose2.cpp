@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchPose2.cpp
+ * @brief   Pose2 benchmarks, ported from timePose2.cpp
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Pose2.h>
+
+using namespace gtsam;
+
+namespace {
+
+/* ************************************************************************* */
+template <class MATRIX>
+Pose2 Pose2betweenOptimized(const Pose2& r1, const Pose2& r2,
+                            boost::optional<MATRIX&> H1,
+                            boost::optional<MATRIX&> H2) {
+  // get cosines and sines from rotation matrices
+  const Rot2& R1 = r1.r(), R2 = r2.r();
+  double c1 = R1.c(), s1 = R1.s(), c2 = R2.c(), s2 = R2.s();
+
+  // Calculate delta rotation = between(R1,R2)
+  double c = c1 * c2 + s1 * s2, s = -s1 * c2 + c1 * s2;
+  Rot2 R(Rot2::atan2(s, c));  // normalizes
+
+  // Calculate delta translation = unrotate(R1, dt);
+  Point2 dt = r2.t() - r1.t();
+  double x = dt.x(), y = dt.y();
+  Point2 t(c1 * x + s1 * y, -s1 * x + c1 * y);
+
+  // FD: This is just -AdjointMap(between(p2,p1)) inlined and re-using above
+  if (H1) {
+    double dt1 = -s2 * x + c2 * y;
+    double dt2 = -c2 * x - s2 * y;
+    H1->resize(3, 3);
+    *H1 << -c, -s, dt1, s, -c, dt2, 0.0, 0.0, -1.0;
+  }
+  if (H2) *H2 = Matrix3::Identity();
+
+  return Pose2(R, t);
+}
+
+/* ************************************************************************* */
+Vector Pose2BetweenFactorEvaluateErrorDefault(const Pose2& measured,
+                                              const Pose2& p1, const Pose2& p2,
+                                              boost::optional<Matrix&> H1,
+                                              boost::optional<Matrix&> H2) {
+  Pose2 hx = p1.between(p2, H1, H2);  // h(x)
+  // manifold equivalent of h(x)-z -> log(z,h(x))
+  return measured.localCoordinates(hx);
+}
+
+/* ************************************************************************* */
+template <class MATRIX>
+Vector Pose2BetweenFactorEvaluateErrorOptimizedBetween(
+    const Pose2& measured, const Pose2& p1, const Pose2& p2,
+    boost::optional<MATRIX&> H1, boost::optional<MATRIX&> H2) {
+  Pose2 hx = Pose2betweenOptimized(p1, p2, H1, H2);  // h(x)
+  // manifold equivalent of h(x)-z -> log(z,h(x))
+  return Pose2::Logmap(Pose2betweenOptimized<MATRIX>(measured, hx,
+                                                     boost::none, boost::none));
+}
+
+const Vector3 v(4.0, 2.0, 0.3);
+const Pose2 X(3, 2, 0.4), X2 = X.retract(v), X3(5, 6, 0.3);
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Pose2, Expmap) {
+  state.measure([] { return Pose2::Expmap(v); });
+}
+
+BENCHMARK(Pose2, Retract) {
+  state.measure([] { return X.retract(v); });
+}
+
+BENCHMARK(Pose2, Logmap) {
+  state.measure([] { return Pose2::Logmap(X2); });
+}
+
+BENCHMARK(Pose2, localCoordinates) {
+  state.measure([] { return X.localCoordinates(X2); });
+}
+
+BENCHMARK(Pose2, BetweenFactorEvaluateError) {
+  Matrix H1, H2;
+  Matrix3 H1f, H2f;
+  state.measure("default", [&] {
+    return Pose2BetweenFactorEvaluateErrorDefault(X3, X, X2, H1, H2);
+  });
+  state.measure("optimizedBetween", [&] {
+    return Pose2BetweenFactorEvaluateErrorOptimizedBetween<Matrix>(X3, X, X2,
+                                                                   H1, H2);
+  });
+  state.measure("optimizedBetweenFixed", [&] {
+    return Pose2BetweenFactorEvaluateErrorOptimizedBetween<Matrix3>(
+        X3, X, X2, H1f, H2f);
+  });
+}
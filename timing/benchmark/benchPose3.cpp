@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchPose3.cpp
+ * @brief   Pose3 benchmarks, ported from timePose3.cpp
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Pose3Batch.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+const double norm = sqrt(1.0 + 16.0 + 4.0);
+const double x = 1.0 / norm, y = 4.0 / norm, z = 2.0 / norm;
+const Vector6 v = (Vector6() << x, y, z, 0.1, 0.2, -0.1).finished();
+const Pose3 T = Pose3::Expmap(
+    (Vector6() << 0.1, 0.1, 0.2, 0.1, 0.4, 0.2).finished());
+const Pose3 T2 = T.retract(v);
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Pose3, Retract) {
+  state.measure([] { return T.retract(v); });
+}
+
+BENCHMARK(Pose3, Expmap) {
+  state.measure([] { return T * Pose3::Expmap(v); });
+}
+
+BENCHMARK(Pose3, localCoordinates) {
+  state.measure([] { return T.localCoordinates(T2); });
+}
+
+BENCHMARK(Pose3, between) {
+  Matrix H1, H2;
+  state.measure([] { return T.between(T2); });
+  state.measure("derivatives", [&] { return T.between(T2, H1, H2); });
+}
+
+BENCHMARK(Pose3, Logmap) {
+  state.measure([] { return Pose3::Logmap(T.between(T2)); });
+}
+
+/* ************************************************************************* */
+// 1000 poses, one at a time and as a Pose3Batch
+BENCHMARK(Pose3, batch) {
+  const size_t N = 1000;
+  const Vector6Batch xi = Vector6Batch::Random(N, 6);
+  vector<Vector6> twists(N);
+  for (size_t i = 0; i < N; i++) twists[i] = xi.row(i).transpose();
+
+  vector<Pose3> poses(N), others(N);
+  state.measure("Expmap", [&] {
+    for (size_t i = 0; i < N; i++) poses[i] = Pose3::Expmap(twists[i]);
+  });
+  state.measure("ExpmapBatch", [&] { return Pose3Batch::Expmap(xi); });
+
+  const Pose3Batch batch(poses);
+  state.measure("Logmap", [&] {
+    for (size_t i = 0; i < N; i++) twists[i] = Pose3::Logmap(poses[i]);
+  });
+  state.measure("LogmapBatch", [&] { return Pose3Batch::Logmap(batch); });
+
+  state.measure("between", [&] {
+    for (size_t i = 0; i < N; i++) others[i] = poses[i].between(T);
+  });
+  state.measure("betweenBatch", [&] { return batch.between(batch); });
+
+  state.measure("interpolate", [&] {
+    for (size_t i = 0; i < N; i++) others[i] = interpolate(poses[i], T, 0.3);
+  });
+  const Pose3Batch batchT(vector<Pose3>(N, T));
+  state.measure("interpolateBatch", [&] { return batch.interpolate(batchT, 0.3); });
+}
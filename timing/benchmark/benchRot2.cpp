@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchRot2.cpp
+ * @brief   Rot2 benchmarks, ported from timeRot2.cpp
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Rot2.h>
+
+using namespace gtsam;
+
+namespace {
+
+/* ************************************************************************* */
+Rot2 Rot2betweenDefault(const Rot2& r1, const Rot2& r2) {
+  return r1.inverse() * r2;
+}
+
+/* ************************************************************************* */
+Rot2 Rot2betweenOptimized(const Rot2& r1, const Rot2& r2) {
+  // Same as compose but sign of sin for r1 is reversed
+  return Rot2::fromCosSin(r1.c() * r2.c() + r1.s() * r2.s(),
+                          -r1.s() * r2.c() + r1.c() * r2.s());
+}
+
+/* ************************************************************************* */
+Vector Rot2BetweenFactorEvaluateErrorDefault(const Rot2& measured,
+                                             const Rot2& p1, const Rot2& p2,
+                                             boost::optional<Matrix&> H1,
+                                             boost::optional<Matrix&> H2) {
+  Rot2 hx = p1.between(p2, H1, H2);  // h(x)
+  // manifold equivalent of h(x)-z -> log(z,h(x))
+  return measured.localCoordinates(hx);
+}
+
+/* ************************************************************************* */
+Vector Rot2BetweenFactorEvaluateErrorOptimizedBetween(
+    const Rot2& measured, const Rot2& p1, const Rot2& p2,
+    boost::optional<Matrix&> H1, boost::optional<Matrix&> H2) {
+  Rot2 hx = Rot2betweenOptimized(p1, p2);  // h(x)
+  if (H1) *H1 = -I_1x1;
+  if (H2) *H2 = I_1x1;
+  // manifold equivalent of h(x)-z -> log(z,h(x))
+  return Rot2::Logmap(Rot2betweenOptimized(measured, hx));
+}
+
+/* ************************************************************************* */
+Vector Rot2BetweenFactorEvaluateErrorOptimizedBetweenFixed(
+    const Rot2& measured, const Rot2& p1, const Rot2& p2,
+    boost::optional<Matrix1&> H1, boost::optional<Matrix1&> H2) {
+  Rot2 hx = Rot2betweenOptimized(p1, p2);  // h(x)
+  if (H1) *H1 = -Matrix1::Identity();
+  if (H2) *H2 = Matrix1::Identity();
+  // manifold equivalent of h(x)-z -> log(z,h(x))
+  return Rot2::Logmap(Rot2betweenOptimized(measured, hx));
+}
+
+const Vector1 v(0.1);
+const Rot2 R(0.4), R2(0.5), R3(0.6);
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Rot2, Expmap) {
+  state.measure([] { return Rot2::Expmap(v); });
+}
+
+BENCHMARK(Rot2, Retract) {
+  state.measure([] { return R.retract(v); });
+}
+
+BENCHMARK(Rot2, Logmap) {
+  state.measure([] { return Rot2::Logmap(R2); });
+}
+
+BENCHMARK(Rot2, localCoordinates) {
+  state.measure([] { return R.localCoordinates(R2); });
+}
+
+BENCHMARK(Rot2, between) {
+  state.measure([] { return R.between(R2); });
+  state.measure("default", [] { return Rot2betweenDefault(R, R2); });
+  state.measure("optimized", [] { return Rot2betweenOptimized(R, R2); });
+}
+
+BENCHMARK(Rot2, BetweenFactorEvaluateError) {
+  Matrix H1, H2;
+  Matrix1 H1f, H2f;
+  state.measure("default", [&] {
+    return Rot2BetweenFactorEvaluateErrorDefault(R3, R, R2, H1, H2);
+  });
+  state.measure("optimizedBetween", [&] {
+    return Rot2BetweenFactorEvaluateErrorOptimizedBetween(R3, R, R2, H1, H2);
+  });
+  state.measure("optimizedBetweenFixed", [&] {
+    return Rot2BetweenFactorEvaluateErrorOptimizedBetweenFixed(R3, R, R2, H1f,
+                                                               H2f);
+  });
+}
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchRot3.cpp
+ * @brief   Rot3 benchmarks, ported from timeRot3.cpp
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Rot3Batch.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// a random direction
+const double norm = sqrt(1.0 + 16.0 + 4.0);
+const double x = 1.0 / norm, y = 4.0 / norm, z = 2.0 / norm;
+const Vector3 v(x, y, z);
+const Rot3 R = Rot3::Rodrigues(0.1, 0.4, 0.2), R2 = R.retract(v);
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Rot3, AxisAngle) {
+  state.measure([] { return Rot3::AxisAngle(v, 0.001); });
+}
+
+BENCHMARK(Rot3, Rodrigues) {
+  state.measure([] { return Rot3::Rodrigues(v); });
+}
+
+BENCHMARK(Rot3, Expmap) {
+  state.measure([] { return R * Rot3::Expmap(v); });
+}
+
+BENCHMARK(Rot3, Retract) {
+  state.measure([] { return R.retract(v); });
+}
+
+BENCHMARK(Rot3, Logmap) {
+  state.measure([] { return Rot3::Logmap(R.between(R2)); });
+}
+
+BENCHMARK(Rot3, localCoordinates) {
+  state.measure([] { return R.localCoordinates(R2); });
+}
+
+BENCHMARK(Rot3, RzRyRx) {
+  state.measure("slow", [] { return Rot3::Rz(z) * Rot3::Ry(y) * Rot3::Rx(x); });
+  state.measure("fast", [] { return Rot3::RzRyRx(x, y, z); });
+}
+
+/* ************************************************************************* */
+// 1000 rotations, one at a time and as a Rot3Batch
+BENCHMARK(Rot3, batch) {
+  const size_t N = 1000;
+  const Vector3Batch omega = Vector3Batch::Random(N, 3);
+  vector<Vector3> tangents(N);
+  for (size_t i = 0; i < N; i++) tangents[i] = omega.row(i).transpose();
+
+  vector<Rot3> rotations(N);
+  state.measure("Expmap", [&] {
+    for (size_t i = 0; i < N; i++) rotations[i] = Rot3::Expmap(tangents[i]);
+  });
+  state.measure("ExpmapBatch", [&] { return Rot3Batch::Expmap(omega); });
+
+  Matrix3 H;
+  Matrix3Batch HBatch;
+  state.measure("ExpmapDerivative", [&] {
+    for (size_t i = 0; i < N; i++) rotations[i] = Rot3::Expmap(tangents[i], H);
+  });
+  state.measure("ExpmapDerivativeBatch",
+                [&] { return Rot3Batch::Expmap(omega, &HBatch); });
+
+  const Rot3Batch batch(rotations);
+  state.measure("Logmap", [&] {
+    for (size_t i = 0; i < N; i++) tangents[i] = Rot3::Logmap(rotations[i]);
+  });
+  state.measure("LogmapBatch", [&] { return Rot3Batch::Logmap(batch); });
+
+  state.measure("compose", [&] {
+    for (size_t i = 0; i < N; i++) rotations[i] = rotations[i] * R;
+  });
+  state.measure("composeBatch", [&] { return batch.compose(batch); });
+}
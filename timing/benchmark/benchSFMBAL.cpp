@@ -0,0 +1,298 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchSFMBAL.cpp
+ * @brief   Bundle adjustment benchmarks on BAL files, ported from the timeSFMBAL*.cpp scripts and SFMExample_SmartFactorPCG. Use --param bal=<file> to select the data set and --param schur=0 for a COLAMD ordering.
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/3rdparty/ceres/example.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/Point3.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/nonlinear/AdaptAutoDiff.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/slam/GeneralSFMFactor.h>
+#include <gtsam/slam/SmartFactorCache.h>
+#include <gtsam/slam/SmartProjectionFactor.h>
+#include <gtsam/slam/dataset.h>
+#include <gtsam/slam/expressions.h>
+
+#include <stdexcept>
+
+using namespace gtsam;
+using symbol_shorthand::C;
+using symbol_shorthand::K;
+using symbol_shorthand::P;
+
+namespace {
+
+typedef PinholeCamera<Cal3Bundler> Camera;
+const SharedNoiseModel gNoiseModel = noiseModel::Unit::Create(2);
+
+/// Read the BAL file given by --param bal, dubrovnik-3-7-pre by default
+SfmData readData(const benchmark::State& state) {
+  const std::string filename = state.parameter(
+      "bal", findExampleDataFile("dubrovnik-3-7-pre"));
+  SfmData db;
+  if (!readBAL(filename, db))
+    throw std::runtime_error("Could not access file " + filename);
+  return db;
+}
+
+/// Time LM on the given graph, with a Schur-complement ordering by default
+void optimize(benchmark::State& state, const SfmData& db,
+              const NonlinearFactorGraph& graph, const Values& initial,
+              bool separateCalibration = false, bool useSchur = true) {
+  // Set parameters to be similar to ceres
+  LevenbergMarquardtParams params;
+  LevenbergMarquardtParams::SetCeresDefaults(&params);
+
+  if (useSchur && state.parameter("schur", "1") != "0") {
+    // Create Schur-complement ordering
+    Ordering ordering;
+    for (size_t j = 0; j < db.number_tracks(); j++) ordering.push_back(P(j));
+    for (size_t i = 0; i < db.number_cameras(); i++) {
+      ordering.push_back(C(i));
+      if (separateCalibration) ordering.push_back(K(i));
+    }
+    params.setOrdering(ordering);
+  }
+
+  Values result;
+  state.setMaxRepetitions(3);
+  state.measureOnce("optimize", [&] {
+    LevenbergMarquardtOptimizer lm(graph, initial, params);
+    result = lm.optimize();
+  });
+  state.counter("factors", graph.size());
+  state.counter("error", graph.error(result));
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+// Conventional GeneralSFMFactor
+BENCHMARK(SFMBAL, GeneralSFMFactor) {
+  const SfmData db = readData(state);
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    for (const SfmMeasurement& m : db.tracks[j].measurements) {
+      graph.emplace_shared<GeneralSFMFactor<Camera, Point3> >(
+          m.second, gNoiseModel, C(m.first), P(j));
+    }
+  }
+
+  Values initial;
+  size_t i = 0, j = 0;
+  for (const SfmCamera& camera : db.cameras) initial.insert(C(i++), camera);
+  for (const SfmTrack& track : db.tracks) initial.insert(P(j++), track.p);
+
+  optimize(state, db, graph, initial);
+}
+
+/* ************************************************************************* */
+// Snavely's projection function, differentiated with AdaptAutoDiff
+BENCHMARK(SFMBAL, AdaptAutoDiff) {
+  const SfmData db = readData(state);
+  AdaptAutoDiff<SnavelyProjection, 2, 9, 3> snavely;
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    for (const SfmMeasurement& m : db.tracks[j].measurements) {
+      const Point2& z = m.second;
+      Expression<Vector9> camera_(C(m.first));
+      Expression<Vector3> point_(P(j));
+      // Expects measurements in OpenGL format, with y increasing upwards
+      graph.addExpressionFactor(gNoiseModel, Vector2(z.x(), -z.y()),
+                                Expression<Vector2>(snavely, camera_, point_));
+    }
+  }
+
+  Values initial;
+  size_t i = 0, j = 0;
+  for (const SfmCamera& camera : db.cameras) {
+    // readBAL converts to GTSAM format, so we need to convert back !
+    Pose3 openGLpose = gtsam2openGL(camera.pose());
+    Vector9 v9;
+    v9 << Pose3::Logmap(openGLpose), camera.calibration();
+    initial.insert(C(i++), v9);
+  }
+  for (const SfmTrack& track : db.tracks) {
+    Vector3 v3 = track.p;
+    initial.insert(P(j++), v3);
+  }
+
+  optimize(state, db, graph, initial);
+}
+
+/* ************************************************************************* */
+// Expressions with camera pose and calibration as separate variables. If
+// camTnav is true the pose variables are inverted, using transformFrom.
+static void timeExpressions(benchmark::State& state, bool camTnav) {
+  const SfmData db = readData(state);
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    Point3_ nav_point_(P(j));
+    for (const SfmMeasurement& m : db.tracks[j].measurements) {
+      Pose3_ pose_(C(m.first));
+      Cal3Bundler_ calibration_(K(m.first));
+      Point3_ camera_point_ = camTnav ? transformFrom(pose_, nav_point_)
+                                      : transformTo(pose_, nav_point_);
+      graph.addExpressionFactor(gNoiseModel, m.second,
+                                uncalibrate(calibration_, project(camera_point_)));
+    }
+  }
+
+  Values initial;
+  size_t i = 0, j = 0;
+  for (const SfmCamera& camera : db.cameras) {
+    initial.insert(C(i), camTnav ? camera.pose().inverse() : camera.pose());
+    initial.insert(K(i), camera.calibration());
+    i += 1;
+  }
+  for (const SfmTrack& track : db.tracks) initial.insert(P(j++), track.p);
+
+  const bool separateCalibration = true;
+  optimize(state, db, graph, initial, separateCalibration);
+}
+
+BENCHMARK(SFMBAL, navTcam) { timeExpressions(state, false); }
+
+BENCHMARK(SFMBAL, camTnav) { timeExpressions(state, true); }
+
+/* ************************************************************************* */
+// Smart factors, which eliminate the points internally
+BENCHMARK(SFMBAL, SmartProjectionFactor) {
+  const SfmData db = readData(state);
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    auto smartFactor = boost::make_shared<SmartProjectionFactor<Camera> >(
+        gNoiseModel);
+    for (const SfmMeasurement& m : db.tracks[j].measurements)
+      smartFactor->add(m.second, C(m.first));
+    graph.push_back(smartFactor);
+  }
+
+  Values initial;
+  size_t i = 0;
+  for (const SfmCamera& camera : db.cameras) initial.insert(C(i++), camera);
+
+  const bool separateCalibration = false, useSchur = false;
+  optimize(state, db, graph, initial, separateCalibration, useSchur);
+}
+
+/* ************************************************************************* */
+// Linearizing the smart factors with and without a SmartFactorCache, when
+// nothing moved and when only the first camera moved
+BENCHMARK(SFMBAL, SmartFactorCache) {
+  const SfmData db = readData(state);
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    auto smartFactor = boost::make_shared<SmartProjectionFactor<Camera> >(
+        gNoiseModel);
+    for (const SfmMeasurement& m : db.tracks[j].measurements)
+      smartFactor->add(m.second, C(m.first));
+    graph.push_back(smartFactor);
+  }
+
+  Values initial;
+  size_t i = 0;
+  for (const SfmCamera& camera : db.cameras) initial.insert(C(i++), camera);
+  Values moved = initial;
+  const Camera camera0 = initial.at<Camera>(C(0));
+  moved.update(C(0), Camera(camera0.pose() * Pose3(Rot3(), Point3(0.01, 0, 0)),
+                            camera0.calibration()));
+
+  // Alternate between the two so that every call re-triangulates
+  bool flip = false;
+  state.measure("linearize", [&] {
+    flip = !flip;
+    return graph.linearize(flip ? moved : initial);
+  });
+  state.counter("factors", graph.size());
+  const double uncachedTime = state.results().back().median;
+
+  SmartFactorCache<Camera> cache;
+  cache.linearize(graph, initial);
+  state.measure("cachedUnchanged",
+                [&] { return cache.linearize(graph, initial); });
+  state.counter("speedup", uncachedTime / state.results().back().median);
+
+  state.measure("cachedOneCameraMoved", [&] {
+    flip = !flip;
+    return cache.linearize(graph, flip ? moved : initial);
+  });
+  state.counter("relinearized", cache.relinearized());
+  state.counter("speedup", uncachedTime / state.results().back().median);
+}
+
+/* ************************************************************************* */
+// Smart factors with LM and a block-Jacobi preconditioned CG inner loop, as in
+// SFMExample_SmartFactorPCG, linearized to implicit Schur factors or Hessians
+static void timeSmartFactorPCG(benchmark::State& state,
+                               LinearizationMode mode) {
+  const SfmData db = readData(state);
+
+  NonlinearFactorGraph graph;
+  const SmartProjectionParams smartParams(mode);
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    auto smartFactor = boost::make_shared<SmartProjectionFactor<Camera> >(
+        gNoiseModel, smartParams);
+    for (const SfmMeasurement& m : db.tracks[j].measurements)
+      smartFactor->add(m.second, C(m.first));
+    graph.push_back(smartFactor);
+  }
+
+  Values initial;
+  size_t i = 0;
+  for (const SfmCamera& camera : db.cameras) initial.insert(C(i++), camera);
+
+  LevenbergMarquardtParams params;
+  LevenbergMarquardtParams::SetCeresDefaults(&params);
+  params.linearSolverType = NonlinearOptimizerParams::Iterative;
+  auto pcg = boost::make_shared<PCGSolverParameters>();
+  pcg->preconditioner_ =
+      boost::make_shared<BlockJacobiPreconditionerParameters>();
+  pcg->setEpsilon_abs(1e-10);
+  pcg->setEpsilon_rel(1e-10);
+  params.iterativeParams = pcg;
+
+  Values result;
+  state.setMaxRepetitions(3);
+  state.measureOnce("optimize", [&] {
+    LevenbergMarquardtOptimizer lm(graph, initial, params);
+    result = lm.optimize();
+  });
+  state.counter("factors", graph.size());
+  state.counter("error", graph.error(result));
+}
+
+BENCHMARK(SFMBAL, SmartFactorPCG_Implicit) {
+  timeSmartFactorPCG(state, IMPLICIT_SCHUR);
+}
+
+BENCHMARK(SFMBAL, SmartFactorPCG_Hessian) { timeSmartFactorPCG(state, HESSIAN); }
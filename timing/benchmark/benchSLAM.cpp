@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchSLAM.cpp
+ * @brief   End-to-end SLAM benchmarks, ported from timeBatch.cpp, timeLago.cpp, timeIncremental.cpp, timeiSAM2Chain.cpp and timeShonanFactor.cpp
+ * @author  Richard Roberts, Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/linear/Sampler.h>
+#include <gtsam/nonlinear/GaussNewtonOptimizer.h>
+#include <gtsam/nonlinear/ISAM2.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <gtsam/nonlinear/Marginals.h>
+#include <gtsam/sam/BearingRangeFactor.h>
+#include <gtsam/sfm/ShonanFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/slam/dataset.h>
+#include <gtsam/slam/lago.h>
+
+#include <random>
+#include <stdexcept>
+
+using namespace gtsam;
+
+/* ************************************************************************* */
+// Batch LM iteration and marginals, on --param dataset=<2D file>
+BENCHMARK(SLAM, Batch) {
+  const std::string datasetFile =
+      state.parameter("dataset", findExampleDataFile("w100"));
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = load2D(datasetFile);
+  graph->addPrior(0, Pose2(), noiseModel::Unit::Create(3));
+
+  state.setMaxRepetitions(5);
+  state.measure("createOptimizer", [&] {
+    return LevenbergMarquardtOptimizer(*graph, *initial).error();
+  });
+  state.measure("iterate", [&] {
+    LevenbergMarquardtOptimizer optimizer(*graph, *initial);
+    return optimizer.iterate();
+  });
+
+  const Values result = LevenbergMarquardtOptimizer(*graph, *initial).optimize();
+  const Marginals marginals(*graph, result);
+  const KeyVector keys = initial->keys();
+  state.measure("marginalInformation", [&] {
+    Matrix info;
+    for (Key key : keys) info = marginals.marginalInformation(key);
+    return info(0, 0);
+  });
+  state.counter("variables", keys.size());
+}
+
+/* ************************************************************************* */
+// LAGO initialization followed by Gauss-Newton, versus Gauss-Newton from a
+// noisy initial estimate
+BENCHMARK(SLAM, Lago) {
+  const std::string inputFile =
+      state.parameter("dataset", findExampleDataFile("w100"));
+  NonlinearFactorGraph::shared_ptr g;
+  Values::shared_ptr solution;
+  SharedDiagonal model = noiseModel::Diagonal::Sigmas(
+      Vector3(0.05, 0.05, 5.0 * M_PI / 180.0));
+  boost::tie(g, solution) = load2D(inputFile, model);
+
+  // add noise to create initial estimate
+  Values initial;
+  Sampler sampler(noiseModel::Diagonal::Sigmas(
+                      Vector3(0.5, 0.5, 15.0 * M_PI / 180.0)),
+                  42u);
+  for (const auto& it : solution->filter<Pose2>())
+    initial.insert(it.key, it.value.retract(sampler.sample()));
+
+  // Add prior on the pose having index (key) = 0
+  g->addPrior(0, Pose2(), noiseModel::Diagonal::Sigmas(Vector3(1e-6, 1e-6, 1e-8)));
+
+  state.setMaxRepetitions(5);
+  Values result;
+  state.measureOnce("lago", [&] {
+    Values lagoInitial = lago::initialize(*g);
+    result = GaussNewtonOptimizer(*g, lagoInitial).optimize();
+  });
+  state.counter("error", g->error(result));
+  state.measureOnce("gaussNewton", [&] {
+    result = GaussNewtonOptimizer(*g, initial).optimize();
+  });
+  state.counter("error", g->error(result));
+}
+
+/* ************************************************************************* */
+// Incremental iSAM2 on a 2D data set with odometry and landmarks
+BENCHMARK(SLAM, Incremental) {
+  typedef Pose2 Pose;
+  const std::string datasetFile =
+      state.parameter("dataset", findExampleDataFile("victoria_park"));
+  const size_t maxSteps = std::stoul(state.parameter("steps", "1000"));
+  NonlinearFactorGraph::shared_ptr data;
+  boost::tie(data, boost::tuples::ignore) = load2D(datasetFile);
+  const NonlinearFactorGraph& measurements = *data;
+
+  state.setMaxRepetitions(3);
+  ISAM2 isam2;
+  size_t steps = 0;
+  state.measureOnce("update", [&] {
+    isam2 = ISAM2();
+    size_t nextMeasurement = 0;
+    for (size_t step = 1;
+         nextMeasurement < measurements.size() && step <= maxSteps; ++step) {
+      Values newVariables;
+      NonlinearFactorGraph newFactors;
+
+      // Collect measurements and new variables for the current step
+      if (step == 1) {
+        newVariables.insert(0, Pose());
+        newFactors.addPrior(0, Pose(), noiseModel::Unit::Create(3));
+      }
+      while (nextMeasurement < measurements.size()) {
+        NonlinearFactor::shared_ptr measurementf = measurements[nextMeasurement];
+
+        if (auto measurement =
+                boost::dynamic_pointer_cast<BetweenFactor<Pose> >(measurementf)) {
+          // Stop collecting measurements that are for future steps
+          if (measurement->key1() > step || measurement->key2() > step) break;
+
+          // Require that one of the nodes is the current one
+          if (measurement->key1() != step && measurement->key2() != step)
+            throw std::runtime_error(
+                "Problem in data file, out-of-sequence measurements");
+
+          newFactors.push_back(measurement);
+
+          // Initialize the new variable
+          const Pose prevPose = step == 1
+                                    ? Pose()
+                                    : isam2.calculateEstimate<Pose>(step - 1);
+          if (measurement->key1() == step && measurement->key2() == step - 1)
+            newVariables.insert(step, prevPose * measurement->measured().inverse());
+          else if (measurement->key2() == step && measurement->key1() == step - 1)
+            newVariables.insert(step, prevPose * measurement->measured());
+        } else if (auto measurement = boost::dynamic_pointer_cast<
+                       BearingRangeFactor<Pose, Point2> >(measurementf)) {
+          Key poseKey = measurement->keys()[0], lmKey = measurement->keys()[1];
+
+          if (poseKey > step)
+            throw std::runtime_error(
+                "Problem in data file, out-of-sequence measurements");
+
+          newFactors.push_back(measurement);
+
+          // Initialize new landmark
+          if (!isam2.getLinearizationPoint().exists(lmKey) &&
+              !newVariables.exists(lmKey)) {
+            Pose pose = newVariables.exists(poseKey)
+                            ? newVariables.at<Pose>(poseKey)
+                            : isam2.calculateEstimate<Pose>(poseKey);
+            Rot2 measuredBearing = measurement->measured().bearing();
+            double measuredRange = measurement->measured().range();
+            newVariables.insert(lmKey,
+                                pose.transformFrom(measuredBearing.rotate(
+                                    Point2(measuredRange, 0.0))));
+          }
+        } else {
+          throw std::runtime_error("Unknown factor type read from data file");
+        }
+        ++nextMeasurement;
+      }
+
+      isam2.update(newFactors, newVariables);
+      steps = step;
+    }
+  });
+  state.counter("steps", steps);
+
+  // Marginals of the final estimate
+  const NonlinearFactorGraph graph = isam2.getFactorsUnsafe();
+  const Values values = isam2.calculateEstimate();
+  const Marginals marginals(graph, values);
+  const KeyVector keys = values.keys();
+  state.measure("jointMarginalInformation", [&] {
+    KeyVector pair(2);
+    pair[0] = keys.front();
+    pair[1] = keys.back();
+    return marginals.jointMarginalInformation(pair).fullMatrix()(0, 0);
+  });
+}
+
+/* ************************************************************************* */
+// iSAM2 on a randomly generated odometry chain
+BENCHMARK(SLAM, iSAM2Chain) {
+  typedef Pose2 Pose;
+  const size_t steps = std::stoul(state.parameter("steps", "1000"));
+  const SharedNoiseModel model = noiseModel::Unit::Create(3);
+
+  state.setMaxRepetitions(3);
+  state.measureOnce("update", [&] {
+    ISAM2 isam2;
+    std::srand(42);
+    for (size_t step = 0; step < steps; ++step) {
+      Values newVariables;
+      NonlinearFactorGraph newFactors;
+      if (step == 0) {
+        newFactors.addPrior(0, Pose(), model);
+        newVariables.insert(0, Pose());
+      } else {
+        Vector eta = Vector::Random(3) * 0.1;
+        Pose2 between = Pose().retract(eta);
+        newFactors.emplace_shared<BetweenFactor<Pose> >(step - 1, step,
+                                                        between, model);
+        newVariables.insert(step,
+                            isam2.calculateEstimate<Pose>(step - 1) * between);
+      }
+      isam2.update(newFactors, newVariables);
+    }
+  });
+  state.counter("steps", steps);
+}
+
+/* ************************************************************************* */
+// LM on the SO(4) lifted rotation averaging problem used by Shonan averaging
+BENCHMARK(SLAM, ShonanFactor) {
+  const std::string g2oFile = state.parameter(
+      "g2o", findExampleDataFile("sphere_smallnoise.graph"));
+  const auto measurements = parseMeasurements<Rot3>(g2oFile);
+  const auto poses = parseVariables<Pose3>(g2oFile);
+
+  // Build graph
+  NonlinearFactorGraph graph;
+  auto priorModel = noiseModel::Isotropic::Sigma(6, 10000);
+  graph.add(PriorFactor<SOn>(0, SOn::identity(4), priorModel));
+  auto G = boost::make_shared<Matrix>(SOn::VectorizedGenerators(4));
+  for (const auto& m : measurements) {
+    const auto& keys = m.keys();
+    graph.emplace_shared<ShonanFactor3>(keys[0], keys[1], m.measured(), 4,
+                                        m.noiseModel(), G);
+  }
+
+  // Set parameters to be similar to ceres
+  LevenbergMarquardtParams params;
+  LevenbergMarquardtParams::SetCeresDefaults(&params);
+  params.setLinearSolverType("MULTIFRONTAL_QR");
+
+  // Random initial estimate, the same for every repetition
+  std::mt19937 rng(42);
+  Values initial;
+  initial.insert(0, SOn::identity(4));
+  for (size_t j = 1; j < poses.size(); j++)
+    initial.insert(j, SOn::Random(rng, 4));
+
+  state.setMaxRepetitions(5);
+  Values result;
+  state.measureOnce("optimize", [&] {
+    result = LevenbergMarquardtOptimizer(graph, initial, params).optimize();
+  });
+  state.counter("error", graph.error(result));
+}
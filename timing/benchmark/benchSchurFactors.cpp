@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchSchurFactors.cpp
+ * @brief   Schur-complement factor benchmarks, ported from timeSchurFactors.cpp
+ * @author  Frank Dellaert
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/PinholePose.h>
+#include <gtsam/slam/JacobianFactorQ.h>
+#include <gtsam/slam/JacobianFactorQR.h>
+#include <gtsam/slam/RegularImplicitSchurFactor.h>
+
+using namespace gtsam;
+
+namespace {
+
+/// Time multiplyHessianAdd of the different Schur factors for m cameras
+template <typename CAMERA>
+void timeAll(benchmark::State& state, size_t m) {
+  const std::string suffix = "/m=" + std::to_string(m);
+
+  // create F
+  static const int D = CAMERA::dimension;
+  typedef Eigen::Matrix<double, 2, D> Matrix2D;
+  KeyVector keys;
+  std::vector<Matrix2D, Eigen::aligned_allocator<Matrix2D> > Fblocks;
+  for (size_t i = 0; i < m; i++) {
+    keys.push_back(i);
+    Fblocks.push_back((i + 1) * Matrix::Ones(2, D));
+  }
+
+  // create E
+  Matrix E(2 * m, 3);
+  for (size_t i = 0; i < m; i++)
+    E.block<2, 3>(2 * i, 0) = Matrix::Ones(2, 3);
+
+  // Calculate point covariance
+  Matrix P = (E.transpose() * E).inverse();
+
+  // RHS and sigmas
+  const Vector b = Vector::Constant(2 * m, 1);
+  const SharedDiagonal model;
+
+  // parameters for multiplyHessianAdd
+  const double alpha = 0.5;
+  VectorValues xvalues, yvalues;
+  for (size_t i = 0; i < m; i++) xvalues.insert(i, Vector::Constant(D, 2));
+
+  // Implicit
+  RegularImplicitSchurFactor<CAMERA> implicitFactor(keys, Fblocks, E, P, b);
+  // JacobianFactor with same error
+  JacobianFactorQ<D, 2> jf(keys, Fblocks, E, P, b, model);
+  // JacobianFactorQR with same error
+  JacobianFactorQR<D, 2> jqr(keys, Fblocks, E, P, b, model);
+  // Hessian
+  HessianFactor hessianFactor(jqr);
+
+  state.measure("Implicit" + suffix, [&] {
+    implicitFactor.multiplyHessianAdd(alpha, xvalues, yvalues);
+  });
+  state.measure("JacobianQ" + suffix,
+                [&] { jf.multiplyHessianAdd(alpha, xvalues, yvalues); });
+  state.measure("JacobianQR" + suffix,
+                [&] { jqr.multiplyHessianAdd(alpha, xvalues, yvalues); });
+  state.measure("Hessian" + suffix, [&] {
+    hessianFactor.multiplyHessianAdd(alpha, xvalues, yvalues);
+  });
+
+  // Raw memory versions
+  const Vector x = xvalues.vector(keys);
+  Vector y = Vector::Zero(m * D);
+  state.measure("RawImplicit" + suffix, [&] {
+    implicitFactor.multiplyHessianAdd(alpha, x.data(), y.data());
+  });
+  state.measure("RawJacobianQ" + suffix,
+                [&] { jf.multiplyHessianAdd(alpha, x.data(), y.data()); });
+  state.measure("RawJacobianQR" + suffix,
+                [&] { jqr.multiplyHessianAdd(alpha, x.data(), y.data()); });
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(SchurFactors, multiplyHessianAdd) {
+  for (size_t m : {2, 10, 20, 50})
+    timeAll<PinholePose<Cal3Bundler> >(state, m);
+}
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchTriangulation.cpp
+ * @brief   Triangulation of many tracks, one by one with triangulateSafe and
+ *          with a BatchTriangulator
+ * @date    October 2026
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/TriangulationBatch.h>
+
+#include <cmath>
+
+using namespace gtsam;
+
+namespace {
+typedef PinholeCamera<Cal3_S2> Camera;
+
+/// Cameras on a circle looking at a cloud of points, each track seen in 3-6
+struct Problem {
+  CameraSet<Camera> cameras;
+  std::vector<size_t> offsets, indices;
+  Point2Vector measurements;
+
+  explicit Problem(size_t numTracks) {
+    const size_t numCameras = 50;
+    const Cal3_S2 K(500, 500, 0, 320, 240);
+    for (size_t i = 0; i < numCameras; i++) {
+      const double theta = 2 * M_PI * i / numCameras;
+      const Point3 eye(20 * std::cos(theta), 20 * std::sin(theta), 2);
+      cameras.emplace_back(
+          Camera::LookatPose(eye, Point3(0, 0, 0), Point3(0, 0, 1)), K);
+    }
+    for (size_t k = 0; k < numTracks; k++) {
+      const Point3 point(std::sin(k), std::cos(3.0 * k), std::sin(0.7 * k));
+      offsets.push_back(indices.size());
+      for (size_t j = 0; j < 3 + k % 4; j++) {
+        const size_t i = (k + 7 * j) % numCameras;
+        indices.push_back(i);
+        measurements.push_back(cameras[i].project(point) +
+                               Point2(std::sin(k + j), std::cos(k * j)));
+      }
+    }
+    offsets.push_back(indices.size());
+  }
+
+  /// One call to triangulateSafe per track
+  size_t perTrack(const TriangulationParameters& params) const {
+    size_t valid = 0;
+    for (size_t k = 0; k + 1 < offsets.size(); k++) {
+      CameraSet<Camera> trackCameras;
+      Point2Vector trackMeasurements;
+      for (size_t i = offsets[k]; i < offsets[k + 1]; i++) {
+        trackCameras.push_back(cameras[indices[i]]);
+        trackMeasurements.push_back(measurements[i]);
+      }
+      valid += triangulateSafe(trackCameras, trackMeasurements, params).valid();
+    }
+    return valid;
+  }
+};
+
+void compare(benchmark::State& state, const TriangulationParameters& params,
+             size_t numTracks) {
+  const Problem problem(numTracks);
+  state.measure("perTrack", [&] { return problem.perTrack(params); });
+  state.counter("tracks", numTracks);
+  const double perTrackTime = state.results().back().median;
+
+  const BatchTriangulator<Camera> triangulator(problem.cameras, params);
+  state.measure("batch", [&] {
+    return triangulator.triangulate(problem.offsets, problem.indices,
+                                    problem.measurements);
+  });
+  state.counter("tracks", numTracks);
+  state.counter("speedup", perTrackTime / state.results().back().median);
+}
+}  // namespace
+
+/* ************************************************************************* */
+BENCHMARK(Triangulation, DLT) {
+  compare(state, TriangulationParameters(1.0, false), 10000);
+}
+
+/* ************************************************************************* */
+BENCHMARK(Triangulation, refined) {
+  compare(state, TriangulationParameters(1.0, true, 100, 10), 1000);
+}
@@ -0,0 +1,100 @@
+"""
+Compare two JSON result files written by a GTSAM benchmark executable with
+--json, and flag performance regressions.
+
+Usage:
+    python compare.py baseline.json contender.json [--threshold 0.05]
+
+A benchmark is flagged as a regression when its median time grew by more than
+the threshold and by more than twice the relative noise (standard deviation
+over median) of either run. The exit status is 1 if any regression was found,
+so the script can gate a CI job.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    """ Load a result file and index the benchmarks by name. """
+    with open(filename) as f:
+        data = json.load(f)
+    return data.get("context", {}), {b["name"]: b for b in data["benchmarks"]}
+
+
+def relative_noise(benchmark):
+    """ Standard deviation relative to the median, 0 if unknown. """
+    median, stddev = benchmark.get("median_ns"), benchmark.get("stddev_ns")
+    if not median or stddev is None:
+        return 0.0
+    return stddev / median
+
+
+def format_time(ns):
+    """ Format a duration given in nanoseconds with a readable unit. """
+    for unit, scale in (("ns", 1.0), ("us", 1e3), ("ms", 1e6)):
+        if ns < 1000 * scale:
+            return "{:.3f} {}".format(ns / scale, unit)
+    return "{:.3f} s".format(ns / 1e9)
+
+
+def compare(baseline, contender, threshold):
+    """ Print a comparison table and return the names of regressions. """
+    regressions = []
+    names = [name for name in contender if name in baseline]
+    width = max([len(name) for name in names] + [9])
+    print("{:<{w}} {:>14} {:>14} {:>9}".format(
+        "Benchmark", "Baseline", "Contender", "Change", w=width))
+    print("-" * (width + 40))
+    for name in names:
+        old, new = baseline[name], contender[name]
+        if not old.get("median_ns") or new.get("median_ns") is None:
+            continue
+        change = new["median_ns"] / old["median_ns"] - 1.0
+        tolerance = max(threshold,
+                        2.0 * max(relative_noise(old), relative_noise(new)))
+        status = ""
+        if change > tolerance:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -tolerance:
+            status = "improved"
+        print("{:<{w}} {:>14} {:>14} {:>+8.1f}% {}".format(
+            name, format_time(old["median_ns"]),
+            format_time(new["median_ns"]), 100.0 * change, status, w=width))
+
+    for name in sorted(set(baseline) - set(contender)):
+        print("{:<{w}} only in baseline".format(name, w=width))
+    for name in sorted(set(contender) - set(baseline)):
+        print("{:<{w}} only in contender".format(name, w=width))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two GTSAM benchmark result files.")
+    parser.add_argument("baseline", help="JSON results of the reference run")
+    parser.add_argument("contender", help="JSON results of the new run")
+    parser.add_argument(
+        "--threshold", type=float, default=0.05,
+        help="relative slowdown of the median that is tolerated (default 0.05)")
+    args = parser.parse_args()
+
+    baseline_context, baseline = load(args.baseline)
+    contender_context, contender = load(args.contender)
+    for key in ("gtsam_version", "date"):
+        print("{}: {} -> {}".format(key, baseline_context.get(key),
+                                    contender_context.get(key)))
+    print()
+
+    regressions = compare(baseline, contender, args.threshold)
+    if regressions:
+        print("\n{} regression(s) above {:.0f}%".format(
+            len(regressions), 100 * args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,454 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    benchmarkDatasets.cpp
+ * @brief   End-to-end benchmark of the bundled data sets across solver
+ *          configurations
+ * @date    October 2026
+ *
+ * One case is registered for every combination of data set and solver
+ * configuration, named Datasets/<dataset>/<solver>, so that --filter selects
+ * a subset, e.g. --filter w100/ or --filter /ISAM2. Solver configurations are
+ *  - batch Levenberg-Marquardt for every linear solver type and ordering
+ *    type, e.g. batch/MULTIFRONTAL_CHOLESKY/COLAMD, and
+ *  - ISAM2 with Cholesky or QR factorization, fed one new variable at a
+ *    time in the order in which the data file introduces them.
+ * Each case is run once per thread count given by --param threads=1,2,4,
+ * which requires TBB for anything other than 1. For every run the suite
+ * reports the time to convergence, the final error, the number of
+ * iterations or updates, the peak resident memory, and the duration of every
+ * iteration or update as a series in the JSON output.
+ */
+
+#include "Benchmark.h"
+
+#include <gtsam/config.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/nonlinear/ISAM2.h>
+#include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
+#include <gtsam/sam/BearingRangeFactor.h>
+#include <gtsam/sam/RangeFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/GeneralSFMFactor.h>
+#include <gtsam/slam/dataset.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/task_arena.h>
+#endif
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::C;
+using symbol_shorthand::L;
+using symbol_shorthand::P;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+double milliseconds(const Clock::time_point& start) {
+  return chrono::duration<double, milli>(Clock::now() - start).count();
+}
+
+/// How a data file is read and turned into a problem.
+enum class Kind { Pose2, Pose3, BAL, Bundler, Plaza };
+
+struct Dataset {
+  const char* name;
+  const char* file;
+  Kind kind;
+  bool incremental;  ///< whether the ISAM2 configurations apply
+};
+
+/// The bundled data sets. The range-only Plaza data and the bundle adjustment
+/// problems have landmarks that a single measurement does not determine, so
+/// they are only solved in batch.
+const Dataset kDatasets[] = {
+    {"w100", "w100.graph", Kind::Pose2, true},
+    {"w20000", "w20000.txt", Kind::Pose2, true},
+    {"victoria_park", "victoria_park.txt", Kind::Pose2, true},
+    {"sphere_smallnoise", "sphere_smallnoise.graph", Kind::Pose3, true},
+    {"sphere2500", "sphere2500.txt", Kind::Pose3, true},
+    {"pose3example-grid", "pose3example-grid.txt", Kind::Pose3, true},
+    {"Klaus3", "Klaus3.g2o", Kind::Pose3, true},
+    {"dubrovnik-3-7-pre", "dubrovnik-3-7-pre", Kind::BAL, false},
+    {"Balbianello", "Balbianello.out", Kind::Bundler, false},
+    {"Plaza1", "Plaza1", Kind::Plaza, false},
+    {"Plaza2", "Plaza2", Kind::Plaza, false},
+};
+
+struct Problem {
+  NonlinearFactorGraph graph;
+  Values initial;
+};
+
+/**
+ * Initialize the variables that a pose graph file has no vertex for, by
+ * chaining odometry from the first pose and placing landmarks where their
+ * first bearing-range measurement puts them.
+ */
+template <class POSE>
+void initializeMissing(const NonlinearFactorGraph& graph, Values* initial) {
+  bool progress = true;
+  while (progress) {
+    progress = false;
+    for (const auto& factor : graph) {
+      if (auto between =
+              boost::dynamic_pointer_cast<BetweenFactor<POSE> >(factor)) {
+        const Key i = between->key1(), j = between->key2();
+        if (initial->empty()) initial->insert(i, POSE());
+        if (initial->exists(i) && !initial->exists(j)) {
+          initial->insert(j, initial->at<POSE>(i) * between->measured());
+          progress = true;
+        } else if (!initial->exists(i) && initial->exists(j)) {
+          initial->insert(
+              i, initial->at<POSE>(j) * between->measured().inverse());
+          progress = true;
+        }
+      } else if (auto br = boost::dynamic_pointer_cast<
+                     BearingRangeFactor<Pose2, Point2> >(factor)) {
+        const Key i = br->keys()[0], j = br->keys()[1];
+        if (initial->exists(i) && !initial->exists(j)) {
+          const Pose2 pose = initial->at<Pose2>(i);
+          initial->insert(j, pose.transformFrom(br->measured().bearing().rotate(
+                                 Point2(br->measured().range(), 0.0))));
+          progress = true;
+        }
+      }
+    }
+  }
+}
+
+/// Pose graph with a prior, which comes first, on the first pose of the first
+/// factor in the file. That is the first pose the ISAM2 feed adds, whereas the
+/// smallest key need not be.
+template <class POSE>
+Problem loadPoseGraph(const string& filename, bool is3D) {
+  NonlinearFactorGraph::shared_ptr graph;
+  Values::shared_ptr initial;
+  boost::tie(graph, initial) = is3D ? load3D(filename) : load2D(filename);
+  initializeMissing<POSE>(*graph, initial.get());
+  if (initial->empty())
+    throw runtime_error("No poses in " + filename);
+
+  Problem problem;
+  const Key first = graph->empty() ? initial->keys().front()
+                                    : graph->front()->keys().front();
+  problem.graph.addPrior(first, initial->at<POSE>(first),
+                         noiseModel::Unit::Create(traits<POSE>::dimension));
+  problem.graph.push_back(*graph);
+  problem.initial = *initial;
+  return problem;
+}
+
+/// Bundle adjustment with a gauge prior on the first camera and point, as in
+/// SFMExample_bal.
+Problem loadSfm(const SfmData& db) {
+  Problem problem;
+  problem.graph.addPrior(C(0), db.cameras[0],
+                         noiseModel::Isotropic::Sigma(9, 0.1));
+  problem.graph.addPrior(P(0), db.tracks[0].p,
+                         noiseModel::Isotropic::Sigma(3, 0.1));
+  const auto measurementNoise = noiseModel::Isotropic::Sigma(2, 1.0);
+  for (size_t j = 0; j < db.number_tracks(); j++) {
+    for (const SfmMeasurement& m : db.tracks[j].measurements) {
+      problem.graph.emplace_shared<GeneralSFMFactor<SfmCamera, Point3> >(
+          m.second, measurementNoise, C(m.first), P(j));
+    }
+  }
+  for (size_t i = 0; i < db.number_cameras(); i++)
+    problem.initial.insert(C(i), db.cameras[i]);
+  for (size_t j = 0; j < db.number_tracks(); j++)
+    problem.initial.insert(P(j), db.tracks[j].p);
+  return problem;
+}
+
+/**
+ * Range-only SLAM on the Plaza data, modeled as in RangeISAMExample_plaza2:
+ * odometry from <name>_DR.txt, and robust range factors from <name>_TD.txt
+ * attached to the pose at the time of the measurement. Landmarks start at
+ * the measured range straight ahead of the pose that first sees them.
+ */
+Problem loadPlaza(const string& name) {
+  const auto odoNoise = noiseModel::Diagonal::Sigmas(Vector3(0.05, 0.01, 0.1));
+  const auto rangeNoise = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Tukey::Create(15),
+      noiseModel::Isotropic::Sigma(1, 100));
+
+  ifstream odometryFile(findExampleDataFile(name + "_DR.txt"));
+  ifstream rangeFile(findExampleDataFile(name + "_TD.txt"));
+  double rangeTime, sender, range;
+  size_t receiver;
+  bool haveRange = static_cast<bool>(rangeFile >> rangeTime >> sender >>
+                                     receiver >> range);
+
+  Problem problem;
+  Pose2 pose;
+  problem.graph.addPrior(0, pose,
+                         noiseModel::Diagonal::Sigmas(Vector3(1, 1, M_PI)));
+  problem.initial.insert(0, pose);
+  double t, distance, heading;
+  for (size_t i = 1; odometryFile >> t >> distance >> heading; i++) {
+    const Pose2 odometry(distance, 0, heading);
+    problem.graph.emplace_shared<BetweenFactor<Pose2> >(i - 1, i, odometry,
+                                                        odoNoise);
+    pose = pose * odometry;
+    problem.initial.insert(i, pose);
+
+    for (; haveRange && t >= rangeTime;
+         haveRange = static_cast<bool>(rangeFile >> rangeTime >> sender >>
+                                       receiver >> range)) {
+      problem.graph.emplace_shared<RangeFactor<Pose2, Point2> >(
+          i, L(receiver), range, rangeNoise);
+      if (!problem.initial.exists(L(receiver)))
+        problem.initial.insert(L(receiver),
+                               pose.transformFrom(Point2(range, 0.0)));
+    }
+  }
+  return problem;
+}
+
+/// Load a data set once and keep it for all cases that use it.
+const Problem& problem(const Dataset& dataset) {
+  static map<string, Problem> cache;
+  auto it = cache.find(dataset.name);
+  if (it != cache.end()) return it->second;
+
+  Problem problem;
+  switch (dataset.kind) {
+    case Kind::Pose2:
+      problem = loadPoseGraph<Pose2>(findExampleDataFile(dataset.file), false);
+      break;
+    case Kind::Pose3:
+      problem = loadPoseGraph<Pose3>(findExampleDataFile(dataset.file), true);
+      break;
+    case Kind::BAL:
+      problem = loadSfm(readBal(findExampleDataFile(dataset.file)));
+      break;
+    case Kind::Bundler: {
+      SfmData db;
+      const string filename = findExampleDataFile(dataset.file);
+      if (!readBundler(filename, db))
+        throw runtime_error("Could not read " + filename);
+      problem = loadSfm(db);
+      break;
+    }
+    case Kind::Plaza:
+      problem = loadPlaza(dataset.file);
+      break;
+  }
+  return cache.emplace(dataset.name, problem).first->second;
+}
+
+/// Thread counts given by --param threads, 1 and the hardware by default.
+vector<int> threadCounts(const benchmark::State& state) {
+#ifdef GTSAM_USE_TBB
+  const int available = tbb::this_task_arena::max_concurrency();
+#else
+  const int available = 1;
+#endif
+  ostringstream defaults;
+  defaults << 1;
+  if (available > 1) defaults << "," << available;
+
+  vector<int> counts;
+  istringstream is(state.parameter("threads", defaults.str()));
+  string token;
+  while (getline(is, token, ',')) {
+    const int n = stoi(token);
+    if (n > available) {
+      cerr << "Skipping " << n << " threads, only " << available
+           << " available" << endl;
+      continue;
+    }
+    counts.push_back(n);
+  }
+  return counts;
+}
+
+/// Time f() once per thread count, with f reporting its counters and series.
+template <class F>
+void measureThreads(benchmark::State& state, F f) {
+  for (int n : threadCounts(state)) {
+    map<string, double> counters;
+    map<string, vector<double> > series;
+    benchmark::resetPeakMemory();
+    state.measureOnce("t" + to_string(n), [&] {
+      counters.clear();
+      series.clear();
+#ifdef GTSAM_USE_TBB
+      tbb::task_arena arena(n);
+      arena.execute([&] { f(counters, series); });
+#else
+      f(counters, series);
+#endif
+    });
+    for (const auto& c : counters) state.counter(c.first, c.second);
+    for (const auto& s : series) state.series(s.first, s.second);
+    state.counter("peak_rss_mb", benchmark::peakMemoryMB());
+  }
+}
+
+/**
+ * Levenberg-Marquardt to convergence, iterating by hand with the stopping
+ * criteria of NonlinearOptimizer::defaultOptimize so that every iteration
+ * can be timed.
+ */
+void runBatch(benchmark::State& state, const Dataset& dataset,
+              const LevenbergMarquardtParams& params) {
+  const Problem& p = problem(dataset);
+  measureThreads(state, [&](map<string, double>& counters,
+                            map<string, vector<double> >& series) {
+    vector<double>& iterationTimes = series["iteration_ms"];
+    LevenbergMarquardtOptimizer optimizer(p.graph, p.initial, params);
+    double currentError = optimizer.error();
+    if (currentError > params.errorTol) {
+      do {
+        currentError = optimizer.error();
+        const Clock::time_point start = Clock::now();
+        optimizer.iterate();
+        iterationTimes.push_back(milliseconds(start));
+      } while (optimizer.iterations() < params.maxIterations &&
+               !checkConvergence(params.relativeErrorTol,
+                                 params.absoluteErrorTol, params.errorTol,
+                                 currentError, optimizer.error(),
+                                 params.verbosity) &&
+               std::isfinite(currentError));
+    }
+    counters["error"] = optimizer.error();
+    counters["iterations"] = optimizer.iterations();
+  });
+}
+
+/**
+ * ISAM2 fed the factors in file order, with one update per new variable:
+ * each update holds the factor that introduces a variable and all factors
+ * between existing variables that follow it.
+ */
+void runIncremental(benchmark::State& state, const Dataset& dataset,
+                    const ISAM2Params& params) {
+  const Problem& p = problem(dataset);
+  measureThreads(state, [&](map<string, double>& counters,
+                            map<string, vector<double> >& series) {
+    vector<double>& updateTimes = series["update_ms"];
+    ISAM2 isam(params);
+    KeySet known;
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    auto update = [&] {
+      const Clock::time_point start = Clock::now();
+      isam.update(newFactors, newValues);
+      updateTimes.push_back(milliseconds(start));
+      newFactors.resize(0);
+      newValues.clear();
+    };
+
+    for (const auto& factor : p.graph) {
+      bool introduces = false;
+      for (Key key : factor->keys())
+        if (!known.count(key)) introduces = true;
+      if (introduces && !newValues.empty()) update();
+      for (Key key : factor->keys()) {
+        if (known.insert(key).second)
+          newValues.insert(key, p.initial.at(key));
+      }
+      newFactors.push_back(factor);
+    }
+    if (!newFactors.empty()) update();
+
+    counters["error"] = p.graph.error(isam.calculateEstimate());
+    counters["updates"] = updateTimes.size();
+  });
+}
+
+/// Register every combination of data set and solver configuration.
+struct Registration {
+  Registration() {
+    const vector<string> solvers = {"MULTIFRONTAL_CHOLESKY", "MULTIFRONTAL_QR",
+                                    "SEQUENTIAL_CHOLESKY", "SEQUENTIAL_QR"};
+    vector<string> orderings = {"COLAMD", "NATURAL"};
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+    orderings.insert(orderings.begin() + 1, "METIS");
+#endif
+
+    for (const Dataset& dataset : kDatasets) {
+      const string name = dataset.name;
+      for (const string& solver : solvers) {
+        for (const string& ordering : orderings) {
+          LevenbergMarquardtParams params;
+          params.setLinearSolverType(solver);
+          // setOrderingType only accepts COLAMD and METIS
+          if (ordering == "NATURAL")
+            params.orderingType = Ordering::NATURAL;
+          else
+            params.setOrderingType(ordering);
+          benchmark::registerBenchmark(
+              "Datasets", name + "/batch/" + solver + "/" + ordering,
+              [&dataset, params](benchmark::State& state) {
+                runBatch(state, dataset, params);
+              });
+        }
+      }
+
+      // Conjugate gradients with a block-Jacobi preconditioner, as in
+      // SFMExample_SmartFactorPCG
+      LevenbergMarquardtParams pcgParams;
+      pcgParams.setLinearSolverType("ITERATIVE");
+      auto pcg = boost::make_shared<PCGSolverParameters>();
+      pcg->preconditioner_ =
+          boost::make_shared<BlockJacobiPreconditionerParameters>();
+      pcgParams.iterativeParams = pcg;
+      benchmark::registerBenchmark(
+          "Datasets", name + "/batch/PCG",
+          [&dataset, pcgParams](benchmark::State& state) {
+            runBatch(state, dataset, pcgParams);
+          });
+
+      if (!dataset.incremental) continue;
+      for (auto factorization : {ISAM2Params::CHOLESKY, ISAM2Params::QR}) {
+        ISAM2Params params;
+        params.factorization = factorization;
+        benchmark::registerBenchmark(
+            "Datasets",
+            name + "/ISAM2/" +
+                (factorization == ISAM2Params::CHOLESKY ? "CHOLESKY" : "QR"),
+            [&dataset, params](benchmark::State& state) {
+              runIncremental(state, dataset, params);
+            });
+      }
+    }
+  }
+} registration;
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  // A run to convergence is long enough to be timed once
+  benchmark::Options defaults;
+  defaults.repetitions = 1;
+  defaults.warmup = 0;
+  return benchmark::runAll(argc, argv, defaults);
+}
@@ -0,0 +1,22 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    main.cpp
+ * @brief   Runs all benchmark cases linked into the executable
+ * @date    October 2026
+ */
+
+#include "Benchmark.h"
+
+int main(int argc, char* argv[]) {
+  return gtsam::benchmark::runAll(argc, argv);
+}